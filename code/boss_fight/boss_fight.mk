@@ -26,7 +26,7 @@ BOSS_FIGHT_assets_conv = $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_co
 
 #assets/boss_fight/map.coll: assets/boss_fight/map.glb
 #	@echo "    [COLL] $@"
-#	code/boss_fight/tools/gltf_to_coll "$<" assets/boss_fight/map.coll
+#	code/boss_fight/tools/gltf_to_coll "$<" assets/boss_fight/map.coll --tri-planes
 
 filesystem/boss_fight/%.coll: assets/boss_fight/%.coll
 	@mkdir -p $(dir $@)
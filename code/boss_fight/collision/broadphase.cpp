@@ -0,0 +1,81 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#include <libdragon.h>
+#include <algorithm>
+#include "broadphase.h"
+
+namespace {
+  // extra room for small pushes after the pairs were built, spheres moving further are checked with 'isInBounds'
+  constexpr float PAIR_MARGIN = 0.25f;
+  // bounds are stored as 16bit ints, same scale as the BVH
+  constexpr float BOUNDS_SCALE = 64.0f;
+}
+
+void Coll::SphereBroadphase::build(const std::vector<Sphere*> &spheres, float deltaTime)
+{
+  uint32_t count = spheres.size();
+  intervals.clear();
+  bounds.resize(count);
+  pairs.clear();
+  unpaired.clear();
+
+  for(uint32_t s=0; s<count; ++s) {
+    const auto &sphere = *spheres[s];
+    if(sphere.mask == 0) {
+      bounds[s] = {};
+      unpaired.push_back(s);
+      continue;
+    }
+
+    auto posEnd = sphere.center + sphere.velocity * deltaTime;
+    float extend = sphere.radius + PAIR_MARGIN;
+
+    AABB &aabb = bounds[s];
+    for(int i=0; i<3; ++i) {
+      aabb.min.v[i] = (int16_t)((fminf(sphere.center.v[i], posEnd.v[i]) - extend) * BOUNDS_SCALE);
+      aabb.max.v[i] = (int16_t)((fmaxf(sphere.center.v[i], posEnd.v[i]) + extend) * BOUNDS_SCALE);
+    }
+    intervals.push_back({aabb.min.v[0], aabb.max.v[0], (uint16_t)s});
+  }
+
+  std::sort(intervals.begin(), intervals.end(), [](const Interval &a, const Interval &b) {
+    return a.min < b.min;
+  });
+
+  for(uint32_t i=0; i<intervals.size(); ++i) {
+    const auto &intA = intervals[i];
+    for(uint32_t j=i+1; j<intervals.size() && intervals[j].min <= intA.max; ++j)
+    {
+      uint32_t a = intA.index;
+      uint32_t b = intervals[j].index;
+      if(!bounds[a].vsAABB(bounds[b]))continue;
+      if(!canCollide(*spheres[a], *spheres[b]))continue;
+      pairs.push_back(a < b ? ((a << 16) | b) : ((b << 16) | a));
+    }
+  }
+
+  // sorting the packed pairs groups them by 'a' with ascending 'b'
+  std::sort(pairs.begin(), pairs.end());
+
+  partners.resize(pairs.size());
+  pairStart.assign(count + 1, 0);
+  for(uint32_t p=0; p<pairs.size(); ++p) {
+    partners[p] = pairs[p] & 0xFFFF;
+    ++pairStart[(pairs[p] >> 16) + 1];
+  }
+  for(uint32_t s=0; s<count; ++s) {
+    pairStart[s+1] += pairStart[s];
+  }
+}
+
+bool Coll::SphereBroadphase::isInBounds(uint32_t s, const Sphere &sphere) const
+{
+  const AABB &aabb = bounds[s];
+  for(int i=0; i<3; ++i) {
+    if((sphere.center.v[i] - sphere.radius) * BOUNDS_SCALE < aabb.min.v[i])return false;
+    if((sphere.center.v[i] + sphere.radius) * BOUNDS_SCALE > aabb.max.v[i])return false;
+  }
+  return true;
+}
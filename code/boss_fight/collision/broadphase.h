@@ -0,0 +1,62 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+#include <vector>
+#include "shapes.h"
+
+namespace Coll
+{
+  /**
+   * Sort-and-sweep broadphase for the sphere-vs-sphere checks in 'Coll::Scene::update'.
+   * Spheres are sorted along X by their bounds (extended by the movement of the frame),
+   * and candidate pairs are stored per sphere, ordered the same way a full O(n^2) loop would visit them.
+   */
+  class SphereBroadphase
+  {
+    private:
+      struct Interval {
+        int16_t min{};
+        int16_t max{};
+        uint16_t index{};
+      };
+
+      std::vector<Interval> intervals{};
+      std::vector<AABB> bounds{};
+      std::vector<uint32_t> pairs{};     // packed as (a << 16) | b, with a < b
+      std::vector<uint16_t> partners{};  // 'b' of all pairs, grouped by 'a'
+      std::vector<uint32_t> pairStart{}; // per sphere, offset into 'partners'
+      std::vector<uint16_t> unpaired{};  // spheres with no mask at build time, ascending
+
+    public:
+      static bool canCollide(const Sphere &a, const Sphere &b) {
+        // TODO: source & target mask instead of one mask
+        if(!(a.mask & b.mask))return false;
+        return !(a.type == CollType::COIN && b.type == CollType::COIN);
+      }
+
+      void build(const std::vector<Sphere*> &spheres, float deltaTime);
+
+      // candidate partners of sphere 'a', all of them have a higher index than 'a'
+      [[nodiscard]] const uint16_t* pairsBegin(uint32_t a) const {
+        return partners.data() + pairStart[a];
+      }
+
+      [[nodiscard]] const uint16_t* pairsEnd(uint32_t a) const {
+        return partners.data() + pairStart[a+1];
+      }
+
+      // spheres left out of the pairs, callbacks can still give them a mask later in the frame
+      [[nodiscard]] const std::vector<uint16_t> &getUnpaired() const {
+        return unpaired;
+      }
+
+      // whether the sphere still lies within the bounds its pairs were built from, false for unpaired spheres
+      [[nodiscard]] bool isInBounds(uint32_t s, const Sphere &sphere) const;
+
+      [[nodiscard]] uint32_t getPairCount() const {
+        return partners.size();
+      }
+  };
+}
@@ -5,63 +5,28 @@
 #include "bvh.h"
 #include "../debug/debugDraw.h"
 
-namespace {
-  const int16_t *ctxData;
-  const Coll::AABB *ctxAABB;
-  const Coll::IVec3 *ctxRayPos;
-  Coll::BVHResult *ctxRes;
+Coll::BVHStats Coll::bvhStats{};
 
-  void queryNodeAABB(const Coll::BVHNode *node)
-  {
-    if(!node->aabb.vsAABB(*ctxAABB))return;
-
-    int dataCount = node->value & 0b1111;
-    int offset = (int16_t)node->value >> 4;
-
-    if(dataCount == 0) {
-      queryNodeAABB(&node[offset]);
-      queryNodeAABB(&node[offset + 1]);
-      return;
-    }
-
-    int offsetEnd = offset + dataCount;
-    while(offset < offsetEnd && ctxRes->count < Coll::MAX_RESULT_COUNT) {
-      ctxRes->triIndex[ctxRes->count++] = ctxData[offset++];
-    }
-  }
-
-  void queryNodeRaycastFloor(const Coll::BVHNode *node)
-  {
-    if(!node->aabb.vs2DPointY(*ctxRayPos))return;
-
-    int dataCount = node->value & 0b1111;
-    int offset = (int16_t)node->value >> 4;
-
-    if(dataCount == 0) {
-      queryNodeRaycastFloor(&node[offset]);
-      queryNodeRaycastFloor(&node[offset + 1]);
-      return;
-    }
-
-    int offsetEnd = offset + dataCount;
-    while(offset < offsetEnd && ctxRes->count < Coll::MAX_RESULT_COUNT) {
-      ctxRes->triIndex[ctxRes->count++] = ctxData[offset++];
-    }
-  }
+void Coll::BVH::vsAABB(const Coll::AABB &aabb, BVHResult &res) const {
+  queryAABB(aabb, [&res](int16_t triIndex) {
+    if(res.count < Coll::MAX_RESULT_COUNT)res.triIndex[res.count++] = triIndex;
+  });
 }
 
-void Coll::BVH::vsAABB(const Coll::AABB &aabb, BVHResult &res) const {
-  ctxData = (int16_t*)&nodes[nodeCount]; // data starts right after nodes;
-  ctxAABB = &aabb;
-  ctxRes = &res;
-  queryNodeAABB(nodes);
+void Coll::BVH::vsAABB(const Coll::AABB &aabb, BVHResultList &res) const {
+  queryAABB(aabb, [&res](int16_t triIndex) {
+    res.triIndex.push_back(triIndex);
+  });
 }
 
 void Coll::BVH::raycastFloor(const Coll::IVec3 &pos, Coll::BVHResult &res) const {
-  ctxData = (int16_t*)&nodes[nodeCount]; // data starts right after nodes;
-  ctxRayPos = &pos;
-  ctxRes = &res;
-  queryNodeRaycastFloor(nodes);
+  queryRaycastFloor(pos, [&res](int16_t triIndex) {
+    if(res.count < Coll::MAX_RESULT_COUNT)res.triIndex[res.count++] = triIndex;
+  });
 }
 
-
+void Coll::BVH::raycastFloor(const Coll::IVec3 &pos, Coll::BVHResultList &res) const {
+  queryRaycastFloor(pos, [&res](int16_t triIndex) {
+    res.triIndex.push_back(triIndex);
+  });
+}
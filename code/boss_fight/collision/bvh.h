@@ -6,10 +6,23 @@
 #include <vector>
 #include "shapes.h"
 
+#ifdef COLL_BVH_STATS
+  #define COLL_BVH_STAT(x) x
+#else
+  #define COLL_BVH_STAT(x)
+#endif
+
 namespace Coll
 {
   constexpr int MAX_RESULT_COUNT = 32;
+  // max. depth of the tree, the builder stays well below that for meshes that fit into 16bit indices
+  constexpr int BVH_STACK_SIZE = 48;
+  // max. boxes per batched query, each one takes a bit in the traversal mask
+  constexpr uint32_t MAX_BATCH_SIZE = 32;
+  // set in 'BVH::dataCount' for trees using the depth-first layout with skip offsets ('gltf_to_coll --bvh-skip')
+  constexpr uint16_t BVH_FLAG_SKIP_LAYOUT = 0x8000;
 
+  // Fixed-size result, silently drops any triangles past 'MAX_RESULT_COUNT'
   struct BVHResult {
     int16_t triIndex[MAX_RESULT_COUNT]{};
     int16_t count{};
@@ -17,24 +30,292 @@ namespace Coll
     void reset() { count = 0; }
   };
 
+  // Growable result that never drops triangles.
+  // Keep it around between queries, it will only allocate until it reached the peak size.
+  struct BVHResultList {
+    std::vector<int16_t> triIndex{};
+
+    void reset() { triIndex.clear(); }
+  };
+
   struct BVHNode {
     AABB aabb{};
     uint16_t value{};
   };
   static_assert(sizeof(BVHNode) == (7 * sizeof(int16_t)));
 
+  // Traversal counters, only updated when compiled with 'COLL_BVH_STATS' (see 'tools/bvh_bench')
+  struct BVHStats {
+    uint32_t nodesVisited{};
+    uint32_t leavesHit{};
+    // optional hook for every node/data read, used to simulate the data-cache
+    void (*onFetch)(const void *ptr, uint32_t size){};
+
+    void reset() {
+      nodesVisited = 0;
+      leavesHit = 0;
+    }
+
+    void fetch(const void *ptr, uint32_t size) {
+      if(onFetch)onFetch(ptr, size);
+    }
+  };
+  extern BVHStats bvhStats;
+
+  /**
+   * Node layouts:
+   * - default: nodes in the order of the builder, inner nodes store the relative offset to their two children.
+   * - skip: depth-first order, the first child directly follows its parent.
+   *   Inner nodes store the offset to the node after their subtree, leaves implicitly skip by one.
+   * In both, the upper 12 bits of 'value' are the data offset for leaves, the lower 4 bits the triangle count.
+   */
   struct BVH {
     uint16_t nodeCount;
-    uint16_t dataCount;
+    uint16_t dataCount; // upper bit: 'BVH_FLAG_SKIP_LAYOUT'
     BVHNode nodes[];
     // uint16_t data[];
 
+    [[nodiscard]] const int16_t* getData() const {
+      return (const int16_t*)&nodes[nodeCount]; // data starts right after nodes
+    }
+
+    [[nodiscard]] uint16_t getDataCount() const {
+      return dataCount & ~BVH_FLAG_SKIP_LAYOUT;
+    }
+
+    [[nodiscard]] bool isSkipLayout() const {
+      return dataCount & BVH_FLAG_SKIP_LAYOUT;
+    }
+
+    /**
+     * Iterative traversal, all state lives in this call so it is reentrant.
+     * 'test' decides if a node is entered, 'onTri' is called for each triangle index of every leaf hit.
+     */
+    template<typename TEST, typename FN>
+    void traverse(TEST &&test, FN &&onTri) const
+    {
+      if(isSkipLayout()) {
+        traverseSkip(test, onTri);
+      } else {
+        traverseStack(test, onTri);
+      }
+    }
+
+    // stackless traversal of the skip layout, only ever walks forward through nodes and data
+    template<typename TEST, typename FN>
+    void traverseSkip(TEST &&test, FN &&onTri) const
+    {
+      const int16_t *data = getData();
+      const BVHNode *node = nodes;
+      const BVHNode *nodeEnd = nodes + nodeCount;
+
+      while(node < nodeEnd)
+      {
+        COLL_BVH_STAT(++bvhStats.nodesVisited);
+        COLL_BVH_STAT(bvhStats.fetch(node, sizeof(BVHNode)));
+        int dataCount = node->value & 0b1111;
+        int offset = node->value >> 4;
+
+        if(!test(node->aabb)) {
+          node += dataCount ? 1 : offset;
+          continue;
+        }
+
+        if(dataCount) {
+          COLL_BVH_STAT(++bvhStats.leavesHit);
+          COLL_BVH_STAT(bvhStats.fetch(&data[offset], dataCount * sizeof(int16_t)));
+          int offsetEnd = offset + dataCount;
+          while(offset < offsetEnd)onTri(data[offset++]);
+        }
+        ++node;
+      }
+    }
+
+    // traversal of the default layout, using an explicit stack
+    template<typename TEST, typename FN>
+    void traverseStack(TEST &&test, FN &&onTri) const
+    {
+      const int16_t *data = getData();
+      const BVHNode *stack[BVH_STACK_SIZE];
+      int stackSize = 0;
+      const BVHNode *node = nodes;
+
+      for(;;)
+      {
+        COLL_BVH_STAT(++bvhStats.nodesVisited);
+        COLL_BVH_STAT(bvhStats.fetch(node, sizeof(BVHNode)));
+        if(test(node->aabb))
+        {
+          int dataCount = node->value & 0b1111;
+          int offset = (int16_t)node->value >> 4;
+
+          if(dataCount == 0) {
+            assertf(stackSize < BVH_STACK_SIZE, "BVH too deep!");
+            stack[stackSize++] = &node[offset + 1];
+            node = &node[offset];
+            continue;
+          }
+
+          COLL_BVH_STAT(++bvhStats.leavesHit);
+          COLL_BVH_STAT(bvhStats.fetch(&data[offset], dataCount * sizeof(int16_t)));
+          int offsetEnd = offset + dataCount;
+          while(offset < offsetEnd)onTri(data[offset++]);
+        }
+
+        if(stackSize == 0)return;
+        node = stack[--stackSize];
+      }
+    }
+
+    template<typename FN>
+    void queryAABB(const AABB &aabb, FN &&onTri) const {
+      traverse([&aabb](const AABB &nodeAABB) { return nodeAABB.vsAABB(aabb); }, onTri);
+    }
+
+    template<typename FN>
+    void querySphere(const Sphere &sphere, FN &&onTri) const {
+      queryAABB((sphere * 64.0f).toAABB(), onTri);
+    }
+
+    template<typename FN>
+    void queryRaycastFloor(const Coll::IVec3 &pos, FN &&onTri) const {
+      traverse([&pos](const AABB &nodeAABB) { return nodeAABB.vs2DPointY(pos); }, onTri);
+    }
+
+    /**
+     * Batched query, walks the tree once for up to 'MAX_BATCH_SIZE' boxes.
+     * Each visited node carries a mask of the boxes still overlapping it,
+     * so the parts of the tree shared by close-by boxes are only fetched once.
+     * 'onTri' is called with the box index and triangle index for each leaf hit.
+     */
+    template<typename FN>
+    void queryAABBs(const AABB *aabbs, uint32_t count, FN &&onTri) const
+    {
+      assertf(count <= MAX_BATCH_SIZE, "Batch too large: %d", (int)count);
+      if(count == 0)return;
+      if(isSkipLayout())return queryAABBsSkip(aabbs, count, onTri);
+
+      struct StackEntry {
+        const BVHNode *node;
+        uint32_t mask;
+      };
+
+      const int16_t *data = getData();
+      StackEntry stack[BVH_STACK_SIZE];
+      int stackSize = 0;
+      const BVHNode *node = nodes;
+      uint32_t mask = count == 32 ? 0xFFFF'FFFF : ((1u << count) - 1);
+
+      for(;;)
+      {
+        COLL_BVH_STAT(++bvhStats.nodesVisited);
+        COLL_BVH_STAT(bvhStats.fetch(node, sizeof(BVHNode)));
+        uint32_t hitMask = 0;
+        for(uint32_t m = mask; m; m &= m - 1) {
+          uint32_t i = __builtin_ctz(m);
+          if(node->aabb.vsAABB(aabbs[i]))hitMask |= 1u << i;
+        }
+
+        if(hitMask)
+        {
+          int dataCount = node->value & 0b1111;
+          int offset = (int16_t)node->value >> 4;
+
+          if(dataCount == 0) {
+            assertf(stackSize < BVH_STACK_SIZE, "BVH too deep!");
+            stack[stackSize++] = {&node[offset + 1], hitMask};
+            node = &node[offset];
+            mask = hitMask;
+            continue;
+          }
+
+          COLL_BVH_STAT(++bvhStats.leavesHit);
+          COLL_BVH_STAT(bvhStats.fetch(&data[offset], dataCount * sizeof(int16_t)));
+          int offsetEnd = offset + dataCount;
+          for(uint32_t m = hitMask; m; m &= m - 1) {
+            uint32_t i = __builtin_ctz(m);
+            for(int d=offset; d<offsetEnd; ++d)onTri(i, data[d]);
+          }
+        }
+
+        if(stackSize == 0)return;
+        --stackSize;
+        node = stack[stackSize].node;
+        mask = stack[stackSize].mask;
+      }
+    }
+
+    /**
+     * Batched query for the skip layout. Nodes are still read strictly forward,
+     * the stack only remembers where a subtree ends to restore the parent's box mask.
+     */
+    template<typename FN>
+    void queryAABBsSkip(const AABB *aabbs, uint32_t count, FN &&onTri) const
+    {
+      struct StackEntry {
+        const BVHNode *end;
+        uint32_t mask;
+      };
+
+      const int16_t *data = getData();
+      StackEntry stack[BVH_STACK_SIZE];
+      int stackSize = 0;
+      const BVHNode *node = nodes;
+      const BVHNode *nodeEnd = nodes + nodeCount;
+      uint32_t mask = count == 32 ? 0xFFFF'FFFF : ((1u << count) - 1);
+
+      while(node < nodeEnd)
+      {
+        while(stackSize && node == stack[stackSize-1].end) {
+          mask = stack[--stackSize].mask;
+        }
+
+        COLL_BVH_STAT(++bvhStats.nodesVisited);
+        COLL_BVH_STAT(bvhStats.fetch(node, sizeof(BVHNode)));
+        int dataCount = node->value & 0b1111;
+        int offset = node->value >> 4;
+
+        uint32_t hitMask = 0;
+        for(uint32_t m = mask; m; m &= m - 1) {
+          uint32_t i = __builtin_ctz(m);
+          if(node->aabb.vsAABB(aabbs[i]))hitMask |= 1u << i;
+        }
+
+        if(!hitMask) {
+          node += dataCount ? 1 : offset;
+          continue;
+        }
+
+        if(dataCount) {
+          COLL_BVH_STAT(++bvhStats.leavesHit);
+          COLL_BVH_STAT(bvhStats.fetch(&data[offset], dataCount * sizeof(int16_t)));
+          int offsetEnd = offset + dataCount;
+          for(uint32_t m = hitMask; m; m &= m - 1) {
+            uint32_t i = __builtin_ctz(m);
+            for(int d=offset; d<offsetEnd; ++d)onTri(i, data[d]);
+          }
+        } else if(hitMask != mask) {
+          // narrow down the mask for this subtree, restored once we reach its end
+          assertf(stackSize < BVH_STACK_SIZE, "BVH too deep!");
+          stack[stackSize++] = {node + offset, mask};
+          mask = hitMask;
+        }
+        ++node;
+      }
+    }
+
     void vsAABB(const AABB &aabb, BVHResult &res) const;
+    void vsAABB(const AABB &aabb, BVHResultList &res) const;
 
     inline void vsSphere(const Sphere &sphere, BVHResult &res) const {
       vsAABB((sphere * 64.0f).toAABB(), res);
     }
 
+    inline void vsSphere(const Sphere &sphere, BVHResultList &res) const {
+      vsAABB((sphere * 64.0f).toAABB(), res);
+    }
+
     void raycastFloor(const Coll::IVec3 &pos, BVHResult &res) const;
+    void raycastFloor(const Coll::IVec3 &pos, BVHResultList &res) const;
   };
 }
\ No newline at end of file
@@ -96,6 +96,46 @@ namespace {
 		return a + (lineDir * clamp(pointDist, 0.0f, length));
   }
 
+  Coll::CollInfo triEdgesVsSphere(
+    const Coll::Sphere &sphere,
+    const T3DVec3 &vert0, const T3DVec3 &vert1, const T3DVec3 &vert2,
+    const T3DVec3 &normal
+  ) {
+    const auto &bcsPos = sphere.center;
+
+    // Edge test
+    const auto closestPoint1 = closestPointOnLine(bcsPos, vert0, vert1);
+    const auto closestPoint2 = closestPointOnLine(bcsPos, vert1, vert2);
+    const auto closestPoint3 = closestPointOnLine(bcsPos, vert2, vert0);
+
+    const auto closestDist1 = t3d_vec3_distance2(&bcsPos, &closestPoint1);
+    const auto closestDist2 = t3d_vec3_distance2(&bcsPos, &closestPoint2);
+    const auto closestDist3 = t3d_vec3_distance2(&bcsPos, &closestPoint3);
+
+    const float closestDist = fminf(closestDist1, fminf(closestDist2, closestDist3));
+    if(closestDist <= (sphere.radius*sphere.radius))
+    {
+      const auto contactPoint = (closestDist == closestDist1)
+        ? closestPoint1
+        : ((closestDist == closestDist2) ? closestPoint2 : closestPoint3);
+
+      const auto penVector = contactPoint - bcsPos;
+
+      // prevent back-face collision
+      const float faceDirAngle = t3d_vec3_dot(&penVector, &normal);
+      if(faceDirAngle > 0.0f) {
+        return {.collCount = 0};
+      }
+
+      const auto penLen = t3d_vec3_len(&penVector);
+      auto penVectorNorm = penVector / penLen * fmaxf(sphere.radius - penLen, 0.0f);
+
+      return {contactPoint, penVectorNorm, normal, 1};
+    }
+
+    return {.collCount = 0};
+  }
+
   Coll::CollInfo triVsSphere(const Coll::Sphere &sphere, const Coll::Triangle &face)
   {
     const auto &bcsPos = sphere.center;
@@ -127,37 +167,57 @@ namespace {
       }
     }
 
-    // Edge test
-    const auto closestPoint1 = closestPointOnLine(bcsPos, vert0, vert1);
-    const auto closestPoint2 = closestPointOnLine(bcsPos, vert1, vert2);
-    const auto closestPoint3 = closestPointOnLine(bcsPos, vert2, vert0);
-
-    const auto closestDist1 = t3d_vec3_distance2(&bcsPos, &closestPoint1);
-    const auto closestDist2 = t3d_vec3_distance2(&bcsPos, &closestPoint2);
-    const auto closestDist3 = t3d_vec3_distance2(&bcsPos, &closestPoint3);
+    return triEdgesVsSphere(sphere, vert0, vert1, vert2, face.normal);
+  }
 
-    const float closestDist = fminf(closestDist1, fminf(closestDist2, closestDist3));
-    if(closestDist <= (sphere.radius*sphere.radius))
-    {
-      const auto contactPoint = (closestDist == closestDist1)
-        ? closestPoint1
-        : ((closestDist == closestDist2) ? closestPoint2 : closestPoint3);
+  // dot product with a normal quantized like 'Mesh::normals'
+  float dotQuantized(const T3DVec3 &p, const Coll::IVec3 &n)
+  {
+    return (p.v[0] * n.v[0] + p.v[1] * n.v[1] + p.v[2] * n.v[2]) * (1.0f / 32767.0f);
+  }
 
-      const auto penVector = contactPoint - bcsPos;
+  /**
+   * Same as 'triVsSphere', using the precomputed planes.
+   * The face test reduces to a few dot products, only the edge test still needs the vertices.
+   */
+  Coll::CollInfo triDataVsSphere(const Coll::Sphere &sphere, const Coll::Mesh &mesh, uint32_t t)
+  {
+    const auto &bcsPos = sphere.center;
+    const auto &tri = mesh.triData[t];
+    const auto &normalQuant = mesh.normals[t];
 
-      // prevent back-face collision
-      const float faceDirAngle = t3d_vec3_dot(&penVector, &face.normal);
-      if(faceDirAngle > 0.0f) {
-        return {.collCount = 0};
-      }
+    float planeDist = dotQuantized(bcsPos, normalQuant) - tri.planeDist;
+    // too far away from the plane to touch any part of the triangle, edges included
+    if(fabsf(planeDist) > sphere.radius) {
+      return {.collCount = 0};
+    }
 
-      const auto penLen = t3d_vec3_len(&penVector);
-      auto penVectorNorm = penVector / penLen * fmaxf(sphere.radius - penLen, 0.0f);
+    float planeDistAbs = planeDist < 0.0f ? fabsf(planeDist*2.0f) : planeDist;
+    if(planeDistAbs < sphere.radius)
+    {
+      const bool isInTri = (dotQuantized(bcsPos, tri.edgeNormal[0]) <= tri.edgeDist[0])
+        && (dotQuantized(bcsPos, tri.edgeNormal[1]) <= tri.edgeDist[1])
+        && (dotQuantized(bcsPos, tri.edgeNormal[2]) <= tri.edgeDist[2]);
 
-      return {contactPoint, penVectorNorm, face.normal, 1};
+      if(isInTri)
+      {
+        const T3DVec3 normal{{
+          (float)normalQuant.v[0] * (1.0f / 32767.0f),
+          (float)normalQuant.v[1] * (1.0f / 32767.0f),
+          (float)normalQuant.v[2] * (1.0f / 32767.0f)
+        }};
+        return {
+          bcsPos + normal * -planeDist,
+          normal * (planeDist - sphere.radius),
+          normal,
+          1
+        };
+      }
     }
 
-    return {.collCount = 0};
+    // only the edge test needs the vertices
+    auto face = mesh.getTriangle(t);
+    return triEdgesVsSphere(sphere, *face.v[0], *face.v[1], *face.v[2], face.normal);
   }
 
   bool pointVsTriangle2D(const Math::Vec2 &p, const Coll::Triangle2D &tri)
@@ -179,6 +239,10 @@ Coll::CollInfo Coll::Mesh::vsSphere(const Coll::Sphere &sphere, const Coll::Tria
   return triVsSphere(sphere, triangle);
 }
 
+Coll::CollInfo Coll::Mesh::vsSphereTriData(const Coll::Sphere &sphere, uint32_t t) const {
+  return triDataVsSphere(sphere, *this, t);
+}
+
 Coll::CollInfo Coll::Mesh::vsFloorRay(const T3DVec3 &rayStart, const Coll::Triangle &face) const
 {
     const auto &vert0 = *face.v[0];
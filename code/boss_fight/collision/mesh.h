@@ -11,6 +11,20 @@ namespace Coll
 {
   struct BVH;
 
+  /**
+   * Optional precomputed per-triangle planes ('gltf_to_coll --tri-planes').
+   * Replaces the barycentric test with three dot products when testing spheres.
+   * The face plane uses the normal from 'Mesh::normals', edge normals are quantized the same way.
+   */
+  struct TriData
+  {
+    float planeDist{}; // face plane: dot(normal, p) == planeDist
+    float edgeDist[3]{};
+    IVec3 edgeNormal[3]{}; // edge planes, perpendicular to the face and pointing away from the triangle
+    int16_t padding{};
+  };
+  static_assert(sizeof(TriData) == 36);
+
   struct Mesh
   {
     // NOTE: don't place any extra members here!
@@ -21,10 +35,25 @@ namespace Coll
     T3DVec3 *verts{};
     IVec3 *normals{};
     BVH* bvh{};
-    // data follows here: indices, normals, verts, BVH
+    TriData* triData{}; // non-zero in the file if present
+    // data follows here: indices, normals, verts, BVH, tri-data
     int16_t indices[];
 
+    [[nodiscard]] Triangle getTriangle(uint32_t t) const {
+      auto &norm = normals[t];
+      return {
+        .normal = {{
+         (float)norm.v[0] * (1.0f / 32767.0f),
+         (float)norm.v[1] * (1.0f / 32767.0f),
+         (float)norm.v[2] * (1.0f / 32767.0f)
+        }},
+        .v = {&verts[indices[t*3]], &verts[indices[t*3+1]], &verts[indices[t*3+2]]}
+      };
+    }
+
     [[nodiscard]] Coll::CollInfo vsSphere(const Coll::Sphere &sphere, const Triangle& triangle) const;
+    // same as 'vsSphere' on 'getTriangle(t)', only valid if 'triData' is present
+    [[nodiscard]] Coll::CollInfo vsSphereTriData(const Coll::Sphere &sphere, uint32_t t) const;
     [[nodiscard]] Coll::CollInfo vsFloorRay(const T3DVec3 &pos, const Triangle& triangle) const;
 
     static Mesh* load(const std::string &path);
@@ -62,6 +62,12 @@ Coll::Mesh* Coll::Mesh::load(const std::string &path)
   data = align(data, 4);
   mesh->bvh = (BVH*)data;
 
+  if(mesh->triData) {
+    data += sizeof(BVH) + mesh->bvh->nodeCount * sizeof(BVHNode) + mesh->bvh->getDataCount() * sizeof(int16_t);
+    data = align(data, 4);
+    mesh->triData = (TriData*)data;
+  }
+
   //debugf("BVH: %d nodes, %d data\n", mesh->bvh->nodeCount, mesh->bvh->dataCount);
   //debugDrawBVTree(mesh->bvh);
 
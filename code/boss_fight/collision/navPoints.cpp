@@ -3,22 +3,36 @@
 * @license MIT
 */
 #include "navPoints.h"
+#include <algorithm>
 
 void Coll::NavPoints::addPoint(const T3DVec3 &point) {
-  // insert point into the list sorted by X-coord
-  auto it = points.begin();
-  while(it != points.end() && it->v[0] < point.v[0]) {
-    ++it;
-  }
-  points.insert(it, point);
+  points.push_back(point);
+}
+
+void Coll::NavPoints::build() {
+  std::sort(points.begin(), points.end(), [](const T3DVec3 &a, const T3DVec3 &b) {
+    return a.v[0] < b.v[0];
+  });
+}
+
+uint32_t Coll::NavPoints::lowerBoundX(float x) const {
+  auto it = std::lower_bound(points.begin(), points.end(), x, [](const T3DVec3 &point, float x) {
+    return point.v[0] < x;
+  });
+  return it - points.begin();
 }
 
 Coll::NavPointsRes Coll::NavPoints::getClosest(const T3DVec3 &pos, float deltaX) const {
 
   float closestDist2 = 999999999.0f;
   const T3DVec3 *closestPoint = nullptr;
-  for(const auto &point : points) {
-    if(point.x < (pos.x+deltaX))continue; // ignore points behind the player
+
+  // skip all points behind the player, then walk forward until the
+  // distance in X alone is larger than the closest point found so far
+  for(uint32_t i = lowerBoundX(pos.x + deltaX); i < points.size(); ++i) {
+    const auto &point = points[i];
+    float distX = point.x - pos.x;
+    if(distX > 0.0f && distX*distX >= closestDist2)break;
 
     float dist2 = t3d_vec3_len2(point - pos);
     if(dist2 < closestDist2) {
@@ -16,10 +16,38 @@ namespace Coll
 
   struct NavPoints
   {
-    // points, internally sorted by X-coord
+    // points, sorted by X-coord after 'build()'
     std::vector<T3DVec3> points{};
 
     void addPoint(const T3DVec3 &point);
+
+    /**
+     * Sorts all points by X, must be called once after adding points and before any query.
+     */
+    void build();
+
+    /**
+     * Returns the closest point that is at least 'deltaX' ahead (in X) of 'pos'.
+     */
     NavPointsRes getClosest(const T3DVec3 &pos, float deltaX) const;
+
+    /**
+     * Calls 'cb(const T3DVec3&, float dist2)' for each point within 'radius' of 'pos'.
+     */
+    template<typename F>
+    void queryRadius(const T3DVec3 &pos, float radius, F &&cb) const {
+      float radius2 = radius * radius;
+      for(uint32_t i = lowerBoundX(pos.x - radius); i < points.size(); ++i) {
+        const auto &point = points[i];
+        if(point.x > (pos.x + radius))break;
+
+        float dist2 = t3d_vec3_len2(point - pos);
+        if(dist2 <= radius2)cb(point, dist2);
+      }
+    }
+
+  private:
+    // index of the first point with an X-coord >= 'x'
+    [[nodiscard]] uint32_t lowerBoundX(float x) const;
   };
-}
\ No newline at end of file
+}
@@ -5,10 +5,13 @@
 #include "scene.h"
 #include "bvh.h"
 #include "../debug/debugDraw.h"
+#include <algorithm>
 
 namespace {
   constexpr float MIN_PENETRATION = 0.00005f;
   constexpr float FLOOR_ANGLE = 0.7f;
+  // logs all mesh queries (in mesh-local space), can be replayed with 'tools/bvh_bench'
+  constexpr bool RECORD_QUERIES = false;
 
   constexpr bool isFloor(const Coll::IVec3 &normal) {
     return normal.v[1] > (int16_t)(0x7FFF * FLOOR_ANGLE);
@@ -16,9 +19,52 @@ namespace {
   constexpr bool isFloor(const T3DVec3 &normal) {
     return normal.v[1] > FLOOR_ANGLE;
   }
+
+  // extra room around batched queries for small pushes, spheres pushed further query the BVH again
+  constexpr float BATCH_MARGIN = 0.1f;
+
+  // box covering the sphere over the whole frame (all sub-steps), in world space
+  void getSweptBounds(const Coll::Sphere &sphere, float deltaTime, float margin, T3DVec3 &min, T3DVec3 &max) {
+    auto posEnd = sphere.center + sphere.velocity * deltaTime;
+    float extend = sphere.radius + margin;
+    for(int i=0; i<3; ++i) {
+      min.v[i] = fminf(sphere.center.v[i], posEnd.v[i]) - extend;
+      max.v[i] = fmaxf(sphere.center.v[i], posEnd.v[i]) + extend;
+    }
+  }
+
+  bool isInBounds(const Coll::Sphere &sphere, const T3DVec3 &min, const T3DVec3 &max) {
+    for(int i=0; i<3; ++i) {
+      if(sphere.center.v[i] - sphere.radius < min.v[i])return false;
+      if(sphere.center.v[i] + sphere.radius > max.v[i])return false;
+    }
+    return true;
+  }
+
+  // same box in the local space of a mesh, in BVH units, rounded outwards so it covers the float box
+  Coll::AABB toMeshAABB(const T3DVec3 &min, const T3DVec3 &max, const T3DVec3 &meshPos) {
+    Coll::AABB res{};
+    for(int i=0; i<3; ++i) {
+      res.min.v[i] = (int16_t)floorf((min.v[i] - meshPos.v[i]) * 64.0f);
+      res.max.v[i] = (int16_t)ceilf((max.v[i] - meshPos.v[i]) * 64.0f);
+    }
+    return res;
+  }
 }
 
 Coll::CollInfo Coll::Scene::vsSphere(Coll::Sphere &sphere, const T3DVec3 &velocity, float deltaTime) {
+  return vsSphere(sphere, velocity, deltaTime, -1);
+}
+
+/**
+ * Moves the sphere in sub-steps and resolves collisions against all meshes.
+ * If 'slot' is a batch slot (see 'queryBatch'), its triangles are tested instead of querying the BVH each step,
+ * for as long as the sphere stays inside the box they were queried with.
+ */
+Coll::CollInfo Coll::Scene::vsSphere(
+  Coll::Sphere &sphere, const T3DVec3 &velocity, float deltaTime, int slot
+) {
+  const BVHResultList *candidates = slot >= 0 ? batchRes.data() + slot * meshes.size() : nullptr;
   uint64_t ticksStart = get_ticks();
   float len2 = t3d_vec3_len2(velocity);
 
@@ -34,12 +80,12 @@ Coll::CollInfo Coll::Scene::vsSphere(Coll::Sphere &sphere, const T3DVec3 &veloci
     .normal = T3DVec3{0.0f, 0.0f, 0.0f},
     .collCount = 0,
   };
-  Coll::BVHResult bvhRes{};
 
   for(int s=0; s<steps; ++s)
   {
     sphere.center = sphere.center + velocityStep;
 
+    uint32_t meshIdx = 0;
     for(auto meshInst : meshes)
     {
       auto &mesh = *meshInst->mesh;
@@ -47,32 +93,31 @@ Coll::CollInfo Coll::Scene::vsSphere(Coll::Sphere &sphere, const T3DVec3 &veloci
       auto sphereLocal = sphere;
       sphereLocal.center = sphereLocal.center - meshInst->pos;
 
-      auto ticksBvhStart = get_ticks();
-      bvhRes.reset();
-      mesh.bvh->vsSphere(sphereLocal, bvhRes);
-      ticksBVH += get_ticks() - ticksBvhStart;
-      if(bvhRes.count >= Coll::MAX_RESULT_COUNT-1) {
-        //debugf("BVH count: %d\n", bvhRes.count);
+      // pushed out of the batched box, the rest of the frame has to query the BVH
+      if(candidates && !isInBounds(sphere, batchBounds[slot].min, batchBounds[slot].max)) {
+        candidates = nullptr;
       }
 
-      for(int b=0; b<bvhRes.count; ++b) {
-        uint32_t t = bvhRes.triIndex[b];
+      const BVHResultList *meshTris = &bvhRes;
+      if(candidates) {
+        meshTris = &candidates[meshIdx];
+      } else {
+        if constexpr(RECORD_QUERIES) {
+          debugf("@coll S %.4f %.4f %.4f %.4f\n",
+            sphereLocal.center.v[0], sphereLocal.center.v[1], sphereLocal.center.v[2], sphereLocal.radius
+          );
+        }
 
-        int idxA = mesh.indices[t*3];
-        int idxB = mesh.indices[t*3+1];
-        int idxC = mesh.indices[t*3+2];
-        auto &norm = mesh.normals[t];
-
-        Triangle tri{
-          .normal = {{
-           (float)norm.v[0] * (1.0f / 32767.0f),
-           (float)norm.v[1] * (1.0f / 32767.0f),
-           (float)norm.v[2] * (1.0f / 32767.0f)
-          }},
-          .v = {&mesh.verts[idxA], &mesh.verts[idxB], &mesh.verts[idxC]}
-        };
-
-        auto collInfo = mesh.vsSphere(sphereLocal, tri);
+        auto ticksBvhStart = get_ticks();
+        bvhRes.reset();
+        mesh.bvh->vsSphere(sphereLocal, bvhRes);
+        ticksBVH += get_ticks() - ticksBvhStart;
+      }
+
+      for(uint32_t t : meshTris->triIndex) {
+        auto collInfo = mesh.triData
+          ? mesh.vsSphereTriData(sphereLocal, t)
+          : mesh.vsSphere(sphereLocal, mesh.getTriangle(t));
         if(collInfo.collCount)
         {
           float penLen2 = t3d_vec3_len2(&collInfo.penetration);
@@ -87,6 +132,7 @@ Coll::CollInfo Coll::Scene::vsSphere(Coll::Sphere &sphere, const T3DVec3 &veloci
           sphere.center = sphere.center - collInfo.penetration;
         }
       } // BVH res
+      ++meshIdx;
     } // meshes
   } // steps
 
@@ -94,14 +140,94 @@ Coll::CollInfo Coll::Scene::vsSphere(Coll::Sphere &sphere, const T3DVec3 &veloci
   return res;
 }
 
+/**
+ * Queries the BVH of each mesh once for all spheres colliding with meshes,
+ * using boxes that cover the movement of the whole frame.
+ * Results are stored per sphere and mesh in 'batchRes' and consumed by 'vsSphere'.
+ */
+void Coll::Scene::queryBatch(float deltaTime)
+{
+  uint64_t ticksStart = get_ticks();
+
+  uint32_t slotCount = 0;
+  batchSlot.resize(spheres.size());
+  for(uint32_t s=0; s<spheres.size(); ++s) {
+    batchSlot[s] = (spheres[s]->interactType & InteractType::TRI_MESH) ? slotCount++ : -1;
+  }
+
+  uint32_t meshCount = meshes.size();
+  batchAABBs.resize(slotCount);
+  batchBounds.resize(slotCount);
+  batchRes.resize(slotCount * meshCount);
+  for(auto &res : batchRes)res.reset();
+
+  for(uint32_t s=0; s<spheres.size(); ++s) {
+    if(batchSlot[s] < 0)continue;
+    auto &bounds = batchBounds[batchSlot[s]];
+    getSweptBounds(*spheres[s], deltaTime, BATCH_MARGIN, bounds.min, bounds.max);
+  }
+
+  uint32_t meshIdx = 0;
+  for(auto meshInst : meshes)
+  {
+    for(uint32_t slot=0; slot<slotCount; ++slot) {
+      batchAABBs[slot] = toMeshAABB(batchBounds[slot].min, batchBounds[slot].max, meshInst->pos);
+    }
+
+    for(uint32_t b=0; b<slotCount; b += MAX_BATCH_SIZE) {
+      uint32_t count = Math::min(slotCount - b, MAX_BATCH_SIZE);
+      meshInst->mesh->bvh->queryAABBs(&batchAABBs[b], count, [&](uint32_t i, int16_t triIndex) {
+        batchRes[(b + i) * meshCount + meshIdx].triIndex.push_back(triIndex);
+      });
+    }
+    ++meshIdx;
+  }
+
+  uint64_t ticksBatch = get_ticks() - ticksStart;
+  ticksBVH += ticksBatch;
+  ticks += ticksBatch;
+}
+
+/**
+ * Batch slot of the sphere at index 's', or -1 if callbacks changed it in a way
+ * the batch doesn't cover (became a mesh collider, or moves further than the queried box).
+ * Pushes during the sub-steps are checked in 'vsSphere'.
+ */
+int Coll::Scene::getBatchSlot(uint32_t s, float deltaTime) const
+{
+  int slot = batchSlot[s];
+  if(slot < 0)return -1;
+
+  T3DVec3 min, max;
+  getSweptBounds(*spheres[s], deltaTime, 0.0f, min, max);
+  const auto &bounds = batchBounds[slot];
+  for(int i=0; i<3; ++i) {
+    if(min.v[i] < bounds.min.v[i] || max.v[i] > bounds.max.v[i])return -1;
+  }
+  return slot;
+}
+
 void Coll::Scene::update(float deltaTime)
 {
+  if constexpr(RECORD_QUERIES)debugf("@coll F\n");
+
   for(auto sp : spheres) {
     sp->hitTriTypes = 0;
   }
 
+  queryBatch(deltaTime);
+  broadphase.build(spheres, deltaTime);
+  const auto &unpaired = broadphase.getUnpaired();
+  escaped.assign(unpaired.begin(), unpaired.end());
+  isEscaped.assign(spheres.size(), false);
+  for(auto s : escaped)isEscaped[s] = true;
+
+  // callbacks can (un)register spheres, that's deferred until the end so the batch stays valid
+  isUpdating = true;
+
   for(uint32_t s=0; s<spheres.size(); ++s) {
-    auto &sphere = spheres[s];
+    auto sphere = spheres[s];
+    if(!sphere)continue; // unregistered by a callback
 
     // Static/Triangle mesh collision
     bool checkColl = sphere->interactType & InteractType::TRI_MESH;
@@ -122,7 +248,7 @@ void Coll::Scene::update(float deltaTime)
 
     // ...if we are not inside one, check actual mesh data
     if(checkColl) {
-      auto res = vsSphere(*sphere, sphere->velocity, deltaTime);
+      auto res = vsSphere(*sphere, sphere->velocity, deltaTime, getBatchSlot(s, deltaTime));
       if(res.collCount) {
         bool hitFloor = isFloor(res.normal);
         sphere->hitTriTypes |= hitFloor ? TriType::FLOOR : TriType::WALL;
@@ -136,14 +262,37 @@ void Coll::Scene::update(float deltaTime)
       }
     }
 
-    // Dynamic Colliders
-    for(uint32_t s2=s+1; s2<spheres.size(); ++s2)
+    // Dynamic Colliders, candidate pairs from the broadphase (masks & types are already filtered there).
+    // Spheres that were moved out of their bounds since (by meshes, pushes or callbacks) or had no mask
+    // when the pairs were built are tested against every sphere instead.
+    // The next candidate is picked on each iteration, so spheres flagged during the loop are still seen.
+    checkEscaped(s);
+    const uint16_t *pair = broadphase.pairsBegin(s);
+    const uint16_t *pairEnd = broadphase.pairsEnd(s);
+    uint32_t s2 = s;
+    for(;;)
     {
-      if(!(sphere->mask & spheres[s2]->mask))continue;
-      // TODO: source & target mask instead of one mask
-      if(sphere->type == CollType::COIN && spheres[s2]->type == CollType::COIN)continue;
+      if(!spheres[s])break; // unregistered itself in a callback
+
+      uint32_t next = spheres.size();
+      while(pair != pairEnd && *pair <= s2)++pair;
+      if(pair != pairEnd)next = *pair;
+      if(sphere->mask) {
+        if(isEscaped[s]) {
+          next = s2 + 1;
+        } else {
+          auto it = std::upper_bound(escaped.begin(), escaped.end(), s2);
+          if(it != escaped.end())next = Math::min(next, (uint32_t)*it);
+        }
+      }
+      if(next >= spheres.size())break;
+      s2 = next;
 
       auto sphere2 = spheres[s2];
+      if(!sphere2)continue;
+      // masks can change through callbacks during this loop
+      if(!SphereBroadphase::canCollide(*sphere, *sphere2))continue;
+
       T3DVec3 dir = sphere->center - sphere2->center;
       auto dist2 = t3d_vec3_len2(dir);
       float radSum = sphere->radius + sphere2->radius;
@@ -175,13 +324,39 @@ void Coll::Scene::update(float deltaTime)
 
           sphere->hitTriTypes |= TriType::SPHERE;
           sphere2->hitTriTypes |= TriType::SPHERE;
+          checkEscaped(s);
+          checkEscaped(s2);
         }
 
-        if(sphere->callback)sphere->callback(*sphere2);
-        if(sphere2->callback)sphere2->callback(*sphere);
+        if(sphere->callback || sphere2->callback) {
+          if(sphere->callback)sphere->callback(*sphere2);
+          if(sphere2->callback)sphere2->callback(*sphere);
+          // callbacks can move any sphere, only the ones still to be tested matter
+          for(uint32_t s3=s; s3<spheres.size(); ++s3)checkEscaped(s3);
+        }
       }
     }
   }
+
+  isUpdating = false;
+  if(hasRemoved) {
+    std::erase(spheres, nullptr);
+    hasRemoved = false;
+  }
+  spheres.insert(spheres.end(), spheresAdded.begin(), spheresAdded.end());
+  spheresAdded.clear();
+}
+
+/**
+ * Flags the sphere at index 's' if it moved out of its broadphase bounds,
+ * from then on it's tested against all spheres for the rest of the frame.
+ */
+void Coll::Scene::checkEscaped(uint32_t s)
+{
+  if(isEscaped[s] || !spheres[s])return;
+  if(broadphase.isInBounds(s, *spheres[s]))return;
+  isEscaped[s] = true;
+  escaped.insert(std::upper_bound(escaped.begin(), escaped.end(), s), s);
 }
 
 Coll::CollInfo Coll::Scene::raycastFloor(const T3DVec3 &pos) {
@@ -197,6 +372,9 @@ Coll::CollInfo Coll::Scene::raycastFloor(const T3DVec3 &pos) {
   {
     auto &mesh = *meshInst->mesh;
     auto posLocal = pos - meshInst->pos;
+    if constexpr(RECORD_QUERIES) {
+      debugf("@coll R %.4f %.4f %.4f\n", posLocal.v[0], posLocal.v[1], posLocal.v[2]);
+    }
     Coll::IVec3 posInt = {
       .v = {
         (int16_t)(posLocal.v[0] * 64.0f),
@@ -205,15 +383,12 @@ Coll::CollInfo Coll::Scene::raycastFloor(const T3DVec3 &pos) {
       }
     };
 
-    Coll::BVHResult bvhRes{};
+    bvhRes.reset();
     mesh.bvh->raycastFloor(posInt, bvhRes);
 
     float highestFloor = -99999.0f;
-    for(int b=0; b<bvhRes.count; ++b)
+    for(uint32_t t : bvhRes.triIndex)
     {
-    //for(uint32_t b=0; b<mesh.triCount; ++b) {
-      uint32_t t = bvhRes.triIndex[b];
-      //uint32_t t = b;
       if(!isFloor(mesh.normals[t]))continue;
 
       int idxA = mesh.indices[t*3];
@@ -5,6 +5,8 @@
 #pragma once
 
 #include "mesh.h"
+#include "bvh.h"
+#include "broadphase.h"
 #include "shapes.h"
 #include <set>
 #include <vector>
@@ -18,6 +20,33 @@ namespace Coll
       std::set<MeshInstance*> meshes{};
       std::vector<Sphere*> spheres{};
       Sphere voidSpheres[VOID_SPHERE_COUNT]{};
+      BVHResultList bvhRes{}; // re-used by all queries to avoid allocations
+
+      // spheres (un)registered by callbacks during 'update()', applied once the loop is done.
+      // Until then removed spheres are set to null, so indices into 'spheres' stay valid.
+      std::vector<Sphere*> spheresAdded{};
+      bool isUpdating{false};
+      bool hasRemoved{false};
+
+      struct SweptBounds {
+        T3DVec3 min{};
+        T3DVec3 max{};
+      };
+
+      // batched per-frame mesh queries, see 'queryBatch()'
+      std::vector<AABB> batchAABBs{};
+      std::vector<SweptBounds> batchBounds{}; // per slot, world-space movement the results cover
+      std::vector<int16_t> batchSlot{}; // per sphere, -1 if it doesn't collide with meshes
+      std::vector<BVHResultList> batchRes{}; // per slot and mesh: [slot * meshes.size() + mesh]
+      SphereBroadphase broadphase{};
+      // spheres outside their broadphase bounds in 'update()', those are tested against every sphere
+      std::vector<bool> isEscaped{};
+      std::vector<uint16_t> escaped{}; // same spheres, ascending
+
+      void queryBatch(float deltaTime);
+      int getBatchSlot(uint32_t s, float deltaTime) const;
+      CollInfo vsSphere(Sphere &sphere, const T3DVec3 &velocity, float deltaTime, int slot);
+      void checkEscaped(uint32_t s);
 
     public:
       uint64_t ticks{0};
@@ -33,10 +62,23 @@ namespace Coll
       }
 
       void registerSphere(Sphere *sphere) {
+        if(isUpdating)return spheresAdded.push_back(sphere);
         spheres.push_back(sphere);
       }
 
       void unregisterSphere(Sphere *sphere) {
+        if(isUpdating) {
+          std::erase(spheresAdded, sphere);
+          for(auto &sp : spheres) {
+            if(sp == sphere) {
+              sp = nullptr;
+              hasRemoved = true;
+              return;
+            }
+          }
+          return;
+        }
+
         for(auto it = spheres.begin(); it != spheres.end(); ++it) {
           if(*it == sphere)return (void)spheres.erase(it);
         }
@@ -5,6 +5,7 @@
 #include "../main.h"
 #include "culledModel.h"
 #include <array>
+#include <vector>
 
 namespace {
   constexpr float MAP_SCALE = 0.25f;
@@ -12,29 +13,32 @@ namespace {
   constexpr uint32_t LAYER_COUNT = 6;
   constexpr uint32_t LAYER_OBJ_COUNT = 16;
 
+  struct LayerEntry {
+    T3DObject *obj;
+    uint32_t objIdx;
+  };
+
   float scrollOffset = 0.0f;
 
-  std::array<std::array<T3DObject*, LAYER_OBJ_COUNT>, LAYER_COUNT> layerObj;
+  std::array<std::array<LayerEntry, LAYER_OBJ_COUNT>, LAYER_COUNT> layerObj;
   std::array<uint8_t, LAYER_COUNT> layerCount;
 
-  std::array<rspq_block_t*, 4> currBlock{};
-  uint32_t currBlockIdx = 0;
-  uint64_t lastHash = 0;
-  bool needsUpdate = false;
-  bool needsLiveMaterial = false;
+  // geometry of each object, recorded the first time it becomes visible.
+  // materials are not part of it, so live (scrolling) materials and the de-duplication
+  // of 't3dState' across objects still work.
+  std::vector<rspq_block_t*> objBlocks{};
 }
 
 CulledModel::CulledModel(const char *modelPath)
 {
   layerObj.fill({});
   layerCount.fill(0);
-  currBlock.fill(nullptr);
-  currBlockIdx = 0;
-  needsUpdate = false;
+  objBlocks.clear();
 
   model = t3d_model_load(modelPath);
   auto it = t3d_model_iter_create(model, T3D_CHUNK_TYPE_OBJECT);
   while(t3d_model_iter_next(&it)) {
+    objBlocks.push_back(nullptr);
     auto mat = it.object->material;
     // nothing should use fog, and i may have it enabled to preview some t3d specific effects in fast64
     mat->fogMode = T3D_FOG_MODE_DISABLED;
@@ -81,9 +85,10 @@ CulledModel::~CulledModel() {
   free_uncached(mapMatFP);
 
   rspq_wait();
-  for(auto &block : currBlock) {
+  for(auto &block : objBlocks) {
     if(block)rspq_block_free(block);
   }
+  objBlocks.clear();
 }
 
 void CulledModel::update(const T3DVec3 &camPos) {
@@ -95,27 +100,18 @@ void CulledModel::update(const T3DVec3 &camPos) {
 
   // put all visible objects into layers, and set counters...
 
-  uint64_t newHash = 0;
   layerCount.fill(0);
+  uint32_t objIdx = 0;
   auto it = t3d_model_iter_create(model, T3D_CHUNK_TYPE_OBJECT);
   while(t3d_model_iter_next(&it)) {
     if(it.object->isVisible) {
       uint8_t layerId = it.object->_padding[0];
-      layerObj[layerId][layerCount[layerId]++] = it.object;
+      layerObj[layerId][layerCount[layerId]++] = {it.object, objIdx};
       it.object->isVisible = false;
-
-      if(it.object->material->name[0] == '#') {
-        needsLiveMaterial = true;
-      }
-
-      newHash ^= ((uint64_t)(void*)(it.object)) | ((uint64_t)it.object->triCount << 32);
-      newHash = std::rotl(newHash, 10);
     }
+    ++objIdx;
   }
 
-  needsUpdate = (newHash != lastHash) || needsLiveMaterial;
-  lastHash = newHash;
-
   scrollOffset = camPos.x*2;
   scrollOffset = fm_fmodf(scrollOffset, 128.0f);
 }
@@ -125,46 +121,34 @@ uint32_t CulledModel::draw(T3DModelState &t3dState) {
 
   auto ticks = get_ticks();
 
-  if(needsUpdate)
-  {
-    if(!needsLiveMaterial) {
-      currBlockIdx = (currBlockIdx + 1) & 3;
-      if(currBlock[currBlockIdx])rspq_block_free(currBlock[currBlockIdx]);
-      rspq_block_begin();
-    }
+  t3d_matrix_set(mapMatFP, true);
+
+  // draw in one go in order, only objects that just became visible for the first time need recording
+  //debugf("==== Draw Layer:\n");
+  for(uint32_t i = 0; i < LAYER_COUNT; ++i) {
+    //debugf("  - Layer %ld\n", i);
+    for(uint32_t j = 0; j < layerCount[i]; ++j) {
+      auto obj = layerObj[i][j].obj;
+      auto &block = objBlocks[layerObj[i][j].objIdx];
+      //debugf("    - Obj %s\n", obj->name);
+      if(obj->material->name[0] == '#') {
+        obj->material->textureB.s.low = scrollOffset;
+        obj->material->textureB.t.low = scrollOffset;
+      }
+      t3d_model_draw_material(obj->material, &t3dState);
 
-    t3d_matrix_set(mapMatFP, true);
-
-    // ...then draw in one go in order
-    //debugf("==== Draw Layer:\n");
-    for(uint32_t i = 0; i < LAYER_COUNT; ++i) {
-      //debugf("  - Layer %ld\n", i);
-      for(uint32_t j = 0; j < layerCount[i]; ++j) {
-        auto obj = layerObj[i][j];
-        //debugf("    - Obj %s\n", obj->name);
-        if(obj->material->name[0] == '#') {
-          obj->material->textureB.s.low = scrollOffset;
-          obj->material->textureB.t.low = scrollOffset;
-        }
-        t3d_model_draw_material(obj->material, &t3dState);
+      if(!block) {
+        rspq_block_begin();
         t3d_model_draw_object(obj, nullptr);
-        triCount += obj->triCount;
+        block = rspq_block_end();
       }
-    }
-
-    t3d_state_set_vertex_fx(T3D_VERTEX_FX_NONE, 0, 0);
-
-    if(!needsLiveMaterial) {
-      currBlock[currBlockIdx] = rspq_block_end();
+      rspq_block_run(block);
+      triCount += obj->triCount;
     }
   }
 
-  if(!needsLiveMaterial) {
-    rspq_block_run(currBlock[currBlockIdx]);
-  }
+  t3d_state_set_vertex_fx(T3D_VERTEX_FX_NONE, 0, 0);
 
-  needsUpdate = false;
-  needsLiveMaterial = false;
   ticks = get_ticks() - ticks;
   //debugf(" - Draw time: %lld\n", TICKS_TO_US(ticks));
   return triCount;
@@ -39,5 +39,6 @@ void Scene::loadScene(const char* path)
       default: spawnActor(actor->type, pos, actor->param); break;
     }
   }
+  navPoints.build();
   free(scene);
 }
\ No newline at end of file
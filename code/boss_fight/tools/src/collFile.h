@@ -0,0 +1,136 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bit.h"
+#include "../../collision/mesh.h"
+#include "../../collision/bvh.h"
+
+/**
+ * Host-side loader for '.coll' files written by 'gltf_to_coll'.
+ * The runtime maps the file directly into a 'Coll::Mesh', which doesn't work here
+ * since the file is big-endian and pointers are 64bit on the host.
+ * So this re-creates the same in-memory layout instead.
+ */
+class CollFile
+{
+  private:
+    std::vector<uint8_t> fileData{};
+    uint32_t pos{0};
+
+    std::vector<T3DVec3> verts{};
+    std::vector<Coll::IVec3> normals{};
+    std::vector<uint16_t> bvhData{};
+    std::vector<Coll::TriData> triData{};
+
+    template<typename T>
+    T read() {
+      if(pos + sizeof(T) > fileData.size()) {
+        throw std::runtime_error("Unexpected end of .coll file!");
+      }
+      T val;
+      memcpy(&val, &fileData[pos], sizeof(T));
+      pos += sizeof(T);
+      return Bit::byteswap(val);
+    }
+
+    float readFloat() {
+      return Bit::bit_cast<float>(read<uint32_t>());
+    }
+
+    void align(uint32_t alignment) {
+      pos = (pos + alignment - 1) & ~(alignment - 1);
+    }
+
+  public:
+    Coll::Mesh *mesh{nullptr};
+    uint32_t bvhOffset{0}; // file offset of the BVH, to reproduce its alignment in memory
+
+    explicit CollFile(const char* path)
+    {
+      FILE* file = fopen(path, "rb");
+      if(!file)throw std::runtime_error(std::string("File not found: ") + path);
+      fseek(file, 0, SEEK_END);
+      fileData.resize(ftell(file));
+      fseek(file, 0, SEEK_SET);
+      fread(fileData.data(), 1, fileData.size(), file);
+      fclose(file);
+
+      uint32_t triCount = read<uint32_t>();
+      uint32_t vertCount = read<uint32_t>();
+      float collScale = readFloat();
+      pos += 3 * sizeof(uint32_t); // pointers, patched at runtime
+      bool hasTriData = read<uint32_t>() != 0;
+
+      mesh = (Coll::Mesh*)calloc(1, sizeof(Coll::Mesh) + triCount * 3 * sizeof(int16_t));
+      mesh->triCount = triCount;
+      mesh->vertCount = vertCount;
+      mesh->collScale = collScale;
+
+      for(uint32_t i=0; i<triCount*3; ++i) {
+        mesh->indices[i] = read<int16_t>();
+      }
+      align(4);
+
+      normals.resize(triCount);
+      for(auto &n : normals) {
+        for(auto &v : n.v)v = read<int16_t>();
+      }
+      align(4);
+
+      verts.resize(vertCount);
+      for(auto &v : verts) {
+        for(auto &f : v.v)f = readFloat();
+      }
+      align(4);
+
+      // the BVH only consists of 16bit values, so it can be swapped as a whole
+      bvhOffset = pos;
+      uint16_t nodeCount = read<uint16_t>();
+      uint16_t dataCount = read<uint16_t>();
+      uint16_t indexCount = dataCount & ~Coll::BVH_FLAG_SKIP_LAYOUT;
+      bvhData.resize(2 + nodeCount * (sizeof(Coll::BVHNode) / sizeof(int16_t)) + indexCount);
+      bvhData[0] = nodeCount;
+      bvhData[1] = dataCount;
+      for(size_t i=2; i<bvhData.size(); ++i) {
+        bvhData[i] = read<uint16_t>();
+      }
+      align(4);
+
+      if(hasTriData) {
+        triData.resize(triCount);
+        for(auto &tri : triData) {
+          tri.planeDist = readFloat();
+          for(auto &d : tri.edgeDist)d = readFloat();
+          for(auto &n : tri.edgeNormal) {
+            for(auto &v : n.v)v = read<int16_t>();
+          }
+          tri.padding = read<int16_t>();
+        }
+      }
+
+      mesh->normals = normals.data();
+      mesh->verts = verts.data();
+      mesh->bvh = (Coll::BVH*)bvhData.data();
+      mesh->triData = hasTriData ? triData.data() : nullptr;
+    }
+
+    CollFile(const CollFile&) = delete;
+    CollFile& operator=(const CollFile&) = delete;
+
+    ~CollFile() {
+      free(mesh);
+    }
+
+    [[nodiscard]] const Coll::BVH& getBVH() const {
+      return *mesh->bvh;
+    }
+};
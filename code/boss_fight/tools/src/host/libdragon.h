@@ -0,0 +1,34 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+
+// Minimal host stand-in for libdragon, only covering what the collision code needs.
+// This lets 'collision/*.cpp' be compiled as-is for the host benchmark tools.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+#define debugf(...) fprintf(stderr, __VA_ARGS__)
+#define assertf(expr, ...) do { if(!(expr)) { fprintf(stderr, __VA_ARGS__); abort(); } } while(0)
+
+typedef struct {
+  uint8_t r, g, b, a;
+} color_t;
+
+#define RGBA32(rx,gx,bx,ax) color_t{(uint8_t)(rx), (uint8_t)(gx), (uint8_t)(bx), (uint8_t)(ax)}
+
+inline uint64_t get_ticks() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()
+  ).count();
+}
+
+#define TICKS_TO_US(t) ((t) / 1000)
+
+inline float fm_sinf(float x) { return sinf(x); }
+inline float fm_cosf(float x) { return cosf(x); }
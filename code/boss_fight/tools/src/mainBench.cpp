@@ -0,0 +1,338 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#ifndef N64
+
+#include "collFile.h"
+#include "queryLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Host benchmark for the BVH in 'collision/bvh.cpp'.
+ * Replays a recorded (or generated) query stream against a '.coll' file and reports
+ * throughput, visited nodes and leaf-hit distributions.
+ * Sphere queries are also replayed as per-frame batches to compare against 'BVH::queryAABBs'.
+ * Node and data reads go through a simple model of the data-cache to compare BVH layouts.
+ * Multiple '.coll' files (e.g. with and without '--bvh-skip') can be passed to compare them on the same queries.
+ * Files with precomputed triangle planes ('--tri-planes') also compare both sphere-vs-triangle tests.
+ *
+ * Usage: bvh_bench <file.coll>... [query.log]
+ */
+
+namespace {
+  constexpr uint32_t SYNTHETIC_FRAMES = 2000;
+  constexpr uint32_t SYNTHETIC_SEED = 0x64;
+  constexpr uint32_t MIN_TIMED_QUERIES = 2'000'000;
+
+  // VR4300 data-cache: 8KB, direct-mapped, 16 byte lines
+  constexpr uint32_t DCACHE_SIZE = 8 * 1024;
+  constexpr uint32_t DCACHE_LINE_SIZE = 16;
+  constexpr uint32_t DCACHE_LINES = DCACHE_SIZE / DCACHE_LINE_SIZE;
+
+  using Clock = std::chrono::steady_clock;
+
+  struct DCache {
+    uintptr_t hostBase{};
+    uintptr_t base{};
+    uint32_t tags[DCACHE_LINES]{};
+    bool valid[DCACHE_LINES]{};
+    uint64_t misses{};
+
+    void reset() {
+      for(auto &v : valid)v = false;
+    }
+
+    void fetch(const void* ptr, uint32_t size) {
+      uintptr_t addr = (uintptr_t)ptr - hostBase + base;
+      for(uintptr_t line = addr / DCACHE_LINE_SIZE; line <= (addr + size - 1) / DCACHE_LINE_SIZE; ++line) {
+        uint32_t idx = line % DCACHE_LINES;
+        if(!valid[idx] || tags[idx] != line) {
+          valid[idx] = true;
+          tags[idx] = line;
+          ++misses;
+        }
+      }
+    }
+  };
+
+  DCache dcache{};
+
+  struct Stats {
+    uint64_t queries{};
+    uint64_t nodes{};
+    uint64_t leaves{};
+    uint64_t tris{};
+    uint64_t overLimit{};
+    uint64_t trisDropped{};
+    uint64_t cacheMisses{};
+    uint32_t maxNodes{};
+    std::map<uint32_t, uint32_t> leafHistogram{};
+    double timeSec{};
+
+    void add(const Coll::BVHResultList &res, uint64_t misses) {
+      uint32_t count = res.triIndex.size();
+      ++queries;
+      cacheMisses += misses;
+      nodes += Coll::bvhStats.nodesVisited;
+      leaves += Coll::bvhStats.leavesHit;
+      tris += count;
+      if(count > Coll::MAX_RESULT_COUNT) {
+        ++overLimit;
+        trisDropped += count - Coll::MAX_RESULT_COUNT;
+      }
+      maxNodes = std::max(maxNodes, Coll::bvhStats.nodesVisited);
+      // bucket by powers of two: 0, 1, 2-3, 4-7, ...
+      uint32_t bucket = 0;
+      while((1u << bucket) <= Coll::bvhStats.leavesHit)++bucket;
+      ++leafHistogram[bucket];
+    }
+
+    void print(const char* name) const {
+      if(queries == 0)return;
+      double q = (double)queries;
+      printf("[%s]\n", name);
+      printf("  Queries       : %lu\n", queries);
+      printf("  Queries/sec   : %.0f\n", timeSec > 0.0 ? q / timeSec : 0.0);
+      printf("  ns/query      : %.1f\n", timeSec * 1e9 / q);
+      printf("  Nodes/query   : %.2f (max: %u)\n", nodes / q, maxNodes);
+      printf("  Leaves/query  : %.2f\n", leaves / q);
+      printf("  D$ lines/query: %.2f\n", cacheMisses / q);
+      printf("  Tris/query    : %.2f\n", tris / q);
+      printf("  Over %d tris  : %lu (%.2f%%), %lu tris a 'BVHResult' would drop\n",
+        Coll::MAX_RESULT_COUNT, overLimit, overLimit * 100.0 / q, trisDropped
+      );
+      printf("  Leaf hits     :\n");
+      for(auto &[bucket, count] : leafHistogram) {
+        uint32_t min = bucket == 0 ? 0 : (1u << (bucket-1));
+        uint32_t max = bucket == 0 ? 0 : (1u << bucket) - 1;
+        printf("    %3u-%-3u : %6u (%5.2f%%)\n", min, max, count, count * 100.0 / q);
+      }
+    }
+  };
+
+  Coll::IVec3 toBVHSpace(const T3DVec3 &pos) {
+    // same conversion as 'Coll::Scene::raycastFloor'
+    return {{
+      (int16_t)(pos.v[0] * 64.0f),
+      (int16_t)(pos.v[1] * 64.0f),
+      (int16_t)(pos.v[2] * 64.0f)
+    }};
+  }
+
+  void runQuery(const Coll::BVH &bvh, const QueryLog::Query &q, Coll::BVHResultList &res) {
+    res.reset();
+    if(q.type == QueryLog::Type::SPHERE) {
+      bvh.vsSphere(q.sphere, res);
+    } else {
+      bvh.raycastFloor(toBVHSpace(q.sphere.center), res);
+    }
+  }
+
+  double timeQueries(const Coll::BVH &bvh, const std::vector<QueryLog::Query> &queries) {
+    if(queries.empty())return 0.0;
+    uint32_t repeat = std::max<uint32_t>(1, MIN_TIMED_QUERIES / queries.size());
+
+    Coll::BVHResultList res{};
+    uint64_t checksum = 0;
+    auto start = Clock::now();
+    for(uint32_t r=0; r<repeat; ++r) {
+      for(const auto &q : queries) {
+        runQuery(bvh, q, res);
+        checksum += res.triIndex.size();
+      }
+    }
+    double time = std::chrono::duration<double>(Clock::now() - start).count();
+    if(checksum == 0xFFFF'FFFF'FFFF'FFFF)printf(" "); // keep the loop alive
+    return time / repeat;
+  }
+
+  // splits the sphere queries into per-frame batches of boxes, as 'Coll::Scene::queryBatch' would see them
+  std::vector<std::vector<Coll::AABB>> createBatches(const std::vector<QueryLog::Query> &queries) {
+    std::vector<std::vector<Coll::AABB>> res{};
+    res.emplace_back();
+    for(const auto &q : queries) {
+      if(q.type == QueryLog::Type::FRAME && !res.back().empty())res.emplace_back();
+      if(q.type != QueryLog::Type::SPHERE)continue;
+      if(res.back().size() == Coll::MAX_BATCH_SIZE)res.emplace_back();
+      res.back().push_back((q.sphere * 64.0f).toAABB());
+    }
+    return res;
+  }
+
+  uint64_t runBatch(const Coll::BVH &bvh, const std::vector<Coll::AABB> &batch, std::vector<Coll::BVHResultList> &res) {
+    uint64_t tris = 0;
+    for(auto &r : res)r.reset();
+    bvh.queryAABBs(batch.data(), batch.size(), [&](uint32_t i, int16_t triIndex) {
+      res[i].triIndex.push_back(triIndex);
+      ++tris;
+    });
+    return tris;
+  }
+
+  void benchBatched(const Coll::BVH &bvh, const std::vector<QueryLog::Query> &queries, const Stats &statsSingle) {
+    auto batches = createBatches(queries);
+    std::vector<Coll::BVHResultList> res(Coll::MAX_BATCH_SIZE);
+
+    uint64_t tris = 0;
+    Coll::bvhStats.reset();
+    Coll::bvhStats.onFetch = [](const void *ptr, uint32_t size) { dcache.fetch(ptr, size); };
+    dcache.misses = 0;
+    for(const auto &batch : batches) {
+      dcache.reset();
+      tris += runBatch(bvh, batch, res);
+    }
+    Coll::bvhStats.onFetch = nullptr;
+    auto stats = Coll::bvhStats;
+
+    uint32_t repeat = std::max<uint64_t>(1, MIN_TIMED_QUERIES / std::max<uint64_t>(1, statsSingle.queries));
+    auto start = Clock::now();
+    for(uint32_t r=0; r<repeat; ++r) {
+      for(const auto &batch : batches)runBatch(bvh, batch, res);
+    }
+    double timeSec = std::chrono::duration<double>(Clock::now() - start).count() / repeat;
+
+    double q = (double)statsSingle.queries;
+    printf("[vsSphere batched]\n");
+    printf("  Batches       : %lu (%.2f spheres/batch)\n", batches.size(), q / batches.size());
+    printf("  ns/query      : %.1f (%.2fx)\n", timeSec * 1e9 / q, statsSingle.timeSec / timeSec);
+    printf("  Nodes/query   : %.2f (%.2fx fewer)\n", stats.nodesVisited / q, statsSingle.nodes / (double)stats.nodesVisited);
+    printf("  D$ lines/query: %.2f (cold per batch)\n", dcache.misses / q);
+    printf("  Tris/query    : %.2f (%s)\n", tris / q, tris == statsSingle.tris ? "matches" : "MISMATCH");
+  }
+
+  bool collInfoMatches(const Coll::CollInfo &a, const Coll::CollInfo &b) {
+    constexpr float EPSILON = 0.001f;
+    if(a.collCount != b.collCount)return false;
+    if(a.collCount == 0)return true;
+    for(int i=0; i<3; ++i) {
+      if(fabsf(a.hitPos.v[i] - b.hitPos.v[i]) > EPSILON)return false;
+      if(fabsf(a.penetration.v[i] - b.penetration.v[i]) > EPSILON)return false;
+    }
+    return true;
+  }
+
+  // runs the narrowphase on all BVH candidates of each sphere, once per triangle format
+  void benchNarrowphase(const Coll::Mesh &mesh, const std::vector<QueryLog::Query> &sphereQueries)
+  {
+    std::vector<std::pair<Coll::Sphere, int16_t>> pairs{};
+    Coll::BVHResultList res{};
+    for(const auto &q : sphereQueries) {
+      res.reset();
+      mesh.bvh->vsSphere(q.sphere * 64.0f, res);
+      for(auto t : res.triIndex)pairs.emplace_back(q.sphere, t);
+    }
+    if(pairs.empty())return;
+
+    uint32_t hits = 0, mismatches = 0;
+    for(auto &[sphere, t] : pairs) {
+      auto infoTri = mesh.vsSphere(sphere, mesh.getTriangle(t));
+      auto infoData = mesh.vsSphereTriData(sphere, t);
+      hits += infoTri.collCount;
+      if(!collInfoMatches(infoTri, infoData))++mismatches;
+    }
+
+    auto timePairs = [&](auto &&test) {
+      uint32_t repeat = std::max<uint32_t>(1, MIN_TIMED_QUERIES / pairs.size());
+      int checksum = 0;
+      auto start = Clock::now();
+      for(uint32_t r=0; r<repeat; ++r) {
+        for(auto &[sphere, t] : pairs)checksum += test(sphere, t).collCount;
+      }
+      double time = std::chrono::duration<double>(Clock::now() - start).count();
+      if(checksum == -1)printf(" "); // keep the loop alive
+      return time * 1e9 / repeat / pairs.size();
+    };
+    double nsTri = timePairs([&](const Coll::Sphere &s, int16_t t) { return mesh.vsSphere(s, mesh.getTriangle(t)); });
+    double nsData = timePairs([&](const Coll::Sphere &s, int16_t t) { return mesh.vsSphereTriData(s, t); });
+
+    printf("[vsSphere narrowphase]\n");
+    printf("  Sphere/tri    : %lu (%u hits)\n", pairs.size(), hits);
+    printf("  ns/tri        : %.1f (indexed), %.1f (tri-planes, %.2fx)\n", nsTri, nsData, nsTri / nsData);
+    printf("  Results       : %s (%u mismatches)\n", mismatches == 0 ? "matches" : "MISMATCH", mismatches);
+  }
+
+  void benchMesh(const CollFile &coll, const std::vector<QueryLog::Query> &queries)
+  {
+    const auto &bvh = coll.getBVH();
+    dcache.hostBase = (uintptr_t)&bvh;
+    dcache.base = coll.bvhOffset;
+
+    std::vector<QueryLog::Query> sphereQueries{};
+    std::vector<QueryLog::Query> rayQueries{};
+    for(const auto &q : queries) {
+      if(q.type == QueryLog::Type::SPHERE)sphereQueries.push_back(q);
+      if(q.type == QueryLog::Type::RAY)rayQueries.push_back(q);
+    }
+
+    // stats pass, the cache starts cold for each query so misses equal the cache-lines touched
+    Stats statsSphere{}, statsRay{};
+    Coll::BVHResultList res{};
+    Coll::bvhStats.onFetch = [](const void *ptr, uint32_t size) { dcache.fetch(ptr, size); };
+    for(const auto &q : queries) {
+      if(q.type == QueryLog::Type::FRAME)continue;
+      Coll::bvhStats.reset();
+      dcache.reset();
+      uint64_t missesStart = dcache.misses;
+      runQuery(bvh, q, res);
+      (q.type == QueryLog::Type::SPHERE ? statsSphere : statsRay).add(res, dcache.misses - missesStart);
+    }
+    Coll::bvhStats.onFetch = nullptr;
+
+    statsSphere.timeSec = timeQueries(bvh, sphereQueries);
+    statsRay.timeSec = timeQueries(bvh, rayQueries);
+
+    statsSphere.print("vsSphere");
+    benchBatched(bvh, queries, statsSphere);
+    if(coll.mesh->triData)benchNarrowphase(*coll.mesh, sphereQueries);
+    statsRay.print("raycastFloor");
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if(argc < 2) {
+    printf("Usage: %s <file.coll>... [query.log]\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<const char*> collPaths{};
+  const char* logPath = nullptr;
+  for(int i=1; i<argc; ++i) {
+    if(std::string(argv[i]).ends_with(".coll")) {
+      collPaths.push_back(argv[i]);
+    } else {
+      logPath = argv[i];
+    }
+  }
+
+  std::vector<QueryLog::Query> queries{};
+  for(auto path : collPaths)
+  {
+    CollFile coll{path};
+    const auto &bvh = coll.getBVH();
+    printf("==== %s ====\n", path);
+    printf("Mesh: %u tris, %u verts, BVH: %u nodes, %u indices, %s layout%s\n",
+      coll.mesh->triCount, coll.mesh->vertCount, bvh.nodeCount, bvh.getDataCount(),
+      bvh.isSkipLayout() ? "skip" : "default", coll.mesh->triData ? ", tri-planes" : ""
+    );
+
+    // synthetic queries only depend on the triangles, so all files see the same stream
+    if(queries.empty()) {
+      queries = logPath
+        ? QueryLog::load(logPath)
+        : QueryLog::createSynthetic(*coll.mesh, SYNTHETIC_FRAMES, SYNTHETIC_SEED);
+    }
+
+    benchMesh(coll, queries);
+    printf("\n");
+  }
+  return 0;
+}
+
+#endif
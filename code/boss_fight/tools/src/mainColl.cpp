@@ -22,7 +22,8 @@ namespace {
 
 std::vector<int16_t> createMeshBVH(
   const std::vector<IVec3> &vertices,
-  const std::vector<uint16_t> &indices
+  const std::vector<uint16_t> &indices,
+  bool skipLayout
 );
 
 namespace fs = std::filesystem;
@@ -65,6 +66,12 @@ int main(int argc, char** argv)
 {
   const char* gltfPath = argv[1];
   const char* collPath = argv[2];
+  bool bvhSkipLayout = false;
+  bool triPlanes = false;
+  for(int i=3; i<argc; ++i) {
+    if(std::string(argv[i]) == "--bvh-skip")bvhSkipLayout = true;
+    if(std::string(argv[i]) == "--tri-planes")triPlanes = true;
+  }
   fs::path gltfBasePath{argv[1]};
   gltfBasePath = gltfBasePath.parent_path();
 
@@ -174,7 +181,7 @@ int main(int argc, char** argv)
 
   printf("Vert/Index count: %d %d\n", vertices.size(), indices.size());
 
-  auto bvh = createMeshBVH(vertices, indices);
+  auto bvh = createMeshBVH(vertices, indices, bvhSkipLayout);
 
   BinaryFile file{};
   file.write<uint32_t>(indices.size() / 3);
@@ -183,6 +190,7 @@ int main(int argc, char** argv)
   file.write<uint32_t>(0); // vertex pointer
   file.write<uint32_t>(0); // normals pointer
   file.write<uint32_t>(0); // BVH pointer
+  file.write<uint32_t>(triPlanes ? 1 : 0); // tri-data pointer
 
   file.writeArray(indices.data(), indices.size());
   file.align(4);
@@ -200,6 +208,54 @@ int main(int argc, char** argv)
   file.writeArray(bvh.data(), bvh.size());
   file.align(4);
 
+  // precomputed planes per triangle, see 'Coll::TriData'
+  if(triPlanes) {
+    for(int t=0; t<indices.size()/3; ++t)
+    {
+      const Vec3 v[3]{
+        verticesFloat[indices[t*3]],
+        verticesFloat[indices[t*3+1]],
+        verticesFloat[indices[t*3+2]]
+      };
+      // use the quantized normal, so results match the normal-only path
+      Vec3 normal{
+        normals[t].pos[0] / 32767.0f,
+        normals[t].pos[1] / 32767.0f,
+        normals[t].pos[2] / 32767.0f
+      };
+
+      // edge normals are quantized too, distances are taken from the quantized normals
+      IVec3 edgeNormal[3]{};
+      float edgeDist[3]{};
+      // triangles with collapsed vertices have no normal, the barycentric test never
+      // treats a point as inside those, so write planes that contain nothing
+      bool hasNormal = normals[t].pos[0] != 0 || normals[t].pos[1] != 0 || normals[t].pos[2] != 0;
+      for(int e=0; e<3; ++e) {
+        if(!hasNormal) {
+          edgeDist[e] = -1.0f;
+          continue;
+        }
+        Vec3 n = (v[(e+1) % 3] - v[e]).cross(normal).normalize();
+        edgeNormal[e] = {
+          (int16_t)(n[0] * 32767.0f),
+          (int16_t)(n[1] * 32767.0f),
+          (int16_t)(n[2] * 32767.0f)
+        };
+        n = {
+          edgeNormal[e].pos[0] / 32767.0f,
+          edgeNormal[e].pos[1] / 32767.0f,
+          edgeNormal[e].pos[2] / 32767.0f
+        };
+        edgeDist[e] = n.dot(v[e]);
+      }
+
+      file.write<float>(normal.dot(v[0]));
+      file.writeArray(edgeDist, 3);
+      for(auto &n : edgeNormal)file.writeArray(n.pos, 3);
+      file.write<int16_t>(0); // padding
+    }
+  }
+
   file.writeToFile(collPath);
 }
 
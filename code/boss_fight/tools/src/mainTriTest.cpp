@@ -0,0 +1,138 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#ifndef N64
+
+#include "collFile.h"
+
+#include <algorithm>
+#include <random>
+
+/**
+ * Host check for the precomputed triangle planes ('gltf_to_coll --tri-planes').
+ * Places spheres around every triangle of a '.coll' file, inside and outside its edges,
+ * in front and behind its face, and compares 'Mesh::vsSphereTriData' against 'Mesh::vsSphere'.
+ * Both tests round differently, so spheres sitting right on one of their decisions (an edge,
+ * or a face distance equal to the radius) may go either way and are only counted.
+ * Exits with an error on any other mismatch.
+ *
+ * Usage: coll_tri_test <file.coll> [spheres per triangle] [seed]
+ */
+
+namespace {
+  constexpr uint32_t DEFAULT_SPHERES_PER_TRI = 512;
+  constexpr uint32_t DEFAULT_SEED = 0x64;
+  constexpr uint32_t MAX_PRINTED_MISMATCHES = 8;
+  constexpr float EPSILON = 0.001f;
+  constexpr float BOUNDARY_EPSILON = 0.0001f; // relative to the triangle size
+
+  bool collInfoMatches(const Coll::CollInfo &a, const Coll::CollInfo &b) {
+    if(a.collCount != b.collCount)return false;
+    if(a.collCount == 0)return true;
+    for(int i=0; i<3; ++i) {
+      if(fabsf(a.hitPos.v[i] - b.hitPos.v[i]) > EPSILON)return false;
+      if(fabsf(a.penetration.v[i] - b.penetration.v[i]) > EPSILON)return false;
+      if(fabsf(a.normal.v[i] - b.normal.v[i]) > EPSILON)return false;
+    }
+    return true;
+  }
+
+  T3DVec3 cross(const T3DVec3 &a, const T3DVec3 &b) {
+    return {{
+      a.v[1] * b.v[2] - a.v[2] * b.v[1],
+      a.v[2] * b.v[0] - a.v[0] * b.v[2],
+      a.v[0] * b.v[1] - a.v[1] * b.v[0]
+    }};
+  }
+
+  // distance to the closest input where the result of either test flips
+  float distanceToBoundary(const Coll::Triangle &face, const Coll::Sphere &sphere) {
+    if(t3d_vec3_len2(face.normal) == 0.0f)return INFINITY;
+
+    float planeDist = t3d_vec3_dot(sphere.center - *face.v[0], face.normal);
+    float res = fminf(fabsf(fabsf(planeDist) - sphere.radius), fabsf(fabsf(planeDist*2.0f) - sphere.radius));
+    for(int e=0; e<3; ++e) {
+      auto edgeNormal = cross(*face.v[(e+1) % 3] - *face.v[e], face.normal);
+      float edgeDist = t3d_vec3_dot(sphere.center - *face.v[e], edgeNormal) / t3d_vec3_len(edgeNormal);
+      res = fminf(res, fabsf(edgeDist));
+    }
+    return res;
+  }
+
+  void printCollInfo(const char* name, const Coll::CollInfo &info) {
+    printf("  %-8s: count %d, pos %.4f %.4f %.4f, pen %.4f %.4f %.4f\n", name, info.collCount,
+      info.hitPos.v[0], info.hitPos.v[1], info.hitPos.v[2],
+      info.penetration.v[0], info.penetration.v[1], info.penetration.v[2]
+    );
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if(argc < 2) {
+    printf("Usage: %s <file.coll> [spheres per triangle] [seed]\n", argv[0]);
+    return 1;
+  }
+
+  CollFile coll{argv[1]};
+  const auto &mesh = *coll.mesh;
+  if(!mesh.triData) {
+    printf("%s has no triangle planes, write it with 'gltf_to_coll --tri-planes'\n", argv[1]);
+    return 1;
+  }
+
+  uint32_t spheresPerTri = argc > 2 ? strtoul(argv[2], nullptr, 0) : DEFAULT_SPHERES_PER_TRI;
+  std::mt19937 rng{argc > 3 ? (uint32_t)strtoul(argv[3], nullptr, 0) : DEFAULT_SEED};
+  auto randRange = [&rng](float min, float max) {
+    return std::uniform_real_distribution<float>{min, max}(rng);
+  };
+
+  uint64_t spheres = 0, hits = 0, boundary = 0, mismatches = 0;
+  for(uint32_t t=0; t<mesh.triCount; ++t)
+  {
+    auto face = mesh.getTriangle(t);
+    const auto &v0 = *face.v[0];
+    const auto &v1 = *face.v[1];
+    const auto &v2 = *face.v[2];
+    float size = sqrtf(std::max({
+      t3d_vec3_distance2(&v0, &v1), t3d_vec3_distance2(&v1, &v2), t3d_vec3_distance2(&v2, &v0)
+    }));
+
+    for(uint32_t s=0; s<spheresPerTri; ++s)
+    {
+      // barycentric coordinates past 0 and 1 put the center outside the edges and corners
+      float u = randRange(-0.25f, 1.25f);
+      float v = randRange(-0.25f, 1.25f);
+      Coll::Sphere sphere{};
+      sphere.radius = size * randRange(0.02f, 0.5f);
+      sphere.center = v0 * (1.0f - u - v) + v1 * u + v2 * v
+        + face.normal * (sphere.radius * randRange(-1.5f, 1.5f));
+
+      auto infoTri = mesh.vsSphere(sphere, face);
+      auto infoData = mesh.vsSphereTriData(sphere, t);
+      ++spheres;
+      hits += infoTri.collCount;
+      if(collInfoMatches(infoTri, infoData))continue;
+      if(distanceToBoundary(face, sphere) < BOUNDARY_EPSILON * size) {
+        ++boundary;
+        continue;
+      }
+
+      if(++mismatches <= MAX_PRINTED_MISMATCHES) {
+        printf("Mismatch on triangle %u, sphere %.4f %.4f %.4f r=%.4f\n", t,
+          sphere.center.v[0], sphere.center.v[1], sphere.center.v[2], sphere.radius
+        );
+        printCollInfo("indexed", infoTri);
+        printCollInfo("planes", infoData);
+      }
+    }
+  }
+
+  printf("%u triangles, %lu spheres, %lu hits, %lu on a boundary, %lu mismatches\n",
+    mesh.triCount, spheres, hits, boundary, mismatches
+  );
+  return mismatches == 0 ? 0 : 1;
+}
+
+#endif
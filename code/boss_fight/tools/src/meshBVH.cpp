@@ -21,7 +21,9 @@ using Bvh     = bvh::v2::Bvh<Node>;
 
 namespace
 {
-  void writeBVHNode(std::vector<int16_t> &out, Node &node, int nodeIndex) {
+  constexpr uint16_t FLAG_SKIP_LAYOUT = 0x8000; // see 'Coll::BVH_FLAG_SKIP_LAYOUT' in 'collision/bvh.h'
+
+  void writeBVHNodeBounds(std::vector<int16_t> &out, const Node &node) {
     // 'bounds' layout is [min_x, max_x, min_y, max_y, min_z, max_z]
     // we need min/max as separate vectors
     int16_t offset = 1;
@@ -47,6 +49,10 @@ namespace
 
     for(auto p : min.pos)out.push_back(p);
     for(auto p : max.pos)out.push_back(p);
+  }
+
+  void writeBVHNode(std::vector<int16_t> &out, Node &node, int nodeIndex) {
+    writeBVHNodeBounds(out, node);
 
     int dataCount = node.index.value & 0b1111;
     int dataOffset = node.index.value >> 4;
@@ -77,16 +83,76 @@ namespace
       out.push_back(prim_id);
     }
   }
+
+  void collectDepthFirst(const Bvh &bvh, uint32_t nodeIndex, std::vector<uint32_t> &order) {
+    order.push_back(nodeIndex);
+    const auto &node = bvh.nodes[nodeIndex];
+    if(node.is_leaf())return;
+    collectDepthFirst(bvh, node.index.first_id(), order);
+    collectDepthFirst(bvh, node.index.first_id() + 1, order);
+  }
+
+  /**
+   * Depth-first (pre-order) layout: the first child of an inner node directly follows it,
+   * and inner nodes store the offset to the node after their subtree ('skip') instead of a child offset.
+   * Leaf data is re-ordered to match, so traversal only ever walks forward through both arrays.
+   */
+  void writeBVHSkip(std::vector<int16_t> &out, Bvh &bvh) {
+    std::vector<uint32_t> order{};
+    collectDepthFirst(bvh, 0, order);
+
+    // subtree sizes, computed back-to-front since children always come after their parent
+    std::vector<uint32_t> posInOrder(bvh.nodes.size());
+    for(uint32_t i=0; i<order.size(); ++i)posInOrder[order[i]] = i;
+
+    std::vector<uint32_t> subtreeSize(order.size(), 1);
+    for(int i=(int)order.size()-1; i>=0; --i) {
+      const auto &node = bvh.nodes[order[i]];
+      if(node.is_leaf())continue;
+      subtreeSize[i] += subtreeSize[posInOrder[node.index.first_id()]];
+      subtreeSize[i] += subtreeSize[posInOrder[node.index.first_id() + 1]];
+    }
+
+    out.push_back(order.size());
+    out.push_back(bvh.prim_ids.size() | FLAG_SKIP_LAYOUT);
+
+    std::vector<int16_t> data{};
+    for(uint32_t i=0; i<order.size(); ++i)
+    {
+      const auto &node = bvh.nodes[order[i]];
+      writeBVHNodeBounds(out, node);
+
+      uint32_t value = subtreeSize[i];
+      uint32_t dataCount = node.index.prim_count();
+      if(dataCount) {
+        value = data.size();
+        for(uint32_t p=0; p<dataCount; ++p) {
+          data.push_back(bvh.prim_ids[node.index.first_id() + p]);
+        }
+      }
+
+      if(value > 0xFFF) {
+        printf("Error: skip/data offset %d does not fit in 12 bits\n", value);
+        throw;
+      }
+      out.push_back((int16_t)((value << 4) | dataCount));
+    }
+
+    for(auto d : data)out.push_back(d);
+  }
 }
 
 /**
  * Creates a BVH of all object AABBs
  * The result is a list of 16bit ints encoding both nodes, indices and AABB extends
- * @param modelChunks
+ * @param vertices
+ * @param indices
+ * @param skipLayout use the depth-first layout with skip offsets instead of the builders order
  */
 std::vector<int16_t> createMeshBVH(
   const std::vector<IVec3> &vertices,
-  const std::vector<uint16_t> &indices
+  const std::vector<uint16_t> &indices,
+  bool skipLayout
 ) {
   std::vector<BBox> aabbs;
   std::vector<BVec3> centers;
@@ -110,7 +176,11 @@ std::vector<int16_t> createMeshBVH(
   auto bvh = bvh::v2::DefaultBuilder<Node>::build(thread_pool, aabbs, centers, config);
 
   std::vector<int16_t> treeData;
-  writeBVH(treeData, bvh);
+  if(skipLayout) {
+    writeBVHSkip(treeData, bvh);
+  } else {
+    writeBVH(treeData, bvh);
+  }
   return treeData;
 }
 
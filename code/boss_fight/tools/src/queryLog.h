@@ -0,0 +1,113 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../collision/mesh.h"
+
+/**
+ * Collision query stream, either recorded on hardware/emulator or generated.
+ * Recordings are the '@coll ...' lines from the log, see 'RECORD_QUERIES' in 'collision/scene.cpp'.
+ * Positions are in mesh-local space (not scaled to BVH units yet).
+ */
+namespace QueryLog
+{
+  enum class Type : uint8_t {
+    FRAME,  // '@coll F' - start of a 'Coll::Scene::update()'
+    SPHERE, // '@coll S x y z radius'
+    RAY,    // '@coll R x y z'
+  };
+
+  struct Query {
+    Type type{};
+    Coll::Sphere sphere{};
+  };
+
+  inline std::vector<Query> load(const char* path)
+  {
+    FILE* file = fopen(path, "r");
+    if(!file)throw std::runtime_error(std::string("File not found: ") + path);
+
+    std::vector<Query> res{};
+    char line[256];
+    while(fgets(line, sizeof(line), file))
+    {
+      // recordings come from the debug log, so there may be other output in between
+      const char* cmd = strstr(line, "@coll ");
+      if(!cmd)continue;
+      cmd += 6;
+
+      Query q{};
+      auto &c = q.sphere.center.v;
+      switch(cmd[0]) {
+        case 'F': q.type = Type::FRAME; break;
+        case 'S':
+          q.type = Type::SPHERE;
+          if(sscanf(cmd+1, "%f %f %f %f", &c[0], &c[1], &c[2], &q.sphere.radius) != 4)continue;
+        break;
+        case 'R':
+          q.type = Type::RAY;
+          if(sscanf(cmd+1, "%f %f %f", &c[0], &c[1], &c[2]) != 3)continue;
+        break;
+        default: continue;
+      }
+      res.push_back(q);
+    }
+
+    fclose(file);
+    return res;
+  }
+
+  /**
+   * Generates a stream with the given amount of frames, each containing clusters of spheres
+   * and a floor raycast placed above random triangles of the mesh.
+   * This roughly mimics actors grouping around players in game.
+   */
+  inline std::vector<Query> createSynthetic(const Coll::Mesh &mesh, uint32_t frames, uint32_t seed)
+  {
+    constexpr int CLUSTER_COUNT = 4;
+    constexpr int SPHERES_PER_CLUSTER = 8;
+    constexpr float CLUSTER_SIZE = 4.0f;
+
+    std::mt19937 rng{seed};
+    auto randRange = [&rng](float min, float max) {
+      return std::uniform_real_distribution<float>{min, max}(rng);
+    };
+
+    std::vector<Query> res{};
+    for(uint32_t f=0; f<frames; ++f)
+    {
+      res.push_back({Type::FRAME});
+      for(int c=0; c<CLUSTER_COUNT; ++c)
+      {
+        uint32_t tri = rng() % mesh.triCount;
+        T3DVec3 center = mesh.verts[mesh.indices[tri*3]] + T3DVec3{{0.0f, 1.0f, 0.0f}};
+
+        for(int s=0; s<SPHERES_PER_CLUSTER; ++s) {
+          Query q{Type::SPHERE};
+          q.sphere.center = center + T3DVec3{{
+            randRange(-CLUSTER_SIZE, CLUSTER_SIZE),
+            randRange(-CLUSTER_SIZE * 0.25f, CLUSTER_SIZE * 0.25f),
+            randRange(-CLUSTER_SIZE, CLUSTER_SIZE)
+          }};
+          q.sphere.radius = randRange(0.25f, 2.0f);
+          res.push_back(q);
+        }
+
+        // same offset the AI uses when probing for floors
+        Query ray{Type::RAY};
+        ray.sphere.center = center + T3DVec3{{0.0f, 5.0f, 0.0f}};
+        res.push_back(ray);
+      }
+    }
+    return res;
+  }
+}
@@ -1,4 +1,6 @@
 #include "ai.h"
+#include "ai_search.h"
+#include "bitboard.h"
 #include "board.h"
 
 typedef struct
@@ -14,6 +16,9 @@ static size_t ai_move_index;
 static size_t ai_pieces[PIECE_COUNT];
 static size_t ai_piece_count;
 static size_t ai_piece_index;
+static BitMoveMasks ai_masks;
+static AiSearch ai_search;
+static bool ai_searching;
 
 static void
 ai_shuffle_pieces (size_t *array, size_t n)
@@ -68,7 +73,7 @@ ai_shuffle_pieces_easy (void)
  * Buckets the pieces into three groups: 5-4, 3-2, and 1.
  * Within each group, the pieces will be randomized;
  * Assumes the pieces are currently sorted by value descending.
- * Slightly stupider than the Hard shuffle, but still competent.
+ * Slightly stupider than the Hard AI, but still competent.
  */
 static void
 ai_shuffle_pieces_medium (void)
@@ -95,37 +100,6 @@ ai_shuffle_pieces_medium (void)
     }
 }
 
-/**
- * Shuffle the AI pieces for Hard difficulty.
- *
- * Randomize the pieces but keep their values in-order.
- * Assumes the pieces are currently sorted by value descending.
- * The optimal game strategy is to use the highest-value pieces first.
- */
-static void
-ai_shuffle_pieces_hard (void)
-{
-  if (ai_piece_count > 1)
-    {
-      size_t bucket_start = 0;
-      size_t bucket_size = 0;
-      int bucket_value = PIECES[ai_pieces[0]].value;
-      for (size_t i = 0; i < ai_piece_count; i++)
-        {
-          int piece_value = PIECES[ai_pieces[i]].value;
-          if (piece_value < bucket_value)
-            {
-              ai_shuffle_pieces (&ai_pieces[bucket_start], bucket_size);
-              bucket_start = i;
-              bucket_size = 0;
-              bucket_value = piece_value;
-            }
-          bucket_size++;
-        }
-      ai_shuffle_pieces (&ai_pieces[bucket_start], bucket_size);
-    }
-}
-
 static void
 ai_shuffle_moves (void)
 {
@@ -175,57 +149,26 @@ ai_gather_initial_moves (PlyNum p)
   ai_move_count = index;
 }
 
+/**
+ * Gather every tile the AI could grow into.
+ *
+ * These are the anchors of the move masks: unclaimed tiles diagonal to the
+ * player's own tiles that don't share a face with any of them.
+ */
 static void
-ai_gather_next_moves (PlyNum p)
+ai_gather_next_moves (void)
 {
   size_t move_index = 0;
-  for (size_t board_row = 0; board_row < BOARD_ROWS; board_row++)
+  for (int board_row = 0; board_row < BOARD_ROWS; board_row++)
     {
-      for (size_t board_col = 0; board_col < BOARD_COLS; board_col++)
+      BitRow anchors = ai_masks.anchors.rows[board_row];
+      while (anchors)
         {
-          if (board_is_tile_claimed (board_col, board_row, p))
-            {
-              // Is the cell to the top-left of this cell viable?
-              if (board_is_tile_valid (board_col - 1, board_row - 1)
-                  && !board_is_tile_claimed (board_col - 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row - 1, p)
-                  && board_is_tile_unclaimed (board_col - 1, board_row - 1))
-                {
-                  ai_moves[move_index].col = board_col - 1;
-                  ai_moves[move_index].row = board_row - 1;
-                  move_index++;
-                }
-              // Is the cell to the top-right of this cell viable?
-              if (board_is_tile_valid (board_col + 1, board_row - 1)
-                  && !board_is_tile_claimed (board_col + 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row - 1, p)
-                  && board_is_tile_unclaimed (board_col + 1, board_row - 1))
-                {
-                  ai_moves[move_index].col = board_col + 1;
-                  ai_moves[move_index].row = board_row - 1;
-                  move_index++;
-                }
-              // Is the cell to the bottom-left of this cell viable?
-              if (board_is_tile_valid (board_col - 1, board_row + 1)
-                  && !board_is_tile_claimed (board_col - 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row + 1, p)
-                  && board_is_tile_unclaimed (board_col - 1, board_row + 1))
-                {
-                  ai_moves[move_index].col = board_col - 1;
-                  ai_moves[move_index].row = board_row + 1;
-                  move_index++;
-                }
-              // Is the cell to the bottom-right of this cell viable?
-              if (board_is_tile_valid (board_col + 1, board_row + 1)
-                  && !board_is_tile_claimed (board_col + 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row + 1, p)
-                  && board_is_tile_unclaimed (board_col + 1, board_row + 1))
-                {
-                  ai_moves[move_index].col = board_col + 1;
-                  ai_moves[move_index].row = board_row + 1;
-                  move_index++;
-                }
-            }
+          int board_col = __builtin_ctz (anchors);
+          anchors &= anchors - 1;
+          ai_moves[move_index].col = board_col;
+          ai_moves[move_index].row = board_row;
+          move_index++;
         }
     }
   ai_move_count = move_index;
@@ -245,48 +188,42 @@ ai_gather_pieces (Player *player)
     }
 }
 
+static bool
+ai_place_orientation (Player *player, const PieceOrientation *orientation,
+                      int col, int row)
+{
+  memcpy (player->piece_buffer, orientation->cells,
+          sizeof (player->piece_buffer));
+  player_set_cursor (player, col - orientation->origin_col,
+                     row - orientation->origin_row);
+  return player_place_piece (player);
+}
+
 static bool
 ai_try_move (Player *player, const AiMove *loc)
 {
-  CheckPieceResult check_result;
+  size_t orientation_count;
+  const PieceOrientation *orientations
+      = bitboard_get_orientations (player->piece_index, &orientation_count);
 
-  // Randomly flip and mirror the piece for variety
-  if (rand () % 2)
-    {
-      player_flip_piece (player);
-    }
-  if (rand () % 2)
-    {
-      player_mirror_piece (player);
-    }
+  // Start from a random orientation for variety
+  size_t first = rand () % orientation_count;
 
-  for (size_t orientation = 0; orientation < 4; orientation++)
+  for (size_t i = 0; i < orientation_count; i++)
     {
-      if (orientation == 1)
-        {
-          player_mirror_piece (player);
-        }
-      if (orientation == 2)
-        {
-          player_flip_piece (player);
-        }
-      if (orientation == 3)
-        {
-          player_mirror_piece (player);
-        }
+      const PieceOrientation *orientation
+          = &orientations[(first + i) % orientation_count];
 
-      for (ssize_t offset_y = -PIECE_ROWS; offset_y <= PIECE_ROWS; offset_y++)
+      // Same search window as moving the cursor around the candidate tile
+      for (int offset_y = -PIECE_ROWS; offset_y <= PIECE_ROWS; offset_y++)
         {
-          for (ssize_t offset_x = -PIECE_COLS; offset_x <= PIECE_COLS;
-               offset_x++)
+          for (int offset_x = -PIECE_COLS; offset_x <= PIECE_COLS; offset_x++)
             {
-              player_set_cursor (player, loc->col + offset_x,
-                                 loc->row + offset_y);
-              check_result = board_check_piece (player);
-              if (check_result.is_valid)
+              int col = loc->col + offset_x + orientation->origin_col;
+              int row = loc->row + offset_y + orientation->origin_row;
+              if (bitboard_fits (&ai_masks, orientation, col, row))
                 {
-                  player_place_piece (player);
-                  return true;
+                  return ai_place_orientation (player, orientation, col, row);
                 }
             }
         }
@@ -303,23 +240,38 @@ ai_reset (Player *player)
   ai_move_index = 0;
   ai_piece_count = 0;
   ai_piece_index = 0;
+  ai_searching = false;
   if (player == NULL || player->pieces_left == 0)
     {
       return;
     }
-  else if (player_is_first_turn (player))
+
+  AiDiff difficulty = core_get_aidifficulty ();
+  if (difficulty == DIFF_HARD)
+    {
+      // Score every legal move instead of taking the first one that fits
+      ai_search_begin (&ai_search, board_get_claimed (), player->plynum,
+                       player->pieces_used, &AI_WEIGHTS_DEFAULT);
+      ai_searching = true;
+      return;
+    }
+
+  // The board doesn't change until the AI places a piece
+  bitboard_move_masks (&ai_masks, board_get_claimed (), player->plynum,
+                       player_is_first_turn (player));
+
+  if (player_is_first_turn (player))
     {
       ai_gather_initial_moves (player->plynum);
     }
   else
     {
-      ai_gather_next_moves (player->plynum);
+      ai_gather_next_moves ();
       ai_shuffle_moves ();
     }
 
   ai_gather_pieces (player);
 
-  AiDiff difficulty = core_get_aidifficulty ();
   if (difficulty == DIFF_EASY)
     {
       ai_shuffle_pieces_easy ();
@@ -328,10 +280,32 @@ ai_reset (Player *player)
     {
       ai_shuffle_pieces_medium ();
     }
-  else if (difficulty == DIFF_HARD)
+}
+
+/**
+ * Continue the Hard AI's search, and make the best move once it's done.
+ */
+static PlayerTurnResult
+ai_try_search (Player *player)
+{
+  if (!ai_search_step (&ai_search, AI_SEARCH_BUDGET_US))
     {
-      ai_shuffle_pieces_hard ();
+      // Pick up where we left off next frame
+      return PLAYER_TURN_CONTINUE;
     }
+
+  const AiSearchMove *best = &ai_search.best;
+  if (best->orientation == NULL)
+    {
+      return PLAYER_TURN_PASS;
+    }
+
+  player_change_piece (player, best->orientation->piece_index);
+  if (ai_place_orientation (player, best->orientation, best->col, best->row))
+    {
+      return PLAYER_TURN_END;
+    }
+  return PLAYER_TURN_PASS;
 }
 
 PlayerTurnResult
@@ -339,6 +313,11 @@ ai_try (Player *player)
 {
   assert (ai_player == NULL || ai_player == player);
 
+  if (ai_searching)
+    {
+      return ai_try_search (player);
+    }
+
   if (ai_piece_count == 0)
     {
       // No pieces left to place
@@ -0,0 +1,206 @@
+#include "ai_search.h"
+
+/**
+ * Start searching for a player's best move on the current board.
+ *
+ * Everything the scoring needs that doesn't depend on the move is worked out
+ * here, so the search itself only looks at the rows a piece touches.
+ */
+void
+ai_search_begin (AiSearch *search, const BitBoard *claimed, PlyNum player,
+                 const bool *pieces_used, const AiWeights *weights)
+{
+  search->weights = *weights;
+  search->player = player;
+  search->pieces_used = pieces_used;
+  memcpy (search->claimed, claimed, sizeof (search->claimed));
+
+  bitboard_clear (&search->occupied);
+  PLAYER_FOREACH (p)
+  {
+    for (int row = 0; row < BOARD_ROWS; row++)
+      {
+        search->occupied.rows[row] |= claimed[p].rows[row];
+      }
+  }
+
+  // A player with no tiles yet is still on their first turn
+  bitboard_move_masks (&search->masks, claimed, player,
+                       bitboard_count (&claimed[player]) == 0);
+
+  PLAYER_FOREACH (p)
+  {
+    if (p == player)
+      {
+        bitboard_clear (&search->opponent_anchors[p]);
+        continue;
+      }
+    BitMoveMasks masks;
+    bitboard_move_masks (&masks, claimed, p, bitboard_count (&claimed[p]) == 0);
+    search->opponent_anchors[p] = masks.anchors;
+  }
+
+  search->anchor_row = -1;
+  search->anchor_col = -1;
+  search->anchor_bits = 0;
+  search->piece_index = PIECE_COUNT;
+  search->done = false;
+  memset (search->visited, 0, sizeof (search->visited));
+
+  search->best = (AiSearchMove){ .orientation = NULL };
+  search->best_ties = 0;
+  search->moves_scored = 0;
+  search->steps = 0;
+  search->search_us = 0;
+}
+
+/**
+ * Score a legal placement.
+ *
+ * Rewards the tiles placed, the change in the player's own anchors, and the
+ * opponents' anchors the piece takes away. Anchors can only change in the
+ * rows the piece covers and the row on either side of it.
+ */
+static int
+ai_search_score (const AiSearch *search, const PieceOrientation *orientation,
+                 int col, int row)
+{
+  BitBoard own = search->claimed[search->player];
+  BitRow piece[BOARD_ROWS] = { 0 };
+  int blocked = 0;
+
+  for (int r = 0; r < orientation->rows; r++)
+    {
+      BitRow bits = orientation->mask[r] << col;
+      piece[row + r] = bits;
+      own.rows[row + r] |= bits;
+      PLAYER_FOREACH (p)
+      {
+        blocked += __builtin_popcount (bits
+                                       & search->opponent_anchors[p].rows[row + r]);
+      }
+    }
+
+  int first_row = MAX (row - 1, 0);
+  int last_row = MIN (row + orientation->rows, BOARD_ROWS - 1);
+  int corners = 0;
+  for (int r = first_row; r <= last_row; r++)
+    {
+      BitRow occupied = search->occupied.rows[r] | piece[r];
+      BitRow anchors = bitboard_diagonal_row (&own, r)
+                       & ~(occupied | bitboard_face_row (&own, r));
+      corners += __builtin_popcount (anchors)
+                 - __builtin_popcount (search->masks.anchors.rows[r]);
+    }
+
+  return search->weights.cells * orientation->cell_count
+         + search->weights.corners * corners
+         + search->weights.blocked * blocked;
+}
+
+/**
+ * Score every placement of a piece that covers the current anchor.
+ */
+static void
+ai_search_piece (AiSearch *search, size_t piece_index)
+{
+  size_t orientation_count;
+  const PieceOrientation *orientations
+      = bitboard_get_orientations (piece_index, &orientation_count);
+
+  for (size_t i = 0; i < orientation_count; i++)
+    {
+      const PieceOrientation *orientation = &orientations[i];
+      for (int cell = 0; cell < orientation->cell_count; cell++)
+        {
+          int col = search->anchor_col - orientation->cell_cols[cell];
+          int row = search->anchor_row - orientation->cell_rows[cell];
+          if (!bitboard_fits (&search->masks, orientation, col, row))
+            {
+              continue;
+            }
+
+          // A piece covering two anchors would be found from both of them
+          BitRow *visited = &search->visited[orientation->index][row];
+          if (*visited & BITROW_COL (col))
+            {
+              continue;
+            }
+          *visited |= BITROW_COL (col);
+
+          int score = ai_search_score (search, orientation, col, row);
+          search->moves_scored++;
+
+          if (search->best.orientation == NULL || score > search->best.score)
+            {
+              search->best = (AiSearchMove){ orientation, col, row, score };
+              search->best_ties = 1;
+            }
+          else if (score == search->best.score)
+            {
+              // Pick evenly between equally good moves for variety
+              search->best_ties++;
+              if (rand () % search->best_ties == 0)
+                {
+                  search->best
+                      = (AiSearchMove){ orientation, col, row, score };
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Keep searching until the search is done or the time budget runs out.
+ *
+ * Works through one piece at one anchor at a time, so a step never runs
+ * much longer than its budget. Returns true once every move has been scored
+ * and `best` holds the move to make (or no orientation if there is none).
+ */
+bool
+ai_search_step (AiSearch *search, uint32_t budget_us)
+{
+  if (search->done)
+    {
+      return true;
+    }
+
+  uint32_t start = get_ticks_us ();
+  uint32_t elapsed = 0;
+  search->steps++;
+
+  while (elapsed < budget_us)
+    {
+      if (search->piece_index >= PIECE_COUNT)
+        {
+          // Move on to the next anchor
+          while (search->anchor_bits == 0)
+            {
+              search->anchor_row++;
+              if (search->anchor_row >= BOARD_ROWS)
+                {
+                  search->done = true;
+                  break;
+                }
+              search->anchor_bits = search->masks.anchors.rows[search->anchor_row];
+            }
+          if (search->done)
+            {
+              break;
+            }
+          search->anchor_col = __builtin_ctz (search->anchor_bits);
+          search->anchor_bits &= search->anchor_bits - 1;
+          search->piece_index = 0;
+        }
+
+      if (!search->pieces_used[search->piece_index])
+        {
+          ai_search_piece (search, search->piece_index);
+        }
+      search->piece_index++;
+      elapsed = get_ticks_us () - start;
+    }
+
+  search->search_us += get_ticks_us () - start;
+  return search->done;
+}
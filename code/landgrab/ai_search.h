@@ -0,0 +1,75 @@
+#ifndef GAMEJAM2024_LANDGRAB_AI_SEARCH_H
+#define GAMEJAM2024_LANDGRAB_AI_SEARCH_H
+
+#include "bitboard.h"
+
+// How long the Hard AI may search each frame
+#define AI_SEARCH_BUDGET_US 2000
+
+/**
+ * @brief How much each part of a move is worth to the AI.
+ */
+typedef struct
+{
+  // Per tile of the piece placed
+  int cells;
+  // Per anchor the player gains (or loses, if negative)
+  int corners;
+  // Per opponent anchor the piece covers
+  int blocked;
+} AiWeights;
+
+static const AiWeights AI_WEIGHTS_DEFAULT = {
+  .cells = 12,
+  .corners = 3,
+  .blocked = 4,
+};
+
+typedef struct
+{
+  const PieceOrientation *orientation;
+  // Top-left of the orientation's bounding box on the board
+  int col;
+  int row;
+  int score;
+} AiSearchMove;
+
+/**
+ * @brief A search for the best move, which can be spread over many frames.
+ */
+typedef struct
+{
+  AiWeights weights;
+  PlyNum player;
+  const bool *pieces_used;
+  BitBoard claimed[MAXPLAYERS];
+  BitBoard occupied;
+  BitMoveMasks masks;
+  BitBoard opponent_anchors[MAXPLAYERS];
+
+  // Where the search will pick up on the next step
+  int anchor_row;
+  int anchor_col;
+  BitRow anchor_bits;
+  size_t piece_index;
+  bool done;
+
+  // Placements already scored from another anchor
+  BitRow visited[BITBOARD_MAX_ORIENTATIONS][BOARD_ROWS];
+
+  AiSearchMove best;
+  int best_ties;
+
+  // Statistics
+  int moves_scored;
+  int steps;
+  uint32_t search_us;
+} AiSearch;
+
+void ai_search_begin (AiSearch *search, const BitBoard *claimed,
+                      PlyNum player, const bool *pieces_used,
+                      const AiWeights *weights);
+
+bool ai_search_step (AiSearch *search, uint32_t budget_us);
+
+#endif // GAMEJAM2024_LANDGRAB_AI_SEARCH_H
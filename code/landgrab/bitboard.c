@@ -0,0 +1,212 @@
+#include "bitboard.h"
+
+static PieceOrientation orientations[BITBOARD_MAX_ORIENTATIONS];
+static size_t orientation_start[PIECE_COUNT];
+static size_t orientation_count[PIECE_COUNT];
+static bool orientations_ready = false;
+
+/**
+ * Rotate a piece buffer a quarter turn, the same way player_flip_piece does.
+ */
+static void
+bitboard_rotate_cells (Cell *cells)
+{
+  Cell temp[PIECE_SIZE];
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      int col = i % PIECE_COLS;
+      int row = i / PIECE_COLS;
+      temp[col * PIECE_COLS + (PIECE_COLS - 1 - row)] = cells[i];
+    }
+  memcpy (cells, temp, sizeof (temp));
+}
+
+/**
+ * Mirror a piece buffer left to right, the same way player_mirror_piece does.
+ */
+static void
+bitboard_mirror_cells (Cell *cells)
+{
+  Cell temp[PIECE_SIZE];
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      int col = i % PIECE_COLS;
+      int row = i / PIECE_COLS;
+      temp[row * PIECE_COLS + (PIECE_COLS - 1 - col)] = cells[i];
+    }
+  memcpy (cells, temp, sizeof (temp));
+}
+
+static void
+bitboard_crop_orientation (PieceOrientation *orientation)
+{
+  int min_col = PIECE_COLS, max_col = -1;
+  int min_row = PIECE_ROWS, max_row = -1;
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      if (orientation->cells[i] == CELL_FILLED)
+        {
+          int col = i % PIECE_COLS;
+          int row = i / PIECE_COLS;
+          min_col = MIN (min_col, col);
+          max_col = MAX (max_col, col);
+          min_row = MIN (min_row, row);
+          max_row = MAX (max_row, row);
+        }
+    }
+
+  orientation->origin_col = min_col;
+  orientation->origin_row = min_row;
+  orientation->cols = max_col - min_col + 1;
+  orientation->rows = max_row - min_row + 1;
+  orientation->cell_count = 0;
+  memset (orientation->mask, 0, sizeof (orientation->mask));
+
+  for (int row = min_row; row <= max_row; row++)
+    {
+      for (int col = min_col; col <= max_col; col++)
+        {
+          if (orientation->cells[row * PIECE_COLS + col] == CELL_FILLED)
+            {
+              int n = orientation->cell_count++;
+              orientation->cell_cols[n] = col - min_col;
+              orientation->cell_rows[n] = row - min_row;
+              orientation->mask[row - min_row] |= BITROW_COL (col - min_col);
+            }
+        }
+    }
+}
+
+static bool
+bitboard_same_shape (const PieceOrientation *a, const PieceOrientation *b)
+{
+  return a->cols == b->cols && a->rows == b->rows
+         && memcmp (a->mask, b->mask, sizeof (a->mask)) == 0;
+}
+
+/**
+ * Precompute every distinct orientation of every piece.
+ *
+ * Symmetric pieces would otherwise be tried several times in the same spot,
+ * so orientations with the same shape are only kept once.
+ */
+void
+bitboard_init (void)
+{
+  if (orientations_ready)
+    {
+      return;
+    }
+
+  size_t total = 0;
+  for (size_t p = 0; p < PIECE_COUNT; p++)
+    {
+      Cell cells[PIECE_SIZE];
+      memcpy (cells, PIECES[p].cells, sizeof (cells));
+      orientation_start[p] = total;
+
+      for (int i = 0; i < BITBOARD_TRANSFORMS; i++)
+        {
+          if (i == BITBOARD_TRANSFORMS / 2)
+            {
+              bitboard_mirror_cells (cells);
+            }
+
+          PieceOrientation *orientation = &orientations[total];
+          orientation->piece_index = p;
+          orientation->index = total;
+          memcpy (orientation->cells, cells, sizeof (cells));
+          bitboard_crop_orientation (orientation);
+          assert (orientation->cell_count == PIECES[p].value);
+
+          bool duplicate = false;
+          for (size_t j = orientation_start[p]; j < total; j++)
+            {
+              if (bitboard_same_shape (&orientations[j], orientation))
+                {
+                  duplicate = true;
+                  break;
+                }
+            }
+          if (!duplicate)
+            {
+              total++;
+            }
+
+          bitboard_rotate_cells (cells);
+        }
+
+      orientation_count[p] = total - orientation_start[p];
+    }
+
+  orientations_ready = true;
+}
+
+const PieceOrientation *
+bitboard_get_orientations (size_t piece_index, size_t *count)
+{
+  assert (orientations_ready);
+  assert (piece_index < PIECE_COUNT);
+  *count = orientation_count[piece_index];
+  return &orientations[orientation_start[piece_index]];
+}
+
+void
+bitboard_clear (BitBoard *bitboard)
+{
+  memset (bitboard, 0, sizeof (*bitboard));
+}
+
+bool
+bitboard_is_set (const BitBoard *bitboard, int col, int row)
+{
+  if (!board_is_tile_valid (col, row))
+    {
+      return false;
+    }
+  return (bitboard->rows[row] & BITROW_COL (col)) != 0;
+}
+
+int
+bitboard_count (const BitBoard *bitboard)
+{
+  int count = 0;
+  for (int row = 0; row < BOARD_ROWS; row++)
+    {
+      count += __builtin_popcount (bitboard->rows[row]);
+    }
+  return count;
+}
+
+/**
+ * Build the move masks for a player from everyone's claimed tiles.
+ *
+ * Only depends on the board, so the AI builds these once per turn and then
+ * checks every placement against them.
+ */
+void
+bitboard_move_masks (BitMoveMasks *masks, const BitBoard *claimed,
+                     PlyNum player, bool first_turn)
+{
+  const BitBoard *own = &claimed[player];
+
+  for (int row = 0; row < BOARD_ROWS; row++)
+    {
+      BitRow occupied = 0;
+      PLAYER_FOREACH (p) { occupied |= claimed[p].rows[row]; }
+
+      masks->blocked.rows[row] = occupied | bitboard_face_row (own, row);
+      masks->anchors.rows[row]
+          = bitboard_diagonal_row (own, row) & ~masks->blocked.rows[row];
+    }
+
+  if (first_turn)
+    {
+      // There is nothing to touch yet, so any corner of the board will do
+      bitboard_clear (&masks->anchors);
+      BitRow corners = BITROW_COL (0) | BITROW_COL (BOARD_COLS - 1);
+      masks->anchors.rows[0] = corners & ~masks->blocked.rows[0];
+      masks->anchors.rows[BOARD_ROWS - 1]
+          = corners & ~masks->blocked.rows[BOARD_ROWS - 1];
+    }
+}
@@ -0,0 +1,134 @@
+#ifndef GAMEJAM2024_LANDGRAB_BITBOARD_H
+#define GAMEJAM2024_LANDGRAB_BITBOARD_H
+
+#include "global.h"
+#include "board.h"
+#include "piece.h"
+
+/**
+ * @brief One board row as a bit mask; bit N is column N.
+ */
+typedef uint32_t BitRow;
+
+#define BITROW_MASK ((BitRow)((1u << BOARD_COLS) - 1))
+#define BITROW_COL(col) ((BitRow)1u << (col))
+
+// Every piece has at most 4 rotations, each of them mirrored
+#define BITBOARD_TRANSFORMS 8
+#define BITBOARD_MAX_ORIENTATIONS (PIECE_COUNT * BITBOARD_TRANSFORMS)
+
+/**
+ * @brief One bit per board tile, stored row by row.
+ */
+typedef struct BitBoard
+{
+  BitRow rows[BOARD_ROWS];
+} BitBoard;
+
+/**
+ * @brief The tiles a player may not cover and the tiles a piece must touch.
+ *
+ * A placement is legal if none of its tiles are blocked and at least one of
+ * them is an anchor. Blocked tiles are claimed by anyone or share a face
+ * with the player's own tiles; anchors are the free diagonal neighbours of
+ * the player's tiles (or the board corners on their first turn).
+ */
+typedef struct
+{
+  BitBoard blocked;
+  BitBoard anchors;
+} BitMoveMasks;
+
+/**
+ * @brief A piece in one orientation, cropped to its bounding box.
+ */
+typedef struct
+{
+  size_t piece_index;
+  // Position in the table of all orientations
+  size_t index;
+  // Bounding box size
+  int cols;
+  int rows;
+  // Top-left of the bounding box inside the piece buffer
+  int origin_col;
+  int origin_row;
+  BitRow mask[PIECE_ROWS];
+  // Filled cells relative to the bounding box
+  int cell_count;
+  int cell_cols[PIECE_MAX_VALUE];
+  int cell_rows[PIECE_MAX_VALUE];
+  // The same orientation as a piece buffer, for handing to a Player
+  Cell cells[PIECE_SIZE];
+} PieceOrientation;
+
+void bitboard_init (void);
+
+const PieceOrientation *bitboard_get_orientations (size_t piece_index,
+                                                   size_t *count);
+
+void bitboard_clear (BitBoard *bitboard);
+
+bool bitboard_is_set (const BitBoard *bitboard, int col, int row);
+
+int bitboard_count (const BitBoard *bitboard);
+
+void bitboard_move_masks (BitMoveMasks *masks, const BitBoard *claimed,
+                          PlyNum player, bool first_turn);
+
+/**
+ * @brief Tiles of a row claimed by one player that would block them.
+ *
+ * That is their own tiles and every tile sharing a face with them.
+ */
+static inline BitRow
+bitboard_face_row (const BitBoard *own, int row)
+{
+  BitRow here = own->rows[row];
+  BitRow above = row > 0 ? own->rows[row - 1] : 0;
+  BitRow below = row < BOARD_ROWS - 1 ? own->rows[row + 1] : 0;
+  return (here | (here << 1) | (here >> 1) | above | below) & BITROW_MASK;
+}
+
+/**
+ * @brief Tiles of a row diagonal to one player's tiles.
+ */
+static inline BitRow
+bitboard_diagonal_row (const BitBoard *own, int row)
+{
+  BitRow above = row > 0 ? own->rows[row - 1] : 0;
+  BitRow below = row < BOARD_ROWS - 1 ? own->rows[row + 1] : 0;
+  return ((above << 1) | (above >> 1) | (below << 1) | (below >> 1))
+         & BITROW_MASK;
+}
+
+/**
+ * @brief Check whether an orientation can be placed with the top-left of its
+ * bounding box at the given tile.
+ *
+ * Out of bounds placements are rejected, so callers can test bogus
+ * coordinates just like with board_check_piece.
+ */
+static inline bool
+bitboard_fits (const BitMoveMasks *masks, const PieceOrientation *orientation,
+               int col, int row)
+{
+  if (col < 0 || row < 0 || col + orientation->cols > BOARD_COLS
+      || row + orientation->rows > BOARD_ROWS)
+    {
+      return false;
+    }
+  BitRow touching = 0;
+  for (int r = 0; r < orientation->rows; r++)
+    {
+      BitRow bits = orientation->mask[r] << col;
+      if (bits & masks->blocked.rows[row + r])
+        {
+          return false;
+        }
+      touching |= bits & masks->anchors.rows[row + r];
+    }
+  return touching != 0;
+}
+
+#endif // GAMEJAM2024_LANDGRAB_BITBOARD_H
@@ -14,6 +14,9 @@
 #define BOARD_SIZE (BOARD_ROWS * BOARD_COLS)
 #define BOARD_COLOR RGBA32 (0, 0, 0, 64)
 
+// Tile values: unclaimed, or the owning player's number plus one
+#define TILE_UNCLAIMED 0
+
 // Positioning constants
 #define BOARD_MARGIN_TOP 28
 #define BOARD_MARGIN_LEFT 72
@@ -33,11 +36,13 @@ typedef struct
   bool is_touching_faces;
 } CheckPieceResult;
 
-void board_init (void);
+struct BitBoard;
 
-void board_cleanup (void);
+// Rules (board.c)
 
-void board_render (void);
+void board_init (void);
+
+int board_get_tile (int col, int row);
 
 bool board_is_tile_valid (int col, int row);
 
@@ -45,16 +50,26 @@ bool board_is_tile_unclaimed (int col, int row);
 
 bool board_is_tile_claimed (int col, int row, PlyNum player);
 
-void board_render_tile (int col, int row, color_t color);
-
-void board_render_bad_tile_marker (int col, int row);
-
-Rect board_get_tile_rect (int x, int y);
-
 CheckPieceResult board_check_piece (Player *player);
 
 void board_blit_piece (Player *player);
 
 bool board_place_piece (Player *player);
 
+const struct BitBoard *board_get_claimed (void);
+
+// Drawing (board_render.c)
+
+void board_render_init (void);
+
+void board_render_cleanup (void);
+
+void board_render (void);
+
+void board_render_tile (int col, int row, color_t color);
+
+void board_render_bad_tile_marker (int col, int row);
+
+Rect board_get_tile_rect (int x, int y);
+
 #endif // GAMEJAM2024_LANDGRAB_BOARD_H
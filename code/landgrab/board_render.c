@@ -0,0 +1,83 @@
+#include "board.h"
+#include "color.h"
+
+#define TILE_UNCLAIMED_COLOR RGBA32 (160, 160, 160, 64)
+
+static sprite_t *x_sprite = NULL;
+
+void
+board_render_init (void)
+{
+  x_sprite = sprite_load ("rom:/landgrab/x.ia8.sprite");
+}
+
+void
+board_render_cleanup (void)
+{
+  sprite_free (x_sprite);
+  x_sprite = NULL;
+}
+
+void
+board_render (void)
+{
+  rdpq_set_mode_standard ();
+  rdpq_mode_combiner (RDPQ_COMBINER_FLAT);
+  rdpq_mode_blender (RDPQ_BLENDER_MULTIPLY);
+
+  rdpq_set_prim_color (BOARD_COLOR);
+  int board_x0 = BOARD_MARGIN_LEFT - TILE_SPACING;
+  int board_y0 = BOARD_MARGIN_TOP - TILE_SPACING;
+  int board_x1 = BOARD_MARGIN_LEFT + BOARD_COLS * (TILE_SIZE + TILE_SPACING);
+  int board_y1 = BOARD_MARGIN_TOP + BOARD_ROWS * (TILE_SIZE + TILE_SPACING);
+  rdpq_fill_rectangle (board_x0, board_y0, board_x1, board_y1);
+
+  for (int row = 0; row < BOARD_ROWS; row++)
+    {
+      for (int col = 0; col < BOARD_COLS; col++)
+        {
+          int tile = board_get_tile (col, row);
+          color_t tile_color = TILE_UNCLAIMED_COLOR;
+          if (tile != TILE_UNCLAIMED)
+            {
+              tile_color = PLAYER_COLORS[tile - 1];
+            }
+          board_render_tile (col, row, tile_color);
+        }
+    }
+}
+
+void
+board_render_tile (int col, int row, color_t color)
+{
+  rdpq_set_prim_color (color);
+  Rect rect = board_get_tile_rect (col, row);
+  rdpq_fill_rectangle (rect.x0, rect.y0, rect.x1, rect.y1);
+}
+
+void
+board_render_bad_tile_marker (int col, int row)
+{
+  Rect rect = board_get_tile_rect (col, row);
+
+  rdpq_mode_push ();
+  {
+    rdpq_set_mode_standard ();
+    rdpq_mode_filter (FILTER_BILINEAR);
+    rdpq_mode_blender (RDPQ_BLENDER_MULTIPLY);
+    rdpq_mode_combiner (
+        RDPQ_COMBINER1 ((PRIM, ENV, TEX0, ENV), (0, 0, 0, TEX0)));
+    rdpq_set_prim_color (COLOR_DARK_GRAY); // fill color
+    rdpq_set_env_color (COLOR_DARK_GRAY);  // outline color
+    rdpq_sprite_blit (x_sprite, rect.x0, rect.y0, &(rdpq_blitparms_t){});
+  }
+  rdpq_mode_pop ();
+}
+
+Rect
+board_get_tile_rect (int col, int row)
+{
+  int x0 = BOARD_MARGIN_LEFT + col * (TILE_SIZE + TILE_SPACING);
+  int y0 = BOARD_MARGIN_TOP + row * (TILE_SIZE + TILE_SPACING);
+  return (Rect){ x0, y0, x0 + TILE_SIZE, y0 + TILE_SIZE };
+}
@@ -534,6 +534,7 @@ minigame_init (void)
   logo_init ();
   background_init ();
   board_init ();
+  board_render_init ();
   scoreboard_init ();
 
   PLAYER_FOREACH (p) { player_init (&players[p], p); }
@@ -558,7 +559,7 @@ minigame_cleanup (void)
   PLAYER_FOREACH (i) { player_cleanup (&players[i]); }
 
   scoreboard_cleanup ();
-  board_cleanup ();
+  board_render_cleanup ();
   background_cleanup ();
   logo_cleanup ();
   sfx_cleanup ();
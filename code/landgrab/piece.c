@@ -154,3 +154,35 @@ const Piece PIECES[PIECE_COUNT] = {
          0, 0, 0, 0, 0}},
 };
 // clang-format on
+
+/**
+ * Score a player by the pieces they have used.
+ *
+ * Each unused square costs a point; using every piece earns a bonus, and
+ * another one if the last piece was the monomino.
+ */
+int
+pieces_score (const bool *pieces_used, bool monomino_final_piece)
+{
+  int score = 0;
+  bool used_all = true;
+  for (size_t i = 0; i < PIECE_COUNT; i++)
+    {
+      if (!pieces_used[i])
+        {
+          score -= PIECES[i].value;
+          used_all = false;
+        }
+    }
+
+  if (used_all)
+    {
+      score += BONUS_USED_ALL_PIECES;
+      if (monomino_final_piece)
+        {
+          score += BONUS_MONOMINO_FINAL_PIECE;
+        }
+    }
+
+  return score;
+}
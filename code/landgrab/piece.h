@@ -12,6 +12,9 @@
 #define PIECE_MAX_VALUE 5
 #define PIECE_COUNT 21
 
+#define BONUS_USED_ALL_PIECES 15
+#define BONUS_MONOMINO_FINAL_PIECE 20
+
 typedef enum
 {
   CELL_EMPTY = 0,
@@ -26,4 +29,6 @@ typedef struct
 
 extern const Piece PIECES[PIECE_COUNT];
 
+int pieces_score (const bool *pieces_used, bool monomino_final_piece);
+
 #endif
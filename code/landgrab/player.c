@@ -7,9 +7,6 @@
 
 #define PLAYER_MOVE_DELAY 0.15f
 
-#define BONUS_USED_ALL_PIECES 15
-#define BONUS_MONOMINO_FINAL_PIECE 20
-
 #define SPRITE_CURSOR_P1 "rom:/landgrab/cursor_p1.rgba16.sprite"
 #define SPRITE_CURSOR_P2 "rom:/landgrab/cursor_p2.rgba16.sprite"
 #define SPRITE_CURSOR_P3 "rom:/landgrab/cursor_p3.rgba16.sprite"
@@ -41,27 +38,7 @@ player_move_cursor (Player *player, int col, int row, bool active)
 static int
 player_score (Player *player)
 {
-  int score = 0;
-  // Each unused square costs you a point
-  for (size_t i = 0; i < PIECE_COUNT; i++)
-    {
-      if (!player->pieces_used[i])
-        {
-          score -= PIECES[i].value;
-        }
-    }
-
-  // Bonuses are applied when the player uses all their pieces
-  if (player->pieces_left == 0)
-    {
-      score += BONUS_USED_ALL_PIECES;
-      if (player->monomino_final_piece)
-        {
-          score += BONUS_MONOMINO_FINAL_PIECE;
-        }
-    }
-
-  return score;
+  return pieces_score (player->pieces_used, player->monomino_final_piece);
 }
 
 static void
@@ -0,0 +1,143 @@
+/**
+ * Host self-play benchmark for the landgrab AI.
+ *
+ * Runs the real ai.c against the real board rules, seating one AI at the
+ * difficulty under test against three at another, and rotating the seat so
+ * going first doesn't skew the results. Reports how often the seat under
+ * test wins, its average score, and how long its moves took.
+ */
+
+#include "../../../ai.h"
+#include "../../../board.h"
+#include "landgrab_host.h"
+
+#define GAMES 400
+
+static Player players[MAXPLAYERS];
+static AiDiff difficulties[MAXPLAYERS];
+
+/* ---------- Self-play ---------- */
+
+typedef struct
+{
+  int games;
+  int wins;
+  int score;
+  int moves;
+  int frames;
+  uint64_t move_us;
+  uint64_t worst_move_us;
+  uint64_t worst_frame_us;
+} SeatStats;
+
+/**
+ * Play one game, with the AI difficulty of each seat in `difficulties`.
+ * Only the stats for the seat under test are collected.
+ */
+static void
+play_game (PlyNum test_seat, SeatStats *stats)
+{
+  board_init ();
+  PLAYER_FOREACH (p) { host_player_init (&players[p], p); }
+
+  bool passed[MAXPLAYERS] = { false };
+  int passed_count = 0;
+
+  for (int turn = 0; passed_count < MAXPLAYERS; turn++)
+    {
+      PlyNum p = turn % MAXPLAYERS;
+      Player *player = &players[p];
+      host_aidifficulty = difficulties[p];
+      // Same as the minigame: a player who passed keeps passing
+      ai_reset (passed[p] ? NULL : player);
+
+      uint64_t move_us = 0;
+      PlayerTurnResult result = PLAYER_TURN_CONTINUE;
+      while (result == PLAYER_TURN_CONTINUE)
+        {
+          uint64_t start = get_ticks_us ();
+          result = ai_try (player);
+          uint64_t frame_us = get_ticks_us () - start;
+          move_us += frame_us;
+
+          if (p == test_seat)
+            {
+              stats->frames++;
+              stats->worst_frame_us = MAX (stats->worst_frame_us, frame_us);
+            }
+        }
+
+      if (p == test_seat && result == PLAYER_TURN_END)
+        {
+          stats->moves++;
+          stats->move_us += move_us;
+          stats->worst_move_us = MAX (stats->worst_move_us, move_us);
+        }
+
+      if (result == PLAYER_TURN_PASS && !passed[p])
+        {
+          passed[p] = true;
+          passed_count++;
+        }
+    }
+
+  int best = INT32_MIN;
+  PLAYER_FOREACH (p) { best = MAX (best, players[p].score); }
+
+  stats->games++;
+  stats->score += players[test_seat].score;
+  stats->wins += players[test_seat].score == best;
+}
+
+static const char *
+difficulty_name (AiDiff difficulty)
+{
+  switch (difficulty)
+    {
+    case DIFF_EASY:
+      return "Easy";
+    case DIFF_MEDIUM:
+      return "Medium";
+    default:
+      return "Hard";
+    }
+}
+
+static void
+run_matchup (AiDiff test, AiDiff opponents)
+{
+  SeatStats stats = { 0 };
+  srand (2024);
+
+  for (int game = 0; game < GAMES; game++)
+    {
+      PlyNum test_seat = game % MAXPLAYERS;
+      PLAYER_FOREACH (p)
+      {
+        difficulties[p] = p == test_seat ? test : opponents;
+      }
+      play_game (test_seat, &stats);
+    }
+
+  printf ("%-6s vs 3x %-6s  win %5.1f%%  score %6.1f  moves %4.1f  "
+          "move %6.1f us (worst %6llu)  frames/move %4.2f  "
+          "worst frame %6llu us\n",
+          difficulty_name (test), difficulty_name (opponents),
+          100.0 * stats.wins / stats.games, (double)stats.score / stats.games,
+          (double)stats.moves / stats.games,
+          (double)stats.move_us / MAX (stats.moves, 1),
+          (unsigned long long)stats.worst_move_us,
+          (double)stats.frames / MAX (stats.moves, 1),
+          (unsigned long long)stats.worst_frame_us);
+}
+
+int
+main (void)
+{
+  printf ("%d games per matchup, ties count as wins\n", GAMES);
+  run_matchup (DIFF_MEDIUM, DIFF_MEDIUM);
+  run_matchup (DIFF_HARD, DIFF_MEDIUM);
+  run_matchup (DIFF_HARD, DIFF_EASY);
+  run_matchup (DIFF_MEDIUM, DIFF_HARD);
+  return 0;
+}
@@ -0,0 +1,63 @@
+// Host stand-ins for the parts of core.c and player.c the AI calls.
+// Same rules as the real ones, without the cursor, sound or hints.
+
+#include "landgrab_host.h"
+#include "../../board.h"
+
+AiDiff host_aidifficulty = DIFF_HARD;
+
+AiDiff
+core_get_aidifficulty (void)
+{
+  return host_aidifficulty;
+}
+
+void
+host_player_init (Player *player, PlyNum plynum)
+{
+  memset (player, 0, sizeof (Player));
+  player->plynum = plynum;
+  player->pieces_left = PIECE_COUNT;
+  player->score = pieces_score (player->pieces_used, false);
+}
+
+bool
+player_set_cursor (Player *player, int col, int row)
+{
+  player->cursor_col = col;
+  player->cursor_row = row;
+  return true;
+}
+
+bool
+player_change_piece (Player *player, int piece_index)
+{
+  assert (piece_index >= 0 && piece_index < PIECE_COUNT);
+  if (player->pieces_used[piece_index])
+    {
+      return false;
+    }
+  player->piece_index = piece_index;
+  memcpy (player->piece_buffer, PIECES[piece_index].cells,
+          sizeof (player->piece_buffer));
+  return true;
+}
+
+bool
+player_place_piece (Player *player)
+{
+  if (!board_check_piece (player).is_valid)
+    {
+      return false;
+    }
+  board_blit_piece (player);
+  player->pieces_used[player->piece_index] = true;
+  player->pieces_left--;
+  if (player->pieces_left == 0 && PIECES[player->piece_index].value == 1)
+    {
+      player->monomino_final_piece = true;
+    }
+  player->score
+      = pieces_score (player->pieces_used, player->monomino_final_piece);
+  return true;
+}
@@ -0,0 +1,13 @@
+// Host stand-ins for the parts of core.c and player.c the AI calls
+
+#ifndef LANDGRAB_HOST_H
+#define LANDGRAB_HOST_H
+
+#include "../../player.h"
+
+// What core_get_aidifficulty returns, set it before ai_reset
+extern AiDiff host_aidifficulty;
+
+void host_player_init (Player *player, PlyNum plynum);
+
+#endif
@@ -0,0 +1,32 @@
+// Stand-in for libdragon.h so the landgrab rules and AI build on the host.
+// Only provides the types their headers mention, nothing here draws.
+
+#ifndef LANDGRAB_HOST_LIBDRAGON_H
+#define LANDGRAB_HOST_LIBDRAGON_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+typedef struct { uint8_t r, g, b, a; } color_t;
+typedef struct sprite_s sprite_t;
+typedef int joypad_port_t;
+
+static inline uint64_t
+get_ticks_us (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#endif
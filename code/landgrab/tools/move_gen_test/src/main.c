@@ -0,0 +1,289 @@
+/**
+ * Host cross-check of the bit board move generator.
+ *
+ * Plays random games and, before every move, builds the full set of legal
+ * placements twice: once by sliding every orientation of every piece over
+ * the board with board_check_piece, and once with bitboard_fits. Any
+ * placement the two disagree on is reported, and the program exits with an
+ * error. Also reports how long each method takes to find all moves.
+ */
+
+#include <time.h>
+
+#include "../../../bitboard.h"
+#include "../../../board.h"
+
+#define GAMES 50
+#define TRANSFORMS 8
+#define MAX_ORIENTATIONS (PIECE_COUNT * TRANSFORMS)
+
+// Legal placements, by orientation and top-left of the bounding box
+static bool slow_moves[MAX_ORIENTATIONS][BOARD_ROWS][BOARD_COLS];
+static bool fast_moves[MAX_ORIENTATIONS][BOARD_ROWS][BOARD_COLS];
+
+static Player players[MAXPLAYERS];
+static const PieceOrientation *all_orientations;
+static size_t total_orientations;
+
+static double
+now (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void
+rotate_buffer (Cell *cells)
+{
+  Cell temp[PIECE_SIZE];
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      int col = i % PIECE_COLS;
+      int row = i / PIECE_COLS;
+      temp[col * PIECE_COLS + (PIECE_COLS - 1 - row)] = cells[i];
+    }
+  memcpy (cells, temp, sizeof (temp));
+}
+
+static void
+mirror_buffer (Cell *cells)
+{
+  Cell temp[PIECE_SIZE];
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      int col = i % PIECE_COLS;
+      int row = i / PIECE_COLS;
+      temp[row * PIECE_COLS + (PIECE_COLS - 1 - col)] = cells[i];
+    }
+  memcpy (cells, temp, sizeof (temp));
+}
+
+/**
+ * Find the precomputed orientation with the same shape as a piece buffer,
+ * and where its bounding box starts inside the buffer.
+ */
+static size_t
+find_orientation (size_t piece_index, const Cell *cells, int *origin_col,
+                  int *origin_row)
+{
+  int min_col = PIECE_COLS, min_row = PIECE_ROWS;
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      if (cells[i] == CELL_FILLED)
+        {
+          min_col = MIN (min_col, i % PIECE_COLS);
+          min_row = MIN (min_row, i / PIECE_COLS);
+        }
+    }
+
+  BitRow mask[PIECE_ROWS] = { 0 };
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      if (cells[i] == CELL_FILLED)
+        {
+          mask[i / PIECE_COLS - min_row] |= BITROW_COL (i % PIECE_COLS - min_col);
+        }
+    }
+
+  size_t count;
+  const PieceOrientation *orientations
+      = bitboard_get_orientations (piece_index, &count);
+  for (size_t i = 0; i < count; i++)
+    {
+      if (memcmp (orientations[i].mask, mask, sizeof (mask)) == 0)
+        {
+          *origin_col = min_col;
+          *origin_row = min_row;
+          return &orientations[i] - all_orientations;
+        }
+    }
+
+  printf ("FAIL: piece %zu has an orientation that wasn't precomputed\n",
+          piece_index);
+  exit (1);
+}
+
+static void
+gather_slow (Player *player)
+{
+  memset (slow_moves, 0, sizeof (slow_moves));
+  for (size_t piece = 0; piece < PIECE_COUNT; piece++)
+    {
+      if (player->pieces_used[piece])
+        {
+          continue;
+        }
+      Cell cells[PIECE_SIZE];
+      memcpy (cells, PIECES[piece].cells, sizeof (cells));
+      for (int t = 0; t < TRANSFORMS; t++)
+        {
+          if (t == TRANSFORMS / 2)
+            {
+              mirror_buffer (cells);
+            }
+          int origin_col, origin_row;
+          size_t orientation
+              = find_orientation (piece, cells, &origin_col, &origin_row);
+          memcpy (player->piece_buffer, cells, sizeof (cells));
+          for (int row = -PIECE_ROWS; row < BOARD_ROWS; row++)
+            {
+              for (int col = -PIECE_COLS; col < BOARD_COLS; col++)
+                {
+                  player->cursor_col = col;
+                  player->cursor_row = row;
+                  if (board_check_piece (player).is_valid)
+                    {
+                      slow_moves[orientation][row + origin_row]
+                                [col + origin_col]
+                          = true;
+                    }
+                }
+            }
+          rotate_buffer (cells);
+        }
+    }
+}
+
+static void
+gather_fast (Player *player)
+{
+  memset (fast_moves, 0, sizeof (fast_moves));
+  BitMoveMasks masks;
+  bitboard_move_masks (&masks, board_get_claimed (), player->plynum,
+                       player_is_first_turn (player));
+  for (size_t i = 0; i < total_orientations; i++)
+    {
+      const PieceOrientation *orientation = &all_orientations[i];
+      if (player->pieces_used[orientation->piece_index])
+        {
+          continue;
+        }
+      for (int row = 0; row <= BOARD_ROWS - orientation->rows; row++)
+        {
+          for (int col = 0; col <= BOARD_COLS - orientation->cols; col++)
+            {
+              fast_moves[i][row][col]
+                  = bitboard_fits (&masks, orientation, col, row);
+            }
+        }
+    }
+}
+
+/**
+ * Compare both move sets, returns how many legal moves there are.
+ */
+static int
+compare_moves (int game, int turn, int *mismatches)
+{
+  int legal = 0;
+  for (size_t i = 0; i < total_orientations; i++)
+    {
+      for (int row = 0; row < BOARD_ROWS; row++)
+        {
+          for (int col = 0; col < BOARD_COLS; col++)
+            {
+              if (slow_moves[i][row][col] != fast_moves[i][row][col])
+                {
+                  if (*mismatches < 10)
+                    {
+                      printf ("FAIL: game %d turn %d, piece %zu at %d,%d: "
+                              "board_check_piece says %d, bitboard says %d\n",
+                              game, turn, all_orientations[i].piece_index,
+                              col, row, slow_moves[i][row][col],
+                              fast_moves[i][row][col]);
+                    }
+                  (*mismatches)++;
+                }
+              legal += fast_moves[i][row][col];
+            }
+        }
+    }
+  return legal;
+}
+
+static void
+play_random_move (Player *player, int legal)
+{
+  int pick = rand () % legal;
+  for (size_t i = 0; i < total_orientations; i++)
+    {
+      for (int row = 0; row < BOARD_ROWS; row++)
+        {
+          for (int col = 0; col < BOARD_COLS; col++)
+            {
+              if (fast_moves[i][row][col] && pick-- == 0)
+                {
+                  const PieceOrientation *orientation = &all_orientations[i];
+                  memcpy (player->piece_buffer, orientation->cells,
+                          sizeof (player->piece_buffer));
+                  player->cursor_col = col - orientation->origin_col;
+                  player->cursor_row = row - orientation->origin_row;
+                  board_blit_piece (player);
+                  player->pieces_used[orientation->piece_index] = true;
+                  player->pieces_left--;
+                  return;
+                }
+            }
+        }
+    }
+}
+
+int
+main (void)
+{
+  board_init ();
+  all_orientations = bitboard_get_orientations (0, &total_orientations);
+  size_t last_count;
+  size_t last_start = bitboard_get_orientations (PIECE_COUNT - 1, &last_count)
+                      - all_orientations;
+  total_orientations = last_start + last_count;
+  printf ("%zu distinct piece orientations\n", total_orientations);
+
+  int mismatches = 0;
+  int positions = 0;
+  double slow_time = 0, fast_time = 0;
+  srand (2024);
+
+  for (int game = 0; game < GAMES; game++)
+    {
+      board_init ();
+      PLAYER_FOREACH (p)
+      {
+        memset (&players[p], 0, sizeof (Player));
+        players[p].plynum = p;
+        players[p].pieces_left = PIECE_COUNT;
+      }
+
+      int passes = 0;
+      for (int turn = 0; passes < MAXPLAYERS; turn++)
+        {
+          Player *player = &players[turn % MAXPLAYERS];
+
+          double start = now ();
+          gather_slow (player);
+          slow_time += now () - start;
+
+          start = now ();
+          gather_fast (player);
+          fast_time += now () - start;
+
+          int legal = compare_moves (game, turn, &mismatches);
+          positions++;
+
+          if (legal == 0)
+            {
+              passes++;
+              continue;
+            }
+          passes = 0;
+          play_random_move (player, legal);
+        }
+    }
+
+  printf ("%d positions checked, %d mismatches\n", positions, mismatches);
+  printf ("all moves: board_check_piece %.1f us, bitboard %.1f us\n",
+          slow_time / positions / 1000.0, fast_time / positions / 1000.0);
+
+  return mismatches == 0 && total_orientations == 91 ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+/**
+ * Headless landgrab tournament between AI variants.
+ *
+ * Plays four-player games on the real board rules, seating a random mix of
+ * AI variants in every game. Each game seeds the random number generator
+ * from the tournament seed, so a run can be repeated exactly.
+ *
+ * The in-game difficulties play through ai.c. The other variants run the
+ * Hard AI's search with different weights, to try out tuning changes before
+ * they go into ai.c.
+ *
+ * Usage: tournament [games] [seed]
+ *
+ * Exits with an error if an AI ever picks a move the rules reject.
+ */
+
+#include "../../../ai.h"
+#include "../../../ai_search.h"
+#include "../../../board.h"
+#include "landgrab_host.h"
+
+#define DEFAULT_GAMES 2000
+#define DEFAULT_SEED 1
+
+typedef struct
+{
+  const char *name;
+  AiDiff difficulty;
+  // If set, run the search with these weights instead of going through ai.c
+  const AiWeights *weights;
+} AiVariant;
+
+static const AiWeights WEIGHTS_GREEDY = { .cells = 1 };
+static const AiWeights WEIGHTS_NO_BLOCKING = { .cells = 12, .corners = 3 };
+static const AiWeights WEIGHTS_BLOCKER = { .cells = 12, .corners = 3, .blocked = 10 };
+static const AiWeights WEIGHTS_MOBILITY = { .cells = 12, .corners = 8, .blocked = 4 };
+
+static const AiVariant VARIANTS[] = {
+  { "easy", DIFF_EASY, NULL },
+  { "medium", DIFF_MEDIUM, NULL },
+  { "hard", DIFF_HARD, NULL },
+  { "greedy", DIFF_HARD, &WEIGHTS_GREEDY },
+  { "no-blocking", DIFF_HARD, &WEIGHTS_NO_BLOCKING },
+  { "blocker", DIFF_HARD, &WEIGHTS_BLOCKER },
+  { "mobility", DIFF_HARD, &WEIGHTS_MOBILITY },
+};
+
+#define VARIANT_COUNT ARRAY_SIZE (VARIANTS)
+
+typedef struct
+{
+  int seats;
+  int wins;
+  int score;
+  int pieces;
+  int turns;
+  uint64_t decision_us;
+  uint64_t worst_turn_us;
+  uint64_t worst_frame_us;
+} VariantStats;
+
+static VariantStats stats[VARIANT_COUNT];
+static Player players[MAXPLAYERS];
+static AiSearch search;
+static int illegal_moves;
+
+/**
+ * One frame of a search variant's turn, the same as ai_try for Hard.
+ */
+static PlayerTurnResult
+search_try (Player *player)
+{
+  if (!ai_search_step (&search, AI_SEARCH_BUDGET_US))
+    {
+      return PLAYER_TURN_CONTINUE;
+    }
+
+  const AiSearchMove *best = &search.best;
+  if (best->orientation == NULL)
+    {
+      return PLAYER_TURN_PASS;
+    }
+
+  player_change_piece (player, best->orientation->piece_index);
+  memcpy (player->piece_buffer, best->orientation->cells,
+          sizeof (player->piece_buffer));
+  player_set_cursor (player, best->col - best->orientation->origin_col,
+                     best->row - best->orientation->origin_row);
+  if (!player_place_piece (player))
+    {
+      illegal_moves++;
+      return PLAYER_TURN_PASS;
+    }
+  return PLAYER_TURN_END;
+}
+
+/**
+ * Play one turn, frame by frame, like player_loop_ai does.
+ */
+static PlayerTurnResult
+play_turn (Player *player, const AiVariant *variant, bool passed,
+           VariantStats *variant_stats)
+{
+  if (passed)
+    {
+      // Same as the minigame: a player who passed keeps passing
+      return PLAYER_TURN_PASS;
+    }
+
+  if (variant->weights)
+    {
+      ai_search_begin (&search, board_get_claimed (), player->plynum,
+                       player->pieces_used, variant->weights);
+    }
+  else
+    {
+      host_aidifficulty = variant->difficulty;
+      ai_reset (player);
+    }
+
+  uint64_t turn_us = 0;
+  PlayerTurnResult result = PLAYER_TURN_CONTINUE;
+  while (result == PLAYER_TURN_CONTINUE)
+    {
+      uint64_t start = get_ticks_us ();
+      size_t pieces_left = player->pieces_left;
+      result = variant->weights ? search_try (player) : ai_try (player);
+      uint64_t frame_us = get_ticks_us () - start;
+
+      if (result == PLAYER_TURN_END && player->pieces_left == pieces_left)
+        {
+          // ai.c said it moved but the rules didn't take the piece
+          illegal_moves++;
+        }
+
+      turn_us += frame_us;
+      variant_stats->worst_frame_us
+          = MAX (variant_stats->worst_frame_us, frame_us);
+    }
+
+  variant_stats->turns++;
+  variant_stats->decision_us += turn_us;
+  variant_stats->worst_turn_us = MAX (variant_stats->worst_turn_us, turn_us);
+  return result;
+}
+
+/**
+ * Play a game to the end, returns how many pieces were placed.
+ */
+static int
+play_game (const size_t seats[MAXPLAYERS])
+{
+  board_init ();
+  PLAYER_FOREACH (p) { host_player_init (&players[p], p); }
+
+  bool passed[MAXPLAYERS] = { false };
+  int passed_count = 0;
+  int moves = 0;
+
+  for (int turn = 0; passed_count < MAXPLAYERS; turn++)
+    {
+      PlyNum p = turn % MAXPLAYERS;
+      PlayerTurnResult result = play_turn (&players[p], &VARIANTS[seats[p]],
+                                           passed[p], &stats[seats[p]]);
+      if (result == PLAYER_TURN_END)
+        {
+          moves++;
+        }
+      else if (!passed[p])
+        {
+          passed[p] = true;
+          passed_count++;
+        }
+    }
+
+  int best = INT32_MIN;
+  PLAYER_FOREACH (p) { best = MAX (best, players[p].score); }
+
+  PLAYER_FOREACH (p)
+  {
+    VariantStats *variant_stats = &stats[seats[p]];
+    variant_stats->seats++;
+    variant_stats->score += players[p].score;
+    variant_stats->pieces += PIECE_COUNT - players[p].pieces_left;
+    variant_stats->wins += players[p].score == best;
+  }
+
+  return moves;
+}
+
+int
+main (int argc, char **argv)
+{
+  int games = argc > 1 ? atoi (argv[1]) : DEFAULT_GAMES;
+  unsigned seed = argc > 2 ? strtoul (argv[2], NULL, 0) : DEFAULT_SEED;
+
+  bitboard_init ();
+
+  int moves = 0;
+  uint64_t start = get_ticks_us ();
+
+  for (int game = 0; game < games; game++)
+    {
+      srand (seed + game);
+      size_t seats[MAXPLAYERS];
+      PLAYER_FOREACH (p) { seats[p] = rand () % VARIANT_COUNT; }
+      moves += play_game (seats);
+    }
+
+  double seconds = (get_ticks_us () - start) / 1e6;
+
+  printf ("%d games, seed %u, %.1f s, %.0f moves/s\n", games, seed, seconds,
+          moves / seconds);
+  printf ("%-12s %6s %6s %7s %7s %11s %11s %11s\n", "variant", "seats",
+          "win%", "score", "pieces", "avg turn", "worst turn", "worst frame");
+
+  for (size_t i = 0; i < VARIANT_COUNT; i++)
+    {
+      const VariantStats *s = &stats[i];
+      int seats = MAX (s->seats, 1);
+      printf ("%-12s %6d %5.1f%% %7.2f %7.2f %8.1f us %8llu us %8llu us\n",
+              VARIANTS[i].name, s->seats, 100.0 * s->wins / seats,
+              (double)s->score / seats, (double)s->pieces / seats,
+              (double)s->decision_us / MAX (s->turns, 1),
+              (unsigned long long)s->worst_turn_us,
+              (unsigned long long)s->worst_frame_us);
+    }
+
+  if (illegal_moves)
+    {
+      printf ("FAIL: %d illegal moves\n", illegal_moves);
+      return 1;
+    }
+  return 0;
+}
@@ -609,133 +609,6 @@ static inline void AF_Physics_ResolveCollision(AF_Entity* _entityA, AF_Entity* _
 
 
 
-/*
-====================
-AF_PHYSICS_AABB_Test
-Calculate ray intersection hit test
-====================
-*/
-static inline BOOL AF_Physics_AABB_Test(AF_ECS* _ecs){
-	// TODO:
-	// implement cheaper nested for loop
-	/*
-	https://research.ncl.ac.uk/game/mastersdegree/gametechnologies/physicstutorials/4collisiondetection/Physics%20-%20Collision%20Detection.pdf
-	for int x = 0; x < lastObject ; ++ x {
-		for int y = x +1; y < lastObject ; ++ y ) {
-			if ( IsColliding (x , y )) {
-				ResolveCollision (x , y )
-			}
-		}
-	}
-	*/
-	BOOL returnValue = FALSE;
-	for(int i = 0; i < _ecs->entitiesCount; ++i){
-
-		if(AF_Component_GetEnabled(_ecs->colliders[i].enabled == FALSE)){
-			continue;
-		}
-		AF_Entity* entity1 = &_ecs->entities[i];
-		AF_CCollider* collider1 = entity1->collider;
-		
-		
-		// rayIntersectionTest everything
-		for(int x = 0; x < _ecs->entitiesCount; ++x){
-			if(AF_Component_GetEnabled(_ecs->colliders[x].enabled == FALSE)){
-				continue;
-			}
-
-			// check self
-			if(i == x){
-				continue;
-			}
-
-			AF_Entity* entity2 = &_ecs->entities[x];
-			AF_CCollider* collider2 = entity2->collider;
-		
-
-			Vec3* posA = &_ecs->transforms[i].pos;
-			Vec3* posB = &_ecs->transforms[x].pos;
-			Vec3 halfSizeA = Vec3_MULT_SCALAR(collider1->boundingVolume, .5f);
-			Vec3 halfSizeB = Vec3_MULT_SCALAR(collider2->boundingVolume, .5f);
-			//Vec3 halfSizeA = Vec3_DIV_SCALAR(collider1->boundingVolume, 2);
-			//Vec3 halfSizeB = Vec3_DIV_SCALAR(collider2->boundingVolume, 2);
-
-			//Vec3 scaledHalfSizeA = Vec3_MULT(halfSizeA, transform1->scale);
-			//Vec3 scaledHalfSizeB = Vec3_MULT(halfSizeB, transform2->scale);
-
-
-			Vec3 delta = Vec3_MINUS(*posA, *posB);
-			Vec3 totalSize = Vec3_ADD(halfSizeA, halfSizeB);
-			//Vec3 totalSize = Vec3_ADD(scaledHalfSizeA, scaledHalfSizeB);
-
-			if(
-				abs(delta.x) < totalSize.x  &&
-				abs(delta.y) < totalSize.y && 
-				abs(delta.z) < totalSize.z){
-
-					// TODO: determine from what direction the collision occurs
-					//ResolveCollision(_ecs, i, x);
-					returnValue = TRUE;
-					// Resolve collision
-					//AF_PHYSICS_CUBE_COLLISION_FACES
-					// Get the min and max of each cube
-					Vec3 maxA = Vec3_ADD(collider1->pos, collider1->boundingVolume);
-					Vec3 minA = Vec3_MINUS(collider1->pos, collider1->boundingVolume);
-
-					Vec3 maxB = Vec3_ADD(collider2->pos, collider2->boundingVolume);
-					Vec3 minB = Vec3_MINUS(collider2->pos, collider2->boundingVolume);
-
-					int facesCount = 6;
-					float distances [facesCount];
-					
-						 distances[0] = maxB.x - minA.x; // distance of box ’b ’ to ’ left ’ of ’a ’.
-						 distances[1] = maxA.x - minB.x; // distance of box ’b ’ to ’ right ’ of ’a ’.
-						 distances[2] = maxB.y - minA.y; // distance of box ’b ’ to ’ bottom ’ of ’a ’.
-						 distances[3] = maxA.y - minB.y; // distance of box ’b ’ to ’ top ’ of ’a ’.
-						 distances[4] = maxB.z - minA.z; // distance of box ’b ’ to ’ far ’ of ’a ’.
-						 distances[5] = maxA.z - minB.z;  // distance of box ’b ’ to ’ near ’ of ’a ’.
-					
-					//TODO: where is __FLT_MAX__ defined? may not be portable
-					float penetration = __FLT_MAX__;
-					Vec3 bestAxis = {0,0,0};	// default value
-					for(int j = 0; j < facesCount; ++j){
-						if(distances[j] < penetration){
-							penetration = distances[j];
-							bestAxis = AF_PHYSICS_CUBE_COLLISION_FACES[j]; 
-						}
-					}
-
-					// create a new collision struct
-					AF_Collision collision1 = {returnValue, entity1, entity2, collider1->collision.callback, {0,0,0}, 0.0f, bestAxis, penetration}; 
-					// TODO: i think the bestAxis should be inverted for the second object
-					AF_Collision collision2 = {returnValue, entity2, entity1, collider2->collision.callback, {0,0,0}, 0.0f, Vec3_MULT_SCALAR(bestAxis, -1), penetration}; 
-					
-					// copy the new struct values to each collider
-					collider1->collision = collision1;
-					collider2->collision = collision2;
-
-					// TODO: move this outside the core rendering loop
-					collider1->collision.callback(&collider1->collision);
-					collider2->collision.callback(&collider2->collision);
-
-					// Apply collision resolution
-					//AF_CTransform3D* transform1 = &_ecs->transforms[i];
-					//AF_CTransform3D* transform2 = &_ecs->transforms[x];
-
-					//AF_C3DRigidbody* rigidbody1 = &_ecs->rigidbodies[i];
-					//AF_C3DRigidbody* rigidbody2 = &_ecs->rigidbodies[x];
-					// don't apply force for kinematic objects
-					if(_ecs->entities[i].rigidbody->isKinematic){
-						continue;
-					}
-					AF_Physics_ResolveCollision(entity1, entity2, &collision1);
-			}
-		}
-	}
-		
-	return returnValue;
-}
-
 //=======BROAD / NARROW PHASE========
 
 /*
@@ -747,90 +620,253 @@ AF_Physics_BroadPhase
 AF_Physics_NarrowPhase
 */
 
-/**/
+// Every pair of entities can be reported at most once
+#define AF_PHYSICS_MAX_PAIRS ((AF_ECS_TOTAL_ENTITIES * (AF_ECS_TOTAL_ENTITIES - 1)) / 2)
+// The narrow phase compares abs() of the distance, which truncates to an int,
+// so boxes up to one unit apart still collide. Pad the broadphase bounds to match.
+#define AF_PHYSICS_BROADPHASE_MARGIN 0.5f
+
+/*
+====================
+AF_Physics_Pair
+Potentially colliding entities, entity1 is always the lowest index
+====================
+*/
+typedef struct {
+	uint16_t entity1;
+	uint16_t entity2;
+} AF_Physics_Pair;
+
+/*
+====================
+AF_Physics_BroadPhaseState
+Sort and sweep state. The entities stay sorted along x between frames,
+so re-sorting after small movements is close to linear.
+====================
+*/
+typedef struct {
+	uint32_t sortedCount;
+	uint16_t sorted[AF_ECS_TOTAL_ENTITIES];
+	Vec3 min[AF_ECS_TOTAL_ENTITIES];
+	Vec3 max[AF_ECS_TOTAL_ENTITIES];
+	uint32_t pairsCount;
+	AF_Physics_Pair pairs[AF_PHYSICS_MAX_PAIRS];
+} AF_Physics_BroadPhaseState;
+
+/*
+====================
+AF_Physics_BroadPhase_Init
+Reset the sort and sweep state
+====================
+*/
+static inline void AF_Physics_BroadPhase_Init(AF_Physics_BroadPhaseState* _state){
+	_state->sortedCount = 0;
+	_state->pairsCount = 0;
+}
+
+/*
+====================
+AF_Physics_UpdateBroadphaseAABB
+Store the half size of the collider, every collider is tested as a box
+====================
+*/
 static inline void AF_Physics_UpdateBroadphaseAABB(AF_CCollider* _collider){
-	if(_collider->type == AABB){
-		Vec3 boundingVolumeHalfDimensions = {_collider->boundingVolume.x/2.0f, _collider->boundingVolume.y/2.0f, _collider->boundingVolume.z/2.0f};
-		_collider->broadphaseAABB = boundingVolumeHalfDimensions;
-	}
+	Vec3 boundingVolumeHalfDimensions = {_collider->boundingVolume.x/2.0f, _collider->boundingVolume.y/2.0f, _collider->boundingVolume.z/2.0f};
+	_collider->broadphaseAABB = boundingVolumeHalfDimensions;
 }
 
 /*
-static void AF_Physics_BroadPhase(AF_ECS* _ecs){
-	// TODO: broadphaseCollisions.clear();
-	Vec2 treeSize = {1024, 1024};
-	//QuadTree tree;
+====================
+AF_Physics_PairCompare
+qsort comparison, orders the pairs the same way the old nested loop visited them
+====================
+*/
+static inline int AF_Physics_PairCompare(const void* _a, const void* _b){
+	const AF_Physics_Pair* pairA = (const AF_Physics_Pair*)_a;
+	const AF_Physics_Pair* pairB = (const AF_Physics_Pair*)_b;
+	uint32_t keyA = ((uint32_t)pairA->entity1 << 16) | pairA->entity2;
+	uint32_t keyB = ((uint32_t)pairB->entity1 << 16) | pairB->entity2;
+	return (keyA > keyB) - (keyA < keyB);
+}
 
-	for(int i = 0; i < _ecs->entitiesCount; ++i){
-		Vec3 halfSizes;
+/*
+====================
+AF_Physics_BroadPhase
+Sort and sweep along x, fill the state with each overlapping pair once
+====================
+*/
+static inline void AF_Physics_BroadPhase(AF_ECS* _ecs, AF_Physics_BroadPhaseState* _state){
+	// add entities we haven't seen yet, the insertion sort below will place them
+	while(_state->sortedCount < _ecs->entitiesCount){
+		_state->sorted[_state->sortedCount] = _state->sortedCount;
+		_state->sortedCount++;
+	}
 
-		Vec3 pos = _ecs->transforms[i].pos;
-		//QuadTree_Node* node = {NULL, 1, {pos.x, pos.y}, {halfSizes.x, halfSizes.y}, NULL};
-		
-		// Insert into our quad tree the node, its position and its half size bounds
-		//AF_QuadTree_Insert(node, &_ecs->entities[i], &pos, &halfSizes, 7, 6);
-		// TODO: actually insert into the quad tree
-		//AF_QuadTree_Insert()
+	// update the bounds
+	Vec3 margin = {AF_PHYSICS_BROADPHASE_MARGIN, AF_PHYSICS_BROADPHASE_MARGIN, AF_PHYSICS_BROADPHASE_MARGIN};
+	for(uint32_t i = 0; i < _state->sortedCount; ++i){
+		AF_CCollider* collider = &_ecs->colliders[i];
+		AF_Physics_UpdateBroadphaseAABB(collider);
+		Vec3 halfSize = Vec3_ADD(collider->broadphaseAABB, margin);
+		_state->min[i] = Vec3_MINUS(_ecs->transforms[i].pos, halfSize);
+		_state->max[i] = Vec3_ADD(_ecs->transforms[i].pos, halfSize);
+	}
 
-		// determine what objects may be colliding.
-		
-		tree.OperateOnContents([&](std::list < QuadTreeEntry < GameObject * > >& data ) {
-		 CollisionInfo info ;
-		
-		for ( auto i = data . begin (); i != data . end (); ++ i ) {
-			for ( auto j = std :: next ( i ); j != data . end (); ++ j ) {
-		// is this pair of items already in the collision set -
-		// if the same pair is in another quadtree node together etc
-		info.a = min ((* i ).object , (* j ).object );
-		info.b = max ((* i ).object , (* j ).object );
-		broadphaseCollisions.insert ( info );
-		
+	// insertion sort on min x, entities barely move between frames
+	for(uint32_t i = 1; i < _state->sortedCount; ++i){
+		uint16_t entity = _state->sorted[i];
+		float minX = _state->min[entity].x;
+		int j = i - 1;
+		while(j >= 0 && _state->min[_state->sorted[j]].x > minX){
+			_state->sorted[j + 1] = _state->sorted[j];
+			--j;
+		}
+		_state->sorted[j + 1] = entity;
+	}
 
+	// sweep
+	_state->pairsCount = 0;
+	for(uint32_t i = 0; i < _state->sortedCount; ++i){
+		uint16_t entity1 = _state->sorted[i];
+		if(AF_Component_GetHas(_ecs->colliders[entity1].enabled) == FALSE){
+			continue;
+		}
+		Vec3 min1 = _state->min[entity1];
+		Vec3 max1 = _state->max[entity1];
+		for(uint32_t x = i + 1; x < _state->sortedCount; ++x){
+			uint16_t entity2 = _state->sorted[x];
+			Vec3 min2 = _state->min[entity2];
+			// everything after this starts past our right edge
+			if(min2.x >= max1.x){
+				break;
+			}
+			if(AF_Component_GetHas(_ecs->colliders[entity2].enabled) == FALSE){
+				continue;
+			}
+			Vec3 max2 = _state->max[entity2];
+			if(min1.y < max2.y && min2.y < max1.y && min1.z < max2.z && min2.z < max1.z){
+				AF_Physics_Pair* pair = &_state->pairs[_state->pairsCount++];
+				pair->entity1 = entity1 < entity2 ? entity1 : entity2;
+				pair->entity2 = entity1 < entity2 ? entity2 : entity1;
+			}
+		}
 	}
+
+	qsort(_state->pairs, _state->pairsCount, sizeof(AF_Physics_Pair), AF_Physics_PairCompare);
 }
 
+/*
+====================
+AF_Physics_AABB_Collide
+Exact box test between two entities, fills in the collision as seen from the first entity
+====================
 */
+static inline BOOL AF_Physics_AABB_Collide(AF_ECS* _ecs, int _entity1, int _entity2, AF_Collision* _collision){
+	AF_Entity* entity1 = &_ecs->entities[_entity1];
+	AF_Entity* entity2 = &_ecs->entities[_entity2];
+	AF_CCollider* collider1 = entity1->collider;
+	AF_CCollider* collider2 = entity2->collider;
+
+	Vec3* posA = &_ecs->transforms[_entity1].pos;
+	Vec3* posB = &_ecs->transforms[_entity2].pos;
+	Vec3 halfSizeA = Vec3_MULT_SCALAR(collider1->boundingVolume, .5f);
+	Vec3 halfSizeB = Vec3_MULT_SCALAR(collider2->boundingVolume, .5f);
+
+	Vec3 delta = Vec3_MINUS(*posA, *posB);
+	Vec3 totalSize = Vec3_ADD(halfSizeA, halfSizeB);
+
+	if(!(abs(delta.x) < totalSize.x  &&
+		abs(delta.y) < totalSize.y && 
+		abs(delta.z) < totalSize.z)){
+		return FALSE;
+	}
 
-// Function to compare two CollisionInfo objects based on their hashes
-static inline BOOL AF_Physics_CollisionInfoLessThan(const AF_Collision* info1, const AF_Collision* info2) {
-    // Calculate hash for the first CollisionInfo
-    size_t hash1 = (size_t)info1->entity1 + ((size_t)info1->entity2 << 8);
-    // Calculate hash for the second CollisionInfo
-    size_t hash2 = (size_t)info2->entity1 + ((size_t)info2->entity2 << 8);
+	// Get the min and max of each cube
+	Vec3 maxA = Vec3_ADD(collider1->pos, collider1->boundingVolume);
+	Vec3 minA = Vec3_MINUS(collider1->pos, collider1->boundingVolume);
 
-    // Return true if the hash of info1 is less than that of info2
-    return (hash1 < hash2);
-}
+	Vec3 maxB = Vec3_ADD(collider2->pos, collider2->boundingVolume);
+	Vec3 minB = Vec3_MINUS(collider2->pos, collider2->boundingVolume);
 
+	int facesCount = 6;
+	float distances [facesCount];
+	
+	distances[0] = maxB.x - minA.x; // distance of box ’b ’ to ’ left ’ of ’a ’.
+	distances[1] = maxA.x - minB.x; // distance of box ’b ’ to ’ right ’ of ’a ’.
+	distances[2] = maxB.y - minA.y; // distance of box ’b ’ to ’ bottom ’ of ’a ’.
+	distances[3] = maxA.y - minB.y; // distance of box ’b ’ to ’ top ’ of ’a ’.
+	distances[4] = maxB.z - minA.z; // distance of box ’b ’ to ’ far ’ of ’a ’.
+	distances[5] = maxA.z - minB.z;  // distance of box ’b ’ to ’ near ’ of ’a ’.
+
+	//TODO: where is __FLT_MAX__ defined? may not be portable
+	float penetration = __FLT_MAX__;
+	Vec3 bestAxis = {0,0,0};	// default value
+	for(int j = 0; j < facesCount; ++j){
+		if(distances[j] < penetration){
+			penetration = distances[j];
+			bestAxis = AF_PHYSICS_CUBE_COLLISION_FACES[j]; 
+		}
+	}
 
+	AF_Collision collision = {TRUE, entity1, entity2, collider1->collision.callback, {0,0,0}, 0.0f, bestAxis, penetration};
+	*_collision = collision;
+	return TRUE;
+}
 
-// Function to handle narrow phase collision detection
-static inline void AF_Physics_NarrowPhase(AF_Collision* broadPhaseCollisions, size_t collisionCount, int numCollisionFrames) {
-    //AF_Collision allCollisions[1024]; // Example array to store all collisions
-    //size_t allCollisionsCount = 0;       // Counter for all collisions
+/*
+====================
+AF_Physics_NarrowPhase
+Run the exact test on the broadphase pairs, then fire the callbacks and resolve each collision
+====================
+*/
+static inline BOOL AF_Physics_NarrowPhase(AF_ECS* _ecs, const AF_Physics_BroadPhaseState* _state){
+	BOOL returnValue = FALSE;
+	for(uint32_t i = 0; i < _state->pairsCount; ++i){
+		int index1 = _state->pairs[i].entity1;
+		int index2 = _state->pairs[i].entity2;
 
-    // Iterate through the broad phase collisions
-    //for (size_t i = 0; i < collisionCount; ++i) {
-        //AF_Collision info = broadPhaseCollisions[i];
+		AF_Collision collision1;
+		if(AF_Physics_AABB_Collide(_ecs, index1, index2, &collision1) == FALSE){
+			continue;
+		}
+		returnValue = TRUE;
 
-        // Check if the objects intersect
-		// TODO: implement this
-		/*
-        if (ObjectIntersection(info.entity2, info.entity1, &info)) {
-			//TODO: implement framesLeft
-            //info.framesLeft = numCollisionFrames; // Set frames left
-            ImpulseResolveCollision(info.entity1, info.entity2, info.collisionPoint); // Resolve collision
-            allCollisions[allCollisionsCount++] = info; // Store collision info
-        }*/
-    //}
+		AF_Entity* entity1 = &_ecs->entities[index1];
+		AF_Entity* entity2 = &_ecs->entities[index2];
+		AF_CCollider* collider1 = entity1->collider;
+		AF_CCollider* collider2 = entity2->collider;
 
-    // Optionally, you can print or process allCollisions here
-    //printf("Total collisions: %zu\n", allCollisionsCount);
-}
+		// the second object sees the same collision from the other side
+		AF_Collision collision2 = {TRUE, entity2, entity1, collider2->collision.callback, {0,0,0}, 0.0f, Vec3_MULT_SCALAR(collision1.normal, -1), collision1.penetration};
 
+		// copy the new struct values to each collider
+		collider1->collision = collision1;
+		collider2->collision = collision2;
 
+		collider1->collision.callback(&collider1->collision);
+		collider2->collision.callback(&collider2->collision);
 
+		// don't apply force for kinematic objects
+		if(!entity1->rigidbody->isKinematic){
+			AF_Physics_ResolveCollision(entity1, entity2, &collision1);
+		}
+		if(!entity2->rigidbody->isKinematic){
+			AF_Physics_ResolveCollision(entity2, entity1, &collision2);
+		}
+	}
+	return returnValue;
+}
 
+/*
+====================
+AF_PHYSICS_AABB_Test
+Collision test of all entities against each other
+====================
+*/
+static inline BOOL AF_Physics_AABB_Test(AF_ECS* _ecs, AF_Physics_BroadPhaseState* _state){
+	AF_Physics_BroadPhase(_ecs, _state);
+	return AF_Physics_NarrowPhase(_ecs, _state);
+}
 
 //=================
 
@@ -10,11 +10,57 @@ New AF_ECS struct objects can be created to hold the entities for each scene.
 #ifndef AF_ECS_H
 #define AF_ECS_H
 #include <stdio.h>
+#include <string.h>
+#include <stdint.h>
 #include <assert.h>
 #include "AF_Entity.h"
 #include "ECS/Components/AF_Component.h"
 
+#ifndef AF_ECS_TOTAL_ENTITIES
 #define AF_ECS_TOTAL_ENTITIES 65
+#endif
+
+// 32 entities per bitset word
+#define AF_ECS_BITSET_WORDS ((AF_ECS_TOTAL_ENTITIES + 31) / 32)
+
+/*
+====================
+AF_ECS_ComponentType
+Bit index of each component type in the presence and enabled bitsets
+and in the masks used to query views
+====================
+*/
+enum AF_ECS_ComponentType {
+    AF_ECS_TRANSFORM = 0,
+    AF_ECS_RIGIDBODY,
+    AF_ECS_COLLIDER,
+    AF_ECS_SPRITE,
+    AF_ECS_ANIMATION,
+    AF_ECS_MESH,
+    AF_ECS_TEXT,
+    AF_ECS_AUDIOSOURCE,
+    AF_ECS_PLAYERDATA,
+    AF_ECS_SKELETALANIMATION,
+    AF_ECS_AIBEHAVIOUR,
+    AF_ECS_COMPONENT_COUNT
+};
+
+#define AF_ECS_MASK(_componentType) ((uint32_t)1 << (_componentType))
+
+/*
+====================
+AF_ECS_View
+Dense list of the entities matching a combination of components.
+Rebuilt from the bitsets only when the components changed since the last update.
+====================
+*/
+typedef struct {
+    uint32_t hasMask;           // components the entities must have
+    uint32_t enabledMask;       // components that must also be enabled
+    uint32_t version;           // componentsVersion the list was built from
+    uint32_t count;
+    uint16_t indices[AF_ECS_TOTAL_ENTITIES];
+} AF_ECS_View;
 
 /*
 ====================
@@ -50,6 +96,11 @@ typedef struct {
 	AF_CSkeletalAnimation skeletalAnimations[AF_ECS_TOTAL_ENTITIES];
 	AF_CAI_Behaviour aiBehaviours[AF_ECS_TOTAL_ENTITIES];
         #endif
+
+    // Component bitsets, one bit per entity, kept up to date by the AF_ECS_SetComponent functions
+    uint32_t componentsVersion;
+    uint32_t hasBits[AF_ECS_COMPONENT_COUNT][AF_ECS_BITSET_WORDS];
+    uint32_t enabledBits[AF_ECS_COMPONENT_COUNT][AF_ECS_BITSET_WORDS];
 } AF_ECS;
 
 /*
@@ -138,6 +189,141 @@ static inline void AF_ECS_Init(AF_ECS* _ecs){
 		#endif
 	}
 	_ecs->entitiesCount = AF_ECS_TOTAL_ENTITIES;
+
+	// nothing has components yet, bump the version so views built for a previous scene rebuild
+	_ecs->componentsVersion++;
+	memset(_ecs->hasBits, 0, sizeof(_ecs->hasBits));
+	memset(_ecs->enabledBits, 0, sizeof(_ecs->enabledBits));
+}
+
+/*
+====================
+AF_ECS_GetComponentFlags
+Get the has/enabled flags of one component of an entity
+====================
+*/
+static inline flag_t* AF_ECS_GetComponentFlags(AF_ECS* _ecs, enum AF_ECS_ComponentType _componentType, uint32_t _index){
+	switch(_componentType){
+		case AF_ECS_TRANSFORM:			return &_ecs->transforms[_index].enabled;
+		case AF_ECS_RIGIDBODY:			return &_ecs->rigidbodies[_index].enabled;
+		case AF_ECS_COLLIDER:			return &_ecs->colliders[_index].enabled;
+		case AF_ECS_SPRITE:				return &_ecs->sprites[_index].enabled;
+		#ifndef PLATFORM_GB
+		case AF_ECS_ANIMATION:			return &_ecs->animations[_index].enabled;
+		case AF_ECS_MESH:				return &_ecs->meshes[_index].enabled;
+		case AF_ECS_TEXT:				return &_ecs->texts[_index].enabled;
+		case AF_ECS_AUDIOSOURCE:		return &_ecs->audioSources[_index].enabled;
+		case AF_ECS_PLAYERDATA:			return &_ecs->playerDatas[_index].enabled;
+		case AF_ECS_SKELETALANIMATION:	return &_ecs->skeletalAnimations[_index].enabled;
+		case AF_ECS_AIBEHAVIOUR:		return &_ecs->aiBehaviours[_index].enabled;
+		#endif
+		default:						return NULL;
+	}
+}
+
+/*
+====================
+AF_ECS_SyncComponent
+Copy the has/enabled flags of one component of an entity into the bitsets.
+Bumps the version only if they changed, so views rebuild on their next update.
+Call after assigning a whole component, e.g. *entity->mesh = AF_CMesh_ADD();
+====================
+*/
+static inline void AF_ECS_SyncComponent(AF_ECS* _ecs, AF_Entity* _entity, enum AF_ECS_ComponentType _componentType){
+	assert(_entity >= _ecs->entities && _entity < _ecs->entities + AF_ECS_TOTAL_ENTITIES && "AF_ECS_SyncComponent: entity is not in this ecs");
+	uint32_t index = (uint32_t)(_entity - _ecs->entities);
+	flag_t* flags = AF_ECS_GetComponentFlags(_ecs, _componentType, index);
+	if(flags == NULL){
+		return;
+	}
+
+	uint32_t bit = (uint32_t)1 << (index & 31);
+	uint32_t* hasWord = &_ecs->hasBits[_componentType][index >> 5];
+	uint32_t* enabledWord = &_ecs->enabledBits[_componentType][index >> 5];
+	uint32_t hasBit = AF_Component_GetHas(*flags) == TRUE ? bit : 0;
+	uint32_t enabledBit = AF_Component_GetEnabled(*flags) == TRUE ? bit : 0;
+	if((*hasWord & bit) == hasBit && (*enabledWord & bit) == enabledBit){
+		return;
+	}
+	*hasWord = (*hasWord & ~bit) | hasBit;
+	*enabledWord = (*enabledWord & ~bit) | enabledBit;
+	_ecs->componentsVersion++;
+}
+
+/*
+====================
+AF_ECS_SetComponentHas
+Add or remove a component of an entity, keeping the bitsets up to date
+====================
+*/
+static inline void AF_ECS_SetComponentHas(AF_ECS* _ecs, AF_Entity* _entity, enum AF_ECS_ComponentType _componentType, BOOL _state){
+	flag_t* flags = AF_ECS_GetComponentFlags(_ecs, _componentType, (uint32_t)(_entity - _ecs->entities));
+	*flags = AF_Component_SetHas(*flags, _state);
+	AF_ECS_SyncComponent(_ecs, _entity, _componentType);
+}
+
+/*
+====================
+AF_ECS_SetComponentEnabled
+Enable or disable a component of an entity, keeping the bitsets up to date
+====================
+*/
+static inline void AF_ECS_SetComponentEnabled(AF_ECS* _ecs, AF_Entity* _entity, enum AF_ECS_ComponentType _componentType, BOOL _state){
+	flag_t* flags = AF_ECS_GetComponentFlags(_ecs, _componentType, (uint32_t)(_entity - _ecs->entities));
+	*flags = AF_Component_SetEnabled(*flags, _state);
+	AF_ECS_SyncComponent(_ecs, _entity, _componentType);
+}
+
+// Static initialiser for views, same as AF_ECS_View_Init
+#define AF_ECS_VIEW(_hasMask, _enabledMask) { .hasMask = (_hasMask), .enabledMask = (_enabledMask), .version = UINT32_MAX, .count = 0 }
+
+/*
+====================
+AF_ECS_View_Init
+Setup a view on the entities having all the components in _hasMask,
+with the ones in _enabledMask also enabled. e.g.
+AF_ECS_View_Init(&view, AF_ECS_MASK(AF_ECS_MESH) | AF_ECS_MASK(AF_ECS_SKELETALANIMATION), AF_ECS_MASK(AF_ECS_MESH));
+====================
+*/
+static inline void AF_ECS_View_Init(AF_ECS_View* _view, uint32_t _hasMask, uint32_t _enabledMask){
+	_view->hasMask = _hasMask;
+	_view->enabledMask = _enabledMask;
+	// never matches a real version, the first update builds the list
+	_view->version = UINT32_MAX;
+	_view->count = 0;
+}
+
+/*
+====================
+AF_ECS_View_Update
+Rebuild the view's entity list if the components changed
+====================
+*/
+static inline void AF_ECS_View_Update(AF_ECS* _ecs, AF_ECS_View* _view){
+	if(_view->version == _ecs->componentsVersion){
+		return;
+	}
+	_view->version = _ecs->componentsVersion;
+	_view->count = 0;
+
+	for(uint32_t word = 0; word < AF_ECS_BITSET_WORDS; ++word){
+		uint32_t bits = UINT32_MAX;
+		for(int type = 0; type < AF_ECS_COMPONENT_COUNT; ++type){
+			if(_view->hasMask & AF_ECS_MASK(type)){
+				bits &= _ecs->hasBits[type][word];
+			}
+			if(_view->enabledMask & AF_ECS_MASK(type)){
+				bits &= _ecs->enabledBits[type][word];
+			}
+		}
+		while(bits != 0){
+			uint32_t index = (word << 5) + __builtin_ctz(bits);
+			bits &= bits - 1;
+			if(index < _ecs->entitiesCount){
+				_view->indices[_view->count++] = index;
+			}
+		}
+	}
 }
 
 /*
@@ -169,6 +355,7 @@ static inline AF_Entity* AF_ECS_CreateEntity(AF_ECS* _ecs){
     #else
     *entity->transform = AF_CTransform3D_ADD();
     #endif
+    AF_ECS_SyncComponent(_ecs, entity, AF_ECS_TRANSFORM);
 
     if(entity == NULL){
 		printf("AF_ECS: AF_ECS_CreateEntity failed, and is returining a null entity\n");
@@ -10,6 +10,12 @@ n64 implementation of AF_Physics
 
 float collisionColor[4] = {255,0, 0, 1};
 
+// Sort and sweep state, kept between frames
+static AF_Physics_BroadPhaseState broadPhaseState;
+// Entities with an enabled rigidbody, and entities with a collider
+static AF_ECS_View rigidbodyView = AF_ECS_VIEW(AF_ECS_MASK(AF_ECS_RIGIDBODY), AF_ECS_MASK(AF_ECS_RIGIDBODY));
+static AF_ECS_View colliderView = AF_ECS_VIEW(AF_ECS_MASK(AF_ECS_COLLIDER), 0);
+
 /*
 ====================
 AF_Physics_Init
@@ -21,24 +27,7 @@ void AF_Physics_Init(AF_ECS* _ecs){
 	debugf("Physics_Init: \n");
 
 	// Setup Broadphase physics
-	/*
-	AF_Physics_UpdateBroadphaseAABB
-	||
-	AF_Physics_BroadPhase
-	||
-	AF_Physics_NarrowPhase
-	
-	for(int i = 0; i < _ecs->entitiesCount; ++i){
-		//AF_Physics_UpdateBroadphaseAABB(&_ecs->colliders[i]);
-	}
-
-	//AF_Physics_BroadPhase(_ecs);
-
-	for(int i = 0; i < _ecs->entitiesCount; ++i){
-		//AF_Physics_NarrowPhase(&_ecs->colliders[i].collision, _ecs->entitiesCount, 1);
-	}*/
-	
-
+	AF_Physics_BroadPhase_Init(&broadPhaseState);
 }
 
 
@@ -50,34 +39,36 @@ Implementation of update
 */
 void AF_Physics_Update(AF_ECS* _ecs, const float _dt){
 	assert(_ecs != NULL && "Physics: AF_Physics_Update pass in a null reference\n");
-	// loop through and update all transforms based on their velocities
-	for(int i = 0; i < _ecs->entitiesCount; ++i){
-	AF_CTransform3D* transform = &_ecs->transforms[i];
-
-	AF_CTransform3D* parentTransform =_ecs->entities[i].parentTransform;
-	// make sure the position matches the parent if we have one
-	if(_ecs->entities[i].parentTransform != NULL){
-		transform->pos = Vec3_ADD(parentTransform->pos, transform->localPos);
-		transform->scale = Vec3_MULT(parentTransform->scale, transform->localScale);
-		transform->rot = Vec3_ADD(parentTransform->rot, transform->localRot);
-	}
-	AF_C3DRigidbody* rigidbody = &_ecs->rigidbodies[i];
-	if((AF_Component_GetHas(rigidbody->enabled) == TRUE) && (AF_Component_GetEnabled(rigidbody->enabled) == TRUE)){
-		
-	
-		
+	// update the transforms of enabled rigidbodies based on their velocities
+	AF_ECS_View_Update(_ecs, &rigidbodyView);
+	for(int i = 0; i < rigidbodyView.count; ++i){
+		const uint16_t index = rigidbodyView.indices[i];
+		AF_C3DRigidbody* rigidbody = &_ecs->rigidbodies[index];
 		//debgf("Physics: upate: velocity x: %f y: %f z: %f\n", rigidbody->velocity.x, rigidbody->velocity.y, rigidbody->velocity.z);
 		// if the object isn't static
 		if(rigidbody->inverseMass > 0 || rigidbody->isKinematic == TRUE){
 				AF_Physics_IntegrateAccell(rigidbody, _dt);
-				AF_Physics_IntegrateVelocity(transform, rigidbody, _dt);
+				AF_Physics_IntegrateVelocity(&_ecs->transforms[index], rigidbody, _dt);
 		}
+	}
 
-		}
+	// make sure the position matches the parent if we have one
+	for(int i = 0; i < _ecs->entitiesCount; ++i){
+	AF_CTransform3D* parentTransform =_ecs->entities[i].parentTransform;
+	if(parentTransform != NULL){
+		AF_CTransform3D* transform = &_ecs->transforms[i];
+		transform->pos = Vec3_ADD(parentTransform->pos, transform->localPos);
+		transform->scale = Vec3_MULT(parentTransform->scale, transform->localScale);
+		transform->rot = Vec3_ADD(parentTransform->rot, transform->localRot);
+	}
+	}
 
-		AF_CCollider* collider = &_ecs->colliders[i];
+	AF_ECS_View_Update(_ecs, &colliderView);
+	for(int i = 0; i < colliderView.count; ++i){
+		const uint16_t index = colliderView.indices[i];
+		AF_CCollider* collider = &_ecs->colliders[index];
 		// update the bounds position
-		collider->pos = _ecs->transforms[i].pos;
+		collider->pos = _ecs->transforms[index].pos;
 		// clear all collsision except keep the callback
 		AF_Collision clearedCollision = {FALSE, NULL, NULL, collider->collision.callback, {0,0,0}, 0.0f, {0,0,0}, 0};
 		collider->collision = clearedCollision;
@@ -94,11 +85,8 @@ void AF_Physics_LateUpdate(AF_ECS* _ecs){
 	assert(_ecs != NULL && "Physics: AF_Physics_LateUpdate pass in a null reference\n");
 
 	// Do collision tests
-	AF_Physics_AABB_Test(_ecs);
-
-	// call the collision pairs
-
-	// Resolve collision between two objects
+	// broadphase pairs are passed to the narrow phase which calls the callbacks and resolves the collisions
+	AF_Physics_AABB_Test(_ecs, &broadPhaseState);
 }
 
 /*
@@ -46,6 +46,9 @@ static float fov = 45.0f; // Initial field of view
 
 // TODO: i dont like this
 static T3DModel *models[MODEL_COUNT];
+// Entities with an enabled mesh, and those that also have a uv scrolling animation
+static AF_ECS_View meshView = AF_ECS_VIEW(AF_ECS_MASK(AF_ECS_MESH), AF_ECS_MASK(AF_ECS_MESH));
+static AF_ECS_View scrollingMeshView = AF_ECS_VIEW(AF_ECS_MASK(AF_ECS_MESH) | AF_ECS_MASK(AF_ECS_ANIMATION), AF_ECS_MASK(AF_ECS_MESH));
 T3DAnim animIdles[AF_ECS_TOTAL_ENTITIES];
 T3DAnim animWalks[AF_ECS_TOTAL_ENTITIES];
 T3DAnim animAttacks[AF_ECS_TOTAL_ENTITIES];
@@ -60,6 +63,21 @@ const char* attackPath = "Attack";
 // we need a seperate skelton anim for each skeleton
 T3DSkeleton skeletons[AF_ECS_TOTAL_ENTITIES];
 T3DSkeleton skeletonBlends[AF_ECS_TOTAL_ENTITIES];
+// skeletons further than this outside the view frustum skip their bone matrix update.
+// in world units, scaled by the entity scale. generous as the models are authored at ~1/SCENE_MODEL_SCALE_FACTOR
+#define RENDERER_SKELETON_CULL_RADIUS 250.0f
+
+// ============ MODEL MATRICES ===============
+// Transform each model matrix was last built from.
+// Transforms are written directly all over the game, so rather than flagging every write
+// the renderer compares against this and only rebuilds the matrices of entities that moved.
+typedef struct {
+    void* modelMatrix;  // matrix the snapshot was built into, a new matrix always rebuilds
+    Vec3 pos;
+    Vec3 rot;
+    Vec3 scale;
+} RendererMatrixSnapshot;
+static RendererMatrixSnapshot matrixSnapshots[AF_ECS_TOTAL_ENTITIES];
 
 // ============ PARTICLES ===============
 // TODO
@@ -91,6 +109,8 @@ typedef struct RendererDebugData {
     uint16_t entitiesCount;
     uint16_t totalMeshes;
     uint16_t totalTris;
+    uint16_t totalMatrixUpdates;
+    uint16_t totalSkeletonUpdates;
     float totalRenderTime;
     float totalEntityRenderTime;
 } RendererDebugData;
@@ -107,6 +127,7 @@ float deltaTime;
 void Renderer_RenderMesh(AF_CMesh* _mesh, AF_CTransform3D* _transform, float _dt);
 void Renderer_UpdateAnimations(AF_CSkeletalAnimation* _animation, float _dt);
 void Renderer_DebugCam();
+BOOL Renderer_UpdateModelMatrix(AF_CMesh* _mesh, AF_CTransform3D* _transform, int _i);
 /*=================
 AF_LoadTexture
 
@@ -254,6 +275,9 @@ void AF_Renderer_LateStart(AF_ECS* _ecs){
     int totalNormalMeshCommands = 0;
     int totalDrawCommands = 0;
 
+    // the model matrices are all (re)allocated below, so nothing is up to date
+    memset(matrixSnapshots, 0, sizeof(matrixSnapshots));
+
     // Load the skinned meshes, and setup memory
     for(int i=0; i<_ecs->entitiesCount; ++i) {
         AF_CMesh* mesh = &_ecs->meshes[i];
@@ -407,6 +431,33 @@ void AF_Renderer_LateStart(AF_ECS* _ecs){
     staticBufferList = rspq_block_end();
     
 }
+/*
+====================
+Renderer_UpdateModelMatrix
+Rebuild the mesh model matrix from the transform, only if the transform changed
+since the matrix was last built. Returns TRUE if it was rebuilt.
+====================
+*/
+BOOL Renderer_UpdateModelMatrix(AF_CMesh* _mesh, AF_CTransform3D* _transform, int _i){
+    RendererMatrixSnapshot* snapshot = &matrixSnapshots[_i];
+    if(snapshot->modelMatrix == _mesh->modelMatrix
+        && memcmp(&snapshot->pos, &_transform->pos, sizeof(Vec3)) == 0
+        && memcmp(&snapshot->rot, &_transform->rot, sizeof(Vec3)) == 0
+        && memcmp(&snapshot->scale, &_transform->scale, sizeof(Vec3)) == 0){
+        return FALSE;
+    }
+    snapshot->modelMatrix = _mesh->modelMatrix;
+    snapshot->pos = _transform->pos;
+    snapshot->rot = _transform->rot;
+    snapshot->scale = _transform->scale;
+
+    float pos[3] = {_transform->pos.x, _transform->pos.y, _transform->pos.z};
+    float rot[3]= {_transform->rot.x, _transform->rot.y, _transform->rot.z};
+    float scale[3] = {_transform->scale.x, _transform->scale.y, _transform->scale.z};
+    t3d_mat4fp_from_srt_euler((T3DMat4FP*)_mesh->modelMatrix,  scale, rot, pos);
+    return TRUE;
+}
+
 /*
 ====================
 AF_Renderer_Update
@@ -437,14 +488,15 @@ void AF_Renderer_Update(AF_ECS* _ecs, AF_Time* _time){
     // ======== Update Animations, and collect data about the mesh ======== //
     rendererDebugData.totalTris = 0;
     rendererDebugData.totalMeshes = 0;
+    rendererDebugData.totalMatrixUpdates = 0;
+    rendererDebugData.totalSkeletonUpdates = 0;
     
-   
-    for(int i = 0; i < _ecs->entitiesCount; ++i){
+    AF_ECS_View_Update(_ecs, &meshView);
+    for(int v = 0; v < meshView.count; ++v){
+        const int i = meshView.indices[v];
         // show debug
         AF_CMesh* mesh = &_ecs->meshes[i];
-        BOOL hasMesh = AF_Component_GetHas(_ecs->entities[i].mesh->enabled);
-        BOOL isEnabled = AF_Component_GetEnabled(_ecs->entities[i].mesh->enabled);
-        if((hasMesh == TRUE) && (isEnabled == TRUE) && mesh->meshType == AF_MESH_TYPE_MESH){
+        if(mesh->meshType == AF_MESH_TYPE_MESH){
             // update the total meshes and tris
             rendererDebugData.totalMeshes += 1;
             rendererDebugData.totalTris += models[mesh->meshID]->totalVertCount;
@@ -462,27 +514,28 @@ void AF_Renderer_Update(AF_ECS* _ecs, AF_Time* _time){
                 skeletalAnimation->animationSpeed = Vec3_MAGNITUDE(_ecs->rigidbodies[i].velocity);
                 
                 Renderer_UpdateAnimations( skeletalAnimation, _time->timeSinceLastFrame);
-                // this is expensive.
-                if(skeletalAnimation->skeleton != NULL){
+                // this is expensive, so only do it for skeletons that can be seen.
+                // the animations above keep playing, so the pose is right again as soon as it comes into view.
+                // uses the frustum from the last viewport attach, the camera doesn't move during play
+                AF_CTransform3D* transform = &_ecs->transforms[i];
+                float maxScale = fmaxf(fabsf(transform->scale.x), fmaxf(fabsf(transform->scale.y), fabsf(transform->scale.z)));
+                T3DVec3 center = {{transform->pos.x, transform->pos.y, transform->pos.z}};
+                if(skeletalAnimation->skeleton != NULL && t3d_frustum_vs_sphere(&viewport.viewFrustum, &center, RENDERER_SKELETON_CULL_RADIUS * maxScale)){
                     t3d_skeleton_update(skeletalAnimation->skeleton);
+                    rendererDebugData.totalSkeletonUpdates += 1;
                 }
                 
             }
    
             // ======== MODELS ========
-            // Update the mesh model matrix based on the entity transform.
-            AF_CTransform3D* entityTransform = &_ecs->transforms[i];
-            float pos[3] = {entityTransform->pos.x, entityTransform->pos.y, entityTransform->pos.z};
-            float rot[3]= {entityTransform->rot.x, entityTransform->rot.y, entityTransform->rot.z};
-            float scale[3] = {entityTransform->scale.x, entityTransform->scale.y, entityTransform->scale.z};
-
-            T3DMat4FP* meshMat = (T3DMat4FP*)mesh->modelMatrix;
-            
-            if(meshMat == NULL){
+            // Update the mesh model matrix based on the entity transform, if it moved.
+            if(mesh->modelMatrix == NULL){
                 debugf("AF_Renderer_T3D: AF_RenderUpdate modelsMat %i mesh ID %i mesh type %i is null\n",i, mesh->meshID, mesh->meshType);
                 continue;
             }
-            t3d_mat4fp_from_srt_euler(meshMat,  scale, rot, pos);
+            if(Renderer_UpdateModelMatrix(mesh, &_ecs->transforms[i], i) == TRUE){
+                rendererDebugData.totalMatrixUpdates += 1;
+            }
         
         }
     }
@@ -556,32 +609,27 @@ void AF_Renderer_Update(AF_ECS* _ecs, AF_Time* _time){
     // even though i tested with malloc_uncached values, so had to resort to this slow implementation similar to UV scrolling found in lava example
     //rspq_block_begin();
     
-    for(int i=0; i<_ecs->entitiesCount; ++i) {
+    AF_ECS_View_Update(_ecs, &scrollingMeshView);
+    for(int v = 0; v < scrollingMeshView.count; ++v) {
+        const int i = scrollingMeshView.indices[v];
         AF_CMesh* mesh = &_ecs->meshes[i];
         
-        //if((AF_Component_GetHas(mesh->enabled) == TRUE) && (AF_Component_GetEnabled(mesh->enabled) == TRUE) && mesh->meshType == AF_MESH_TYPE_MESH){
-        if((AF_Component_GetHas(mesh->enabled) == TRUE) && mesh->meshType == AF_MESH_TYPE_MESH){
+        if(mesh->meshType == AF_MESH_TYPE_MESH){
             AF_CAnimation* animation = _ecs->entities[i].animation;
-            BOOL hasMesh = AF_Component_GetHas(_ecs->entities[i].mesh->enabled);
-            BOOL isEnabled = AF_Component_GetEnabled(_ecs->entities[i].mesh->enabled);
-            BOOL hasAnimation = AF_Component_GetHas(_ecs->entities[i].animation->enabled);
-            if(hasMesh == TRUE && hasAnimation == TRUE && isEnabled == TRUE){
-            
-                if(mesh->meshID == MODEL_FOAM || mesh->meshID == MODEL_TRAIL || MODEL_ATTACK_WAVE){
-                    // do special drawing for foam.
-                    T3DMat4FP* meshMat = (T3DMat4FP*)mesh->modelMatrix;
-                    t3d_matrix_push(meshMat);
-                    animation->uvScrollingSpeed  = fm_fmodf((_time->currentFrame * animation->animationSpeed), 32.0f);
-                    color_t color = {mesh->material.color.r, mesh->material.color.g, mesh->material.color.b, mesh->material.color.a};
-                    rdpq_set_prim_color(color);
-                    t3d_model_draw_custom(models[mesh->meshID], (T3DModelDrawConf){
-                                    .userData = &animation->uvScrollingSpeed,//adjustedTileOffset,
-                                    //.matrices = meshMat,
-                                    .tileCb = Tile_Scroll,
-                                    });
-                                    
-                    t3d_matrix_pop(1);
-                }
+            if(mesh->meshID == MODEL_FOAM || mesh->meshID == MODEL_TRAIL || MODEL_ATTACK_WAVE){
+                // do special drawing for foam.
+                T3DMat4FP* meshMat = (T3DMat4FP*)mesh->modelMatrix;
+                t3d_matrix_push(meshMat);
+                animation->uvScrollingSpeed  = fm_fmodf((_time->currentFrame * animation->animationSpeed), 32.0f);
+                color_t color = {mesh->material.color.r, mesh->material.color.g, mesh->material.color.b, mesh->material.color.a};
+                rdpq_set_prim_color(color);
+                t3d_model_draw_custom(models[mesh->meshID], (T3DModelDrawConf){
+                                .userData = &animation->uvScrollingSpeed,//adjustedTileOffset,
+                                //.matrices = meshMat,
+                                .tileCb = Tile_Scroll,
+                                });
+                                
+                t3d_matrix_pop(1);
             }
         }
     }
@@ -933,6 +981,8 @@ void Renderer_DebugCam(RendererDebugData* _rendererDebugData){
     rdpq_text_printf(NULL, FONT2_ID, 50, 20, "Entities  : %i", _rendererDebugData->entitiesCount);
     rdpq_text_printf(NULL, FONT2_ID, 50, 30, "Meshs  : %i", _rendererDebugData->totalMeshes);
     rdpq_text_printf(NULL, FONT2_ID, 50, 40, "Tris  : %i", _rendererDebugData->totalTris);
+    rdpq_text_printf(NULL, FONT2_ID, 200, 30, "Matrices  : %i", _rendererDebugData->totalMatrixUpdates);
+    rdpq_text_printf(NULL, FONT2_ID, 200, 40, "Skeletons  : %i", _rendererDebugData->totalSkeletonUpdates);
     
     rdpq_text_printf(NULL, FONT2_ID, 50, 50, "Total Render: %.2fms", _rendererDebugData->totalRenderTime);
     rdpq_text_printf(NULL, FONT2_ID, 50, 60, "Entity Render: %.2fms", _rendererDebugData->totalEntityRenderTime);
@@ -7,6 +7,9 @@
 
 void ExecuteAIBehaviours(AF_Entity* _entity);
 
+// Entities with an enabled AI behaviour
+static AF_ECS_View aiView = AF_ECS_VIEW(AF_ECS_MASK(AF_ECS_AIBEHAVIOUR), AF_ECS_MASK(AF_ECS_AIBEHAVIOUR));
+
 /*
 ====================
 AI_INIT
@@ -34,8 +37,9 @@ void AI_Update(AppData* _appData){
         // update all the AI components
         ExecuteAIBehaviours(entity);
     }*/
-    for(int i = 0; i < _appData->ecs.entitiesCount ; ++i){
-        AF_Entity* entity = &_appData->ecs.entities[i];
+    AF_ECS_View_Update(&_appData->ecs, &aiView);
+    for(int i = 0; i < aiView.count ; ++i){
+        AF_Entity* entity = &_appData->ecs.entities[aiView.indices[i]];
         // update all the AI components
         ExecuteAIBehaviours(entity);
     }
@@ -95,7 +99,7 @@ AI_CreateFollow_Action
 Create a follow action
 ====================
 */
-void AI_CreateFollow_Action(AF_Entity* _entity, AF_Entity* _entityToFollow, void* _aiActionFunctionPtr){
+void AI_CreateFollow_Action(AF_ECS* _ecs, AF_Entity* _entity, AF_Entity* _entityToFollow, void* _aiActionFunctionPtr){
     AF_CAI_Behaviour* entityAIBehaviour = _entity->aiBehaviour;
     // check if we have components and they are enabled
     if(entityAIBehaviour->nextAvailableActionSlot >= AF_AI_ACTION_ARRAY_SIZE-1){
@@ -103,7 +107,7 @@ void AI_CreateFollow_Action(AF_Entity* _entity, AF_Entity* _entityToFollow, void
         return;
     }
     
-    entityAIBehaviour->enabled = AF_Component_SetEnabled(entityAIBehaviour->enabled, TRUE);
+    AF_ECS_SetComponentEnabled(_ecs, _entity, AF_ECS_AIBEHAVIOUR, TRUE);
     AF_AI_Action* entityAction = &entityAIBehaviour->actionsArray[entityAIBehaviour->nextAvailableActionSlot];
     entityAction->enabled = TRUE;
     entityAction->actionType = AI_ACTION_GOTO;
@@ -67,6 +67,6 @@ void AI_Shutdown();
 //=====HELPER FUNCTIONS=====
 
 
-void AI_CreateFollow_Action(AF_Entity* _entity, AF_Entity* _entityToFollow, void* _aiActionFunctionPtr);
+void AI_CreateFollow_Action(AF_ECS* _ecs, AF_Entity* _entity, AF_Entity* _entityToFollow, void* _aiActionFunctionPtr);
 
 #endif // AI_H
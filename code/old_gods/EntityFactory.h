@@ -22,6 +22,9 @@ static inline AF_Entity* Entity_Factory_CreatePrimative(AF_ECS* _ecs, Vec3 _pos,
 	*entity->rigidbody = AF_C3DRigidbody_ADD();
 	*entity->collider = AF_CCollider_ADD_TYPE(_collisionType);//AF_CCollider_Box_ADD();
 	*entity->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(_ecs, entity, AF_ECS_RIGIDBODY);
+	AF_ECS_SyncComponent(_ecs, entity, AF_ECS_COLLIDER);
+	AF_ECS_SyncComponent(_ecs, entity, AF_ECS_MESH);
 	entity->mesh->meshType = _meshType;
 	entity->collider->boundingVolume = _scale;//Vec3_MULT_SCALAR(_scale, 0.5f);//_scale;//Vec3_MULT_SCALAR(_scale, 2);
 	return entity;
@@ -36,6 +39,7 @@ static inline AF_Entity* Entity_Factory_CreateSprite(AF_ECS* _ecs, const char* _
 
 	AF_CSprite* sprite = entity->sprite;
 	*sprite = AF_CSprite_ADD();
+	AF_ECS_SyncComponent(_ecs, entity, AF_ECS_SPRITE);
 	sprite->spritePath = _spritePath;
 	sprite->spritePos = _screenPos;
 	sprite->spriteSheetSize = _size;
@@ -75,6 +79,7 @@ static inline AF_Entity* Entity_Factory_CreateAudio(AF_ECS* _ecs, AF_AudioClip _
 	}
 	AF_Entity* returnEntity = AF_ECS_CreateEntity(_ecs);
 	*returnEntity->audioSource = AF_CAudioSource_ADD();
+	AF_ECS_SyncComponent(_ecs, returnEntity, AF_ECS_AUDIOSOURCE);
 
 
 	AF_CAudioSource* audioSource = returnEntity->audioSource;
@@ -100,6 +105,7 @@ static inline AF_Entity* Entity_Factory_CreateUILabel(AF_ECS* _ecs, char* _textB
    
     AF_Entity* entity = AF_ECS_CreateEntity(_ecs);
     *entity->text = AF_CText_ADD();
+    AF_ECS_SyncComponent(_ecs, entity, AF_ECS_TEXT);
 	entity->text->text = _textBuff;
 	entity->text->fontID = 2;
 	entity->text->fontPath = _fontPath;
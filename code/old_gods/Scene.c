@@ -123,7 +123,7 @@ void Scene_Setup_Rats(AppData* _appData);
 void Scene_Setup_Audio(AppData* _appData);
 
 // ==== GAMEPLAY ====
-void TogglePrimativeComponents(AF_Entity* _entity, BOOL _state);
+void TogglePrimativeComponents(AF_ECS* _ecs, AF_Entity* _entity, BOOL _state);
 void PlayerController_DamageHandler(AppData* _appData);
 void MonitorPlayerHealth(AppData* _appData);
 
@@ -208,8 +208,10 @@ void Scene_Update(AppData* _appData){
 
     AF_ECS* ecs = &_appData->ecs;
     // carry villages
-    for(int i = 0; i < ecs->entitiesCount; ++i){
-        AF_Entity* entity = &ecs->entities[i];
+    static AF_ECS_View playerDataView = AF_ECS_VIEW(AF_ECS_MASK(AF_ECS_PLAYERDATA), 0);
+    AF_ECS_View_Update(ecs, &playerDataView);
+    for(int i = 0; i < playerDataView.count; ++i){
+        AF_Entity* entity = &ecs->entities[playerDataView.indices[i]];
         AF_CPlayerData* playerData = entity->playerData;
 
         // TODO: move this out of this function
@@ -260,7 +262,7 @@ void Scene_Update(AppData* _appData){
                 adjustedPlayerPos.z > levelBounds.z){
                 
                 // send shark to eat player
-                hunterShark->aiBehaviour->enabled = AF_Component_SetEnabled(hunterShark->aiBehaviour->enabled, TRUE);
+                AF_ECS_SetComponentEnabled(ecs, hunterShark, AF_ECS_AIBEHAVIOUR, TRUE);
                 hunterShark->playerData->isAttacking = TRUE;
                 // Shark will target and move towards the player
                 // on collision will handle the rest
@@ -351,12 +353,10 @@ void Scene_UpdateSharkEffects(AppData* _appData){
             Vec3 pos = sharkHunterEntities[i]->transform->pos;
             Vec3 adjustedSharkPos = Vec3_MINUS(pos, _appData->gameplayData.levelPos);
             //AF_Entity* hunterShark = sharkHunterEntities[i];
-            AF_CMesh* sharkMesh = sharkHunterEntities[i]->mesh;
-            AF_CMesh* sharkTrail = sharkHunterTrails[i]->mesh;
 
             if(_appData->gameplayData.gameState != GAME_STATE_PLAYING)
             {
-                sharkTrail->enabled = AF_Component_SetEnabled(sharkTrail->enabled, FALSE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, sharkHunterTrails[i], AF_ECS_MESH, FALSE);
                 continue;
             }
             // if inside the bounds, turn on the visibilty of the shark and trails, otherwise turn off.
@@ -365,12 +365,12 @@ void Scene_UpdateSharkEffects(AppData* _appData){
                 adjustedSharkPos.z < -levelBounds.z- 5  ||
                 adjustedSharkPos.z > levelBounds.z+ 5 ){
                 
-                sharkTrail->enabled = AF_Component_SetEnabled(sharkTrail->enabled, FALSE);
-                sharkMesh->enabled = AF_Component_SetEnabled(sharkMesh->enabled, FALSE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, sharkHunterTrails[i], AF_ECS_MESH, FALSE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, sharkHunterEntities[i], AF_ECS_MESH, FALSE);
             
             }else{
-                sharkMesh->enabled = AF_Component_SetEnabled(sharkMesh->enabled, TRUE);
-                sharkTrail->enabled = AF_Component_SetEnabled(sharkTrail->enabled, TRUE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, sharkHunterEntities[i], AF_ECS_MESH, TRUE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, sharkHunterTrails[i], AF_ECS_MESH, TRUE);
             }
     }
 }
@@ -402,23 +402,22 @@ void Scene_UpdateEffects(AppData* _appData){
     // update the eaten attack wave
     // if we are not playing, don't animate. helps with poor performance when menu is shown
     AF_CMesh* eatenWaveMesh = playerEatenWave->mesh;
-    AF_CMesh* mapSeaFoamEntityMesh = mapSeaFoamEntity->mesh;
     if(_appData->gameplayData.gameState != GAME_STATE_PLAYING)
     {
-        eatenWaveMesh->enabled = AF_Component_SetEnabled(eatenWaveMesh->enabled, FALSE);
-        mapSeaFoamEntityMesh->enabled = AF_Component_SetEnabled(mapSeaFoamEntityMesh->enabled, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, playerEatenWave, AF_ECS_MESH, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, mapSeaFoamEntity, AF_ECS_MESH, FALSE);
         return;
     }else{
-        eatenWaveMesh->enabled = AF_Component_SetEnabled(eatenWaveMesh->enabled, TRUE);
-        mapSeaFoamEntityMesh->enabled = AF_Component_SetEnabled(mapSeaFoamEntityMesh->enabled, TRUE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, playerEatenWave, AF_ECS_MESH, TRUE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, mapSeaFoamEntity, AF_ECS_MESH, TRUE);
     }
     
     if(eatenWaveMesh->material.color.a - 10.0f <= 0){
         eatenWaveMesh->material.color.a = 0.0f;
         // disable the renderer when we are finished
-        eatenWaveMesh->enabled = AF_Component_SetEnabled(eatenWaveMesh->enabled, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, playerEatenWave, AF_ECS_MESH, FALSE);
     }else{
-        eatenWaveMesh->enabled = AF_Component_SetEnabled(eatenWaveMesh->enabled, TRUE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, playerEatenWave, AF_ECS_MESH, TRUE);
         eatenWaveMesh->material.color.a -= 10.0f;
         
     }
@@ -436,7 +435,7 @@ void Scene_UpdatePlayerAttackWaves(AppData* _appData){
         // disable whilst not playing to improve performance
         if(_appData->gameplayData.gameState != GAME_STATE_PLAYING)
             {
-                mesh->enabled = AF_Component_SetEnabled(mesh->enabled, FALSE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, playerWaves[i], AF_ECS_MESH, FALSE);
                 continue;
             }
 
@@ -447,10 +446,10 @@ void Scene_UpdatePlayerAttackWaves(AppData* _appData){
              // don't overflow
             if(mesh->material.color.a - 10.0f <= 0){
                 // disable the renderer when we are finished
-                mesh->enabled = AF_Component_SetEnabled(mesh->enabled, FALSE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, playerWaves[i], AF_ECS_MESH, FALSE);
                 mesh->material.color.a = 0.0f;
             }else{
-                mesh->enabled = AF_Component_SetEnabled(mesh->enabled, TRUE);
+                AF_ECS_SetComponentEnabled(&_appData->ecs, playerWaves[i], AF_ECS_MESH, TRUE);
                 mesh->material.color.a -= 10.0f;
             }
             
@@ -473,9 +472,9 @@ void Scene_UpdateWaterTrails(AppData* _appData){
     player1TrailMesh->material.color.a = foamTransparency1 * 255;
     if(player1TrailMesh->material.color.a == 0.1f || _appData->gameplayData.gameState != GAME_STATE_PLAYING){
         // disable the renderer when we are finished
-        player1TrailMesh->enabled = AF_Component_SetEnabled(player1TrailMesh->enabled, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player1Trail, AF_ECS_MESH, FALSE);
     }else{
-        player1TrailMesh->enabled = AF_Component_SetEnabled(player1TrailMesh->enabled, TRUE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player1Trail, AF_ECS_MESH, TRUE);
     }
 
     // Player 2
@@ -486,9 +485,9 @@ void Scene_UpdateWaterTrails(AppData* _appData){
     player2TrailMesh->material.color.a = foamTransparency2 * 255;
     if(player2TrailMesh->material.color.a == 0.1f || _appData->gameplayData.gameState != GAME_STATE_PLAYING){
         // disable the renderer when we are finished
-        player2TrailMesh->enabled = AF_Component_SetEnabled(player2TrailMesh->enabled, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player2Trail, AF_ECS_MESH, FALSE);
     }else{
-        player2TrailMesh->enabled = AF_Component_SetEnabled(player2TrailMesh->enabled, TRUE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player2Trail, AF_ECS_MESH, TRUE);
     }
 
     // Player 3
@@ -499,9 +498,9 @@ void Scene_UpdateWaterTrails(AppData* _appData){
     player3TrailMesh->material.color.a = foamTransparency3 * 255;
     if(player3TrailMesh->material.color.a == 0.1f || _appData->gameplayData.gameState != GAME_STATE_PLAYING){
         // disable the renderer when we are finished
-        player3TrailMesh->enabled = AF_Component_SetEnabled(player3TrailMesh->enabled, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player3Trail, AF_ECS_MESH, FALSE);
     }else{
-        player3TrailMesh->enabled = AF_Component_SetEnabled(player3TrailMesh->enabled, TRUE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player3Trail, AF_ECS_MESH, TRUE);
     }
 
     // Player 4
@@ -512,9 +511,9 @@ void Scene_UpdateWaterTrails(AppData* _appData){
     player4TrailMesh->material.color.a = foamTransparency4 * 255;
     if(player4TrailMesh->material.color.a == 0.1f || _appData->gameplayData.gameState != GAME_STATE_PLAYING){
         // disable the renderer when we are finished
-        player4TrailMesh->enabled = AF_Component_SetEnabled(player4TrailMesh->enabled, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player4Trail, AF_ECS_MESH, FALSE);
     }else{
-        player4TrailMesh->enabled = AF_Component_SetEnabled(player4TrailMesh->enabled, TRUE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, player4Trail, AF_ECS_MESH, TRUE);
     }
 }
 
@@ -593,6 +592,7 @@ void Scene_Setup_SnekGod(AppData* _appData){
     godSnekEntity->collider->boundingVolume = godBoundingScale;
     godSnekEntity->collider->showDebug = TRUE;
     *godSnekEntity->skeletalAnimation = AF_CSkeletalAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, godSnekEntity, AF_ECS_SKELETALANIMATION);
 }
 
 /* ================
@@ -626,8 +626,8 @@ void Scene_Setup_LevelMap(AppData* _appData){
 
 
     levelEntity = Entity_Factory_CreatePrimative(&_appData->ecs, levelPos, levelScale, AF_MESH_TYPE_MESH, AABB);
-    levelEntity->mesh->enabled = AF_Component_SetHas(levelEntity->mesh->enabled, FALSE);
-    levelEntity->mesh->enabled = AF_Component_SetEnabled(levelEntity->mesh->enabled, FALSE);
+    AF_ECS_SetComponentHas(&_appData->ecs, levelEntity, AF_ECS_MESH, FALSE);
+    AF_ECS_SetComponentEnabled(&_appData->ecs, levelEntity, AF_ECS_MESH, FALSE);
     //levelEntity->mesh->meshID = MODEL_SNAKE;
     //levelEntity->mesh->material.color = WHITE_COLOR;
     levelEntity->rigidbody->inverseMass = 0.0f;
@@ -645,11 +645,13 @@ void Scene_Setup_LevelMap(AppData* _appData){
 
 	// add a rigidbody to our cube
 	*mapSeaFoamEntity->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, mapSeaFoamEntity, AF_ECS_MESH);
 	mapSeaFoamEntity->mesh->meshType = AF_MESH_TYPE_MESH;
     mapSeaFoamEntity->mesh->material.color = WHITE_COLOR;
     mapSeaFoamEntity->mesh->material.color.a = 100;
     mapSeaFoamEntity->mesh->meshID = MODEL_FOAM;
     *mapSeaFoamEntity->animation = AF_CAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, mapSeaFoamEntity, AF_ECS_ANIMATION);
     mapSeaFoamEntity->animation->animationSpeed = 0.1f;
 }
 
@@ -670,11 +672,13 @@ void Scene_Setup_Players(AppData* _appData){
     player1Entity->rigidbody->inverseMass = 0.0f;
 	player1Entity->rigidbody->isKinematic = TRUE;
     *player1Entity->playerData = AF_CPlayerData_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player1Entity, AF_ECS_PLAYERDATA);
     player1Entity->playerData->faction = PLAYER;
     player1Entity->playerData->startPosition = player1Pos;
     // For some reason player 1 is faster. not sure so halving the speed
     player1Entity->playerData->movementSpeed = PLAYER_MOVEMENT_SPEED * .25f;
     *player1Entity->skeletalAnimation = AF_CSkeletalAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player1Entity, AF_ECS_SKELETALANIMATION);
 
     
     // Create Player1 Foam Trail
@@ -688,6 +692,7 @@ void Scene_Setup_Players(AppData* _appData){
     player1Trail->parentTransform = player1Entity->transform;
 	// add a rigidbody to our cube
 	*player1Trail->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, player1Trail, AF_ECS_MESH);
 	player1Trail->mesh->meshType = AF_MESH_TYPE_MESH;
     player1Trail->mesh->material.color = WHITE_COLOR;
     player1Trail->mesh->material.color.a = 0;
@@ -695,6 +700,7 @@ void Scene_Setup_Players(AppData* _appData){
 
     // Animation
     *player1Trail->animation = AF_CAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player1Trail, AF_ECS_ANIMATION);
     player1Trail->animation->animationSpeed = foamAnimationSpeed;
 
 
@@ -713,11 +719,13 @@ void Scene_Setup_Players(AppData* _appData){
     player2Entity->rigidbody->inverseMass =  0.0f;
 	player2Entity->rigidbody->isKinematic = TRUE;
     *player2Entity->playerData = AF_CPlayerData_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player2Entity, AF_ECS_PLAYERDATA);
     player2Entity->playerData->faction = PLAYER;
     player2Entity->playerData->movementSpeed = PLAYER_MOVEMENT_SPEED;
     player2Entity->playerData->startPosition = player2Pos;
     player2Entity->playerData->movementSpeed = aiReactionSpeed;
     *player2Entity->skeletalAnimation = AF_CSkeletalAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player2Entity, AF_ECS_SKELETALANIMATION);
 
     // Create Player2 Foam Trail
     // position needs to be thought of as local to the parent it will be inherited by
@@ -730,6 +738,7 @@ void Scene_Setup_Players(AppData* _appData){
     player2Trail->parentTransform = player2Entity->transform;
 	// add a rigidbody to our cube
 	*player2Trail->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, player2Trail, AF_ECS_MESH);
 	player2Trail->mesh->meshType = AF_MESH_TYPE_MESH;
     player2Trail->mesh->material.color = WHITE_COLOR;
     player2Trail->mesh->material.color.a = 0;
@@ -737,6 +746,7 @@ void Scene_Setup_Players(AppData* _appData){
 
     // Animation
     *player2Trail->animation = AF_CAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player2Trail, AF_ECS_ANIMATION);
     player2Trail->animation->animationSpeed = foamAnimationSpeed;
     
     // Create Player3
@@ -750,11 +760,13 @@ void Scene_Setup_Players(AppData* _appData){
 	player3Entity->rigidbody->isKinematic = TRUE;
     player3Entity->rigidbody->inverseMass =  0.0f;
     *player3Entity->playerData = AF_CPlayerData_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player3Entity, AF_ECS_PLAYERDATA);
     player3Entity->playerData->movementSpeed = PLAYER_MOVEMENT_SPEED;
     player3Entity->playerData->faction = PLAYER;
     player3Entity->playerData->startPosition = player3Pos;
     player3Entity->playerData->movementSpeed = aiReactionSpeed;
     *player3Entity->skeletalAnimation = AF_CSkeletalAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player3Entity, AF_ECS_SKELETALANIMATION);
 
     // Create Player3 Foam Trail
     // position needs to be thought of as local to the parent it will be inherited by
@@ -767,6 +779,7 @@ void Scene_Setup_Players(AppData* _appData){
     player3Trail->parentTransform = player3Entity->transform;
 	// add a rigidbody to our cube
 	*player3Trail->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, player3Trail, AF_ECS_MESH);
 	player3Trail->mesh->meshType = AF_MESH_TYPE_MESH;
     player3Trail->mesh->material.color = WHITE_COLOR;
     player3Trail->mesh->material.color.a = 0;
@@ -774,6 +787,7 @@ void Scene_Setup_Players(AppData* _appData){
 
     // animation
     *player3Trail->animation = AF_CAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player3Trail, AF_ECS_ANIMATION);
     player3Trail->animation->animationSpeed = foamAnimationSpeed;
 
 
@@ -788,11 +802,13 @@ void Scene_Setup_Players(AppData* _appData){
 	player4Entity->rigidbody->isKinematic = TRUE;
     player4Entity->rigidbody->inverseMass =  0.0f;
     *player4Entity->playerData = AF_CPlayerData_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player4Entity, AF_ECS_PLAYERDATA);
     player4Entity->playerData->movementSpeed = PLAYER_MOVEMENT_SPEED;
     player4Entity->playerData->faction = PLAYER;
     player4Entity->playerData->startPosition = player4Pos;
     player4Entity->playerData->movementSpeed = aiReactionSpeed;
     *player4Entity->skeletalAnimation = AF_CSkeletalAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player4Entity, AF_ECS_SKELETALANIMATION);
 
     // Create Player4 Foam Trail
     // position needs to be thought of as local to the parent it will be inherited by
@@ -805,6 +821,7 @@ void Scene_Setup_Players(AppData* _appData){
     player4Trail->parentTransform = player4Entity->transform;
 	// add a rigidbody to our cube
 	*player4Trail->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, player4Trail, AF_ECS_MESH);
 	player4Trail->mesh->meshType = AF_MESH_TYPE_MESH;
     player4Trail->mesh->material.color = WHITE_COLOR;
     player4Trail->mesh->material.color.a = 0;
@@ -812,6 +829,7 @@ void Scene_Setup_Players(AppData* _appData){
 
     // Animation
     *player4Trail->animation = AF_CAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, player4Trail, AF_ECS_ANIMATION);
     player4Trail->animation->animationSpeed = foamAnimationSpeed;
 
 
@@ -820,6 +838,7 @@ void Scene_Setup_Players(AppData* _appData){
     for(int i = core_get_playercount(); i < PLAYER_COUNT; ++i){
         AF_Entity* aiPlayerEntity = _appData->gameplayData.playerEntities[i];
         *aiPlayerEntity->aiBehaviour = AF_CAI_Behaviour_ADD();
+        AF_ECS_SyncComponent(&_appData->ecs, aiPlayerEntity, AF_ECS_AIBEHAVIOUR);
         //AI_CreateFollow_Action(aiPlayerEntity, player1Entity,  Scene_AIStateMachine);
         //BOOL hasAI = AF_Component_GetHas(aiPlayerEntity->aiBehaviour->enabled );
         //BOOL isEnabled = AF_Component_GetEnabled(aiPlayerEntity->aiBehaviour->enabled);
@@ -827,9 +846,9 @@ void Scene_Setup_Players(AppData* _appData){
 
         // First behaviour is to go for the villager
         AF_Entity* rat = _appData->gameplayData.rat;
-        AI_CreateFollow_Action(aiPlayerEntity, rat,  Scene_AIStateMachine);
+        AI_CreateFollow_Action(&_appData->ecs, aiPlayerEntity, rat,  Scene_AIStateMachine);
         // second behaviour is go for the god 
-        AI_CreateFollow_Action(aiPlayerEntity, levelEntity,  Scene_AIStateMachine);
+        AI_CreateFollow_Action(&_appData->ecs, aiPlayerEntity, levelEntity,  Scene_AIStateMachine);
     }
 
     
@@ -845,6 +864,7 @@ void Scene_Setup_Players(AppData* _appData){
         playerWaves[i]->parentTransform = _appData->gameplayData.playerEntities[i]->transform;
         // add a rigidbody to our cube
         *playerWaves[i]->mesh = AF_CMesh_ADD();
+        AF_ECS_SyncComponent(&_appData->ecs, playerWaves[i], AF_ECS_MESH);
         playerWaves[i]->mesh->meshType = AF_MESH_TYPE_MESH;
         playerWaves[i]->mesh->material.color = WHITE_COLOR;
         playerWaves[i]->mesh->material.color.a = 0;
@@ -853,6 +873,7 @@ void Scene_Setup_Players(AppData* _appData){
 
         // Animation
         *playerWaves[i]->animation = AF_CAnimation_ADD();
+        AF_ECS_SyncComponent(&_appData->ecs, playerWaves[i], AF_ECS_ANIMATION);
         playerWaves[i]->animation->animationSpeed = foamAnimationSpeed;
         // disable at the start. Will get re-enabled on attack
         
@@ -877,8 +898,8 @@ void Scene_Setup_RatSpawnPoints(AppData* _appData){
 	//Vec3 bucket1Scale = {1,1,1};
     bucket1 = Entity_Factory_CreatePrimative(&_appData->ecs, bucket1Pos, bucketScale,AF_MESH_TYPE_MESH, AABB);
     // disable the mesh rendering
-    bucket1->mesh->enabled = AF_Component_SetHas(bucket1->mesh->enabled, FALSE);
-    bucket1->mesh->enabled = AF_Component_SetEnabled(bucket1->mesh->enabled, FALSE);
+    AF_ECS_SetComponentHas(&_appData->ecs, bucket1, AF_ECS_MESH, FALSE);
+    AF_ECS_SetComponentEnabled(&_appData->ecs, bucket1, AF_ECS_MESH, FALSE);
     //bucket1->mesh->meshID = MODEL_CYLINDER;
     //bucket1->mesh->material.color = WHITE_COLOR;
     bucket1->rigidbody->inverseMass = 0.0f;
@@ -890,8 +911,8 @@ void Scene_Setup_RatSpawnPoints(AppData* _appData){
 	Vec3 bucket2Pos =  {mapBoundingVolume.x - offsetX, bucketY, -mapBoundingVolume.z + offsetZ};
 	//Vec3 bucket2Scale = {1,1,1};
 	bucket2 = Entity_Factory_CreatePrimative(&_appData->ecs, bucket2Pos, bucketScale,AF_MESH_TYPE_MESH, AABB);
-    bucket2->mesh->enabled = AF_Component_SetHas(bucket2->mesh->enabled, FALSE);
-    bucket2->mesh->enabled = AF_Component_SetEnabled(bucket2->mesh->enabled, FALSE);
+    AF_ECS_SetComponentHas(&_appData->ecs, bucket2, AF_ECS_MESH, FALSE);
+    AF_ECS_SetComponentEnabled(&_appData->ecs, bucket2, AF_ECS_MESH, FALSE);
     //bucket2->mesh->meshID = MODEL_CYLINDER;
     bucket2->rigidbody->inverseMass = 0.0f;
      // TODO: add details to scene_onBucketTrigger callback
@@ -902,8 +923,8 @@ void Scene_Setup_RatSpawnPoints(AppData* _appData){
 	Vec3 bucket3Pos =  {-mapBoundingVolume.x + offsetX, bucketY, mapBoundingVolume.z - (offsetZ*.5f)};
 	//Vec3 bucket3Scale = {1,1,1};
 	bucket3 = Entity_Factory_CreatePrimative(&_appData->ecs, bucket3Pos, bucketScale,AF_MESH_TYPE_MESH, AABB);
-    bucket3->mesh->enabled = AF_Component_SetHas(bucket3->mesh->enabled, FALSE);
-    bucket3->mesh->enabled = AF_Component_SetEnabled(bucket3->mesh->enabled, FALSE);
+    AF_ECS_SetComponentHas(&_appData->ecs, bucket3, AF_ECS_MESH, FALSE);
+    AF_ECS_SetComponentEnabled(&_appData->ecs, bucket3, AF_ECS_MESH, FALSE);
     //bucket3->mesh->meshID = MODEL_CYLINDER;
     bucket3->rigidbody->inverseMass = 0.0f;
      // TODO: add details to scene_onBucketTrigger callback
@@ -913,8 +934,8 @@ void Scene_Setup_RatSpawnPoints(AppData* _appData){
 	Vec3 bucket4Pos =  {mapBoundingVolume.x - offsetX, bucketY, mapBoundingVolume.z - (offsetZ*.5f)};
 	//Vec3 bucket4Scale = {1,1,1};
 	bucket4 = Entity_Factory_CreatePrimative(&_appData->ecs, bucket4Pos, bucketScale,AF_MESH_TYPE_MESH, AABB);
-    bucket4->mesh->enabled = AF_Component_SetHas(bucket4->mesh->enabled, FALSE);
-    bucket4->mesh->enabled = AF_Component_SetEnabled(bucket4->mesh->enabled, FALSE);
+    AF_ECS_SetComponentHas(&_appData->ecs, bucket4, AF_ECS_MESH, FALSE);
+    AF_ECS_SetComponentEnabled(&_appData->ecs, bucket4, AF_ECS_MESH, FALSE);
     //bucket4->mesh->meshID = MODEL_CYLINDER;
     bucket4->rigidbody->inverseMass = 0.0f;
      // TODO: add details to scene_onBucketTrigger callback
@@ -1034,6 +1055,7 @@ void Scene_SetupLevelObjects(AppData* _appData){
     playerEatenWave->transform->scale = playerEatenWavesalterScale;
 	// add a rigidbody to our cube
 	*playerEatenWave->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, playerEatenWave, AF_ECS_MESH);
 	playerEatenWave->mesh->meshType = AF_MESH_TYPE_MESH;
     playerEatenWave->mesh->material.color = WHITE_COLOR;
     playerEatenWave->mesh->material.color.a = 150;
@@ -1043,6 +1065,7 @@ void Scene_SetupLevelObjects(AppData* _appData){
     
     // Animation
     *playerEatenWave->animation = AF_CAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, playerEatenWave, AF_ECS_ANIMATION);
     playerEatenWave->animation->animationSpeed = animationSpeed;
 
     // Place the alter
@@ -1053,6 +1076,7 @@ void Scene_SetupLevelObjects(AppData* _appData){
     ratSpawnEntity->transform->scale = ratPentogramScale;
 	// add a rigidbody to our cube
 	*ratSpawnEntity->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, ratSpawnEntity, AF_ECS_MESH);
 	ratSpawnEntity->mesh->meshType = AF_MESH_TYPE_MESH;
     ratSpawnEntity->mesh->material.color = WHITE_COLOR;
     ratSpawnEntity->mesh->material.color.a = 150;
@@ -1081,6 +1105,7 @@ void Scene_SetupSharks(AppData* _appData){
 
     // player data
     *sharkEntity->playerData = AF_CPlayerData_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, sharkEntity, AF_ECS_PLAYERDATA);
     
     sharkEntity->playerData->movementSpeed = 10.0f;
     sharkEntity->playerData->faction = ENEMY2;
@@ -1095,6 +1120,7 @@ void Scene_SetupSharks(AppData* _appData){
     sharkTrail->parentTransform = sharkEntity->transform;
 	// add a rigidbody to our cube
 	*sharkTrail->mesh = AF_CMesh_ADD();
+	AF_ECS_SyncComponent(&_appData->ecs, sharkTrail, AF_ECS_MESH);
 	sharkTrail->mesh->meshType = AF_MESH_TYPE_MESH;
     sharkTrail->mesh->material.color = WHITE_COLOR;
     sharkTrail->mesh->material.color.a = 255;
@@ -1102,6 +1128,7 @@ void Scene_SetupSharks(AppData* _appData){
 
     // Animation
     *sharkTrail->animation = AF_CAnimation_ADD();
+    AF_ECS_SyncComponent(&_appData->ecs, sharkTrail, AF_ECS_ANIMATION);
     sharkTrail->animation->animationSpeed = sharkFoamAnimationSpeed;
 
     Vec3 sharkHunterSpawnPos = {-30, 0, 0};
@@ -1125,11 +1152,13 @@ void Scene_SetupSharks(AppData* _appData){
 
         // player data
         *sharkHunterEntity->playerData = AF_CPlayerData_ADD();
+        AF_ECS_SyncComponent(&_appData->ecs, sharkHunterEntity, AF_ECS_PLAYERDATA);
         sharkHunterEntity->playerData->movementSpeed = AI_MOVEMENT_SPEED_MOD * ((1+core_get_aidifficulty()) + rand()%((1+core_get_aidifficulty())))*2;
         sharkHunterEntity->playerData->faction = ENEMY2;
 
         // AI
         *sharkHunterEntity->aiBehaviour = AF_CAI_Behaviour_ADD();
+        AF_ECS_SyncComponent(&_appData->ecs, sharkHunterEntity, AF_ECS_AIBEHAVIOUR);
         
 
         //BOOL hasAI = AF_Component_GetHas(sharkHunterEntity->aiBehaviour->enabled);
@@ -1137,13 +1166,13 @@ void Scene_SetupSharks(AppData* _appData){
         //debugf("shark hasAI: %i isEnabled: %i\n",hasAI, isEnabled);
         // match the target with the player number
         // add a follow action 
-        AI_CreateFollow_Action(sharkHunterEntity, _appData->gameplayData.playerEntities[i],  Scene_AIStateMachine);
+        AI_CreateFollow_Action(&_appData->ecs, sharkHunterEntity, _appData->gameplayData.playerEntities[i],  Scene_AIStateMachine);
 
         // Create the go home action. This function increments to a new action slot if called again.
-        AI_CreateFollow_Action(sharkHunterEntity, sharkHomeEntity,  Scene_AIStateMachine);
+        AI_CreateFollow_Action(&_appData->ecs, sharkHunterEntity, sharkHomeEntity,  Scene_AIStateMachine);
 
         // disable the component for now, but it will be enabled when the player goes out of bounds.
-        sharkHunterEntity->aiBehaviour->enabled = AF_Component_SetEnabled(sharkHunterEntity->aiBehaviour->enabled, FALSE);
+        AF_ECS_SetComponentEnabled(&_appData->ecs, sharkHunterEntity, AF_ECS_AIBEHAVIOUR, FALSE);
         //BOOL hasAIBehaviour = AF_Component_GetHas(sharkHunterEntity->aiBehaviour->enabled);
         //BOOL aiIsEnabled = AF_Component_GetEnabled(sharkHunterEntity->aiBehaviour->enabled);
         //debugf("entity: %i hasAI: %i isEnabled: %i\n",i, hasAIBehaviour, aiIsEnabled);
@@ -1159,6 +1188,7 @@ void Scene_SetupSharks(AppData* _appData){
         sharkHunterTrail->parentTransform = sharkHunterEntity->transform;
         // add a rigidbody to our cube
         *sharkHunterTrail->mesh = AF_CMesh_ADD();
+        AF_ECS_SyncComponent(&_appData->ecs, sharkHunterTrail, AF_ECS_MESH);
         sharkHunterTrail->mesh->meshType = AF_MESH_TYPE_MESH;
         sharkHunterTrail->mesh->material.color = WHITE_COLOR;
         sharkHunterTrail->mesh->material.color.a = 255;
@@ -1166,6 +1196,7 @@ void Scene_SetupSharks(AppData* _appData){
 
         // Animation
         *sharkHunterTrail->animation = AF_CAnimation_ADD();
+        AF_ECS_SyncComponent(&_appData->ecs, sharkHunterTrail, AF_ECS_ANIMATION);
         sharkHunterTrail->animation->animationSpeed = sharkFoamAnimationSpeed;
     }
 
@@ -1661,7 +1692,7 @@ void RatAIBehaviourUpdate(AppData* _appData){
             Vec3 randomPos = {randomX, ratEntity->transform->pos.y, randomZ};
             ratEntity->transform->pos = randomPos;
             ratPlayerData->isAlive = TRUE;
-            TogglePrimativeComponents(ratEntity, TRUE);
+            TogglePrimativeComponents(&_appData->ecs, ratEntity, TRUE);
             
         }else{
             //debugf("Move Rat\n");
@@ -1799,10 +1830,10 @@ void RespawnPlayer(AF_Entity* _entity){
 TogglePrimativeComponents
 toggle the components mesh, rigidybody, and collider
 ================*/
-void TogglePrimativeComponents(AF_Entity* _entity, BOOL _state){
-    _entity->rigidbody->enabled = AF_Component_SetEnabled(_entity->rigidbody->enabled, _state);
-    _entity->mesh->enabled = AF_Component_SetEnabled(_entity->mesh->enabled, _state);
-    _entity->collider->enabled = AF_Component_SetEnabled(_entity->collider->enabled, _state);
+void TogglePrimativeComponents(AF_ECS* _ecs, AF_Entity* _entity, BOOL _state){
+    AF_ECS_SetComponentEnabled(_ecs, _entity, AF_ECS_RIGIDBODY, _state);
+    AF_ECS_SetComponentEnabled(_ecs, _entity, AF_ECS_MESH, _state);
+    AF_ECS_SetComponentEnabled(_ecs, _entity, AF_ECS_COLLIDER, _state);
 }
 
 AF_Entity* GetBucket1(){
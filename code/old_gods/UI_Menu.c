@@ -141,10 +141,10 @@ void UI_Menu_RenderCountdown(AppData* _appData);
 void UI_Menu_RenderPausedScreen(AppData* _appData);
 
 // Set Menu states
-void UI_Menu_MainMenuSetShowing(BOOL _state);
-void UI_Menu_GameOverUISetShowing(BOOL _state);
-void UI_Menu_PlayingSetState(BOOL _state);
-void UI_Menu_CountdownState(BOOL _state);
+void UI_Menu_MainMenuSetShowing(AF_ECS* _ecs, BOOL _state);
+void UI_Menu_GameOverUISetShowing(AF_ECS* _ecs, BOOL _state);
+void UI_Menu_PlayingSetState(AF_ECS* _ecs, BOOL _state);
+void UI_Menu_CountdownState(AF_ECS* _ecs, BOOL _state);
 
 // Setup UI
 void UI_Menu_SetupMainMenu(AppData* _appData);
@@ -526,21 +526,21 @@ void UI_Menu_SetupPauseMenu(AppData* _appData){
 UI_Menu_MainMenuSetShowing
 Set state for main menu
  ================ */
-void UI_Menu_MainMenuSetShowing(BOOL _state){
+void UI_Menu_MainMenuSetShowing(AF_ECS* _ecs, BOOL _state){
     // Main Menu
     mainMenuTitleEntity->text->isShowing = _state;
     mainMenuSubTitleEntity->text->isShowing = _state;
     mainMenuTitleBackground->text->isShowing = _state;
     // background panels
-    mainMenuTitleBackground->sprite->enabled= AF_Component_SetEnabled(mainMenuTitleBackground->sprite->enabled, _state);
-    mainMenuSubTitleBackground->sprite->enabled =AF_Component_SetEnabled(mainMenuSubTitleBackground->sprite->enabled, _state);
+    AF_ECS_SetComponentEnabled(_ecs, mainMenuTitleBackground, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, mainMenuSubTitleBackground, AF_ECS_SPRITE, _state);
 }
 
 /* ================
 UI_Menu_PauseMenuSetShowing
 Set state for pause menu
  ================ */
-void UI_Menu_PauseMenuSetShowing(BOOL _state){
+void UI_Menu_PauseMenuSetShowing(AF_ECS* _ecs, BOOL _state){
     // Text
     pauseMenuTitleEntity->text->isShowing = _state;
     pauseMenuSubTitle1Entity->text->isShowing = _state;
@@ -552,24 +552,24 @@ void UI_Menu_PauseMenuSetShowing(BOOL _state){
     pauseMenuSubTitle2Background->text->isShowing = _state;
 
     // background panels
-    pauseMenuTitleBackground->sprite->enabled= AF_Component_SetEnabled(pauseMenuTitleBackground->sprite->enabled, _state);
-    pauseMenuSubTitle1Background->sprite->enabled =AF_Component_SetEnabled(pauseMenuSubTitle1Background->sprite->enabled, _state);
-    pauseMenuSubTitle2Background->sprite->enabled =AF_Component_SetEnabled(pauseMenuSubTitle2Background->sprite->enabled, _state);
+    AF_ECS_SetComponentEnabled(_ecs, pauseMenuTitleBackground, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, pauseMenuSubTitle1Background, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, pauseMenuSubTitle2Background, AF_ECS_SPRITE, _state);
 }
 
 /* ================
 UI_Menu_GameOverUISetShowing
 Set State for Game Over UI
  ================ */
-void UI_Menu_GameOverUISetShowing(BOOL _state){
+void UI_Menu_GameOverUISetShowing(AF_ECS* _ecs, BOOL _state){
     // Game Over
     
     gameOverTitleEntity->text->isShowing = _state;
      
     gameOverSubTitleEntity->text->isShowing = _state;
    
-    gameOverTitleBackground->sprite->enabled= AF_Component_SetEnabled(gameOverTitleBackground->sprite->enabled, _state);
-    gameOverSubTitleBackground->sprite->enabled =AF_Component_SetEnabled(gameOverSubTitleBackground->sprite->enabled, _state);
+    AF_ECS_SetComponentEnabled(_ecs, gameOverTitleBackground, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, gameOverSubTitleBackground, AF_ECS_SPRITE, _state);
     /**/
     
 }
@@ -578,27 +578,27 @@ void UI_Menu_GameOverUISetShowing(BOOL _state){
 UI_Menu_PlayingSetState
 Set State for Player UI
  ================ */
-void UI_Menu_PlayingSetState(BOOL _state){
+void UI_Menu_PlayingSetState(AF_ECS* _ecs, BOOL _state){
     playersCountUIEntity->text->isShowing = _state;
     countdownTimerLabelEntity->text->isShowing = _state;
 
     //toggle the score backgrounds
-    player1ScoreBackground->sprite->enabled = AF_Component_SetEnabled(player1ScoreBackground->sprite->enabled, _state);
-    player2ScoreBackground->sprite->enabled = AF_Component_SetEnabled(player2ScoreBackground->sprite->enabled, _state);
-    player3ScoreBackground->sprite->enabled = AF_Component_SetEnabled(player3ScoreBackground->sprite->enabled, _state);
-    player4ScoreBackground->sprite->enabled = AF_Component_SetEnabled(player4ScoreBackground->sprite->enabled, _state);   
+    AF_ECS_SetComponentEnabled(_ecs, player1ScoreBackground, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, player2ScoreBackground, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, player3ScoreBackground, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, player4ScoreBackground, AF_ECS_SPRITE, _state);
 }
 
 /* ================
 UI_Menu_CountdownState
 Set State for Count down timer UI
  ================ */
-void UI_Menu_CountdownState(BOOL _state){
+void UI_Menu_CountdownState(AF_ECS* _ecs, BOOL _state){
     // Player Counts hid
     startCountdownUIBackgroundEntity->text->isShowing = _state;
     startCountdownLabelEntity->text->isShowing = _state;
-    startCountdownUIBackgroundEntity->sprite->enabled = AF_Component_SetEnabled(startCountdownUIBackgroundEntity->sprite->enabled, _state);
-    startCountdownLabelEntity->sprite->enabled = AF_Component_SetEnabled(startCountdownLabelEntity->sprite->enabled, _state); 
+    AF_ECS_SetComponentEnabled(_ecs, startCountdownUIBackgroundEntity, AF_ECS_SPRITE, _state);
+    AF_ECS_SetComponentEnabled(_ecs, startCountdownLabelEntity, AF_ECS_SPRITE, _state);
 }
 
 // ================ RENDER UI ================ 
@@ -607,11 +607,11 @@ UI_Menu_RenderMainMenu
 Set State for Count down timer UI
  ================ */
 void UI_Menu_RenderMainMenu(AppData* _appData){
-    UI_Menu_MainMenuSetShowing(TRUE);
-    UI_Menu_GameOverUISetShowing(FALSE);
-    UI_Menu_PlayingSetState(FALSE);
-    UI_Menu_CountdownState(FALSE);
-    UI_Menu_PauseMenuSetShowing(FALSE);
+    UI_Menu_MainMenuSetShowing(&_appData->ecs, TRUE);
+    UI_Menu_GameOverUISetShowing(&_appData->ecs, FALSE);
+    UI_Menu_PlayingSetState(&_appData->ecs, FALSE);
+    UI_Menu_CountdownState(&_appData->ecs, FALSE);
+    UI_Menu_PauseMenuSetShowing(&_appData->ecs, FALSE);
 
     // TODO: tidy this up
     if(isMusicPlaying == FALSE){
@@ -644,11 +644,11 @@ Update the UI score elements
 ================ */
 void UI_Menu_RenderPlayingUI(AppData* _appData){
     // TODO: dont run these commands every frame
-    UI_Menu_MainMenuSetShowing(FALSE);
-    UI_Menu_GameOverUISetShowing(FALSE);
-    UI_Menu_PlayingSetState(TRUE);
-    UI_Menu_CountdownState(FALSE);
-    UI_Menu_PauseMenuSetShowing(FALSE);
+    UI_Menu_MainMenuSetShowing(&_appData->ecs, FALSE);
+    UI_Menu_GameOverUISetShowing(&_appData->ecs, FALSE);
+    UI_Menu_PlayingSetState(&_appData->ecs, TRUE);
+    UI_Menu_CountdownState(&_appData->ecs, FALSE);
+    UI_Menu_PauseMenuSetShowing(&_appData->ecs, FALSE);
 
     GameplayData* gameplayData = &_appData->gameplayData;
     sprintf(playerCountCharBuff, " %i%s %i%s%i%s %i", 
@@ -698,10 +698,10 @@ UI_Menu_RenderGameOverScreen
 Render Game Over screen UI
  ================ */
 void UI_Menu_RenderGameOverScreen(AppData* _appData ){
-    UI_Menu_MainMenuSetShowing(FALSE);
-    UI_Menu_PlayingSetState(FALSE);
-    UI_Menu_CountdownState(FALSE);
-    UI_Menu_PauseMenuSetShowing(FALSE);
+    UI_Menu_MainMenuSetShowing(&_appData->ecs, FALSE);
+    UI_Menu_PlayingSetState(&_appData->ecs, FALSE);
+    UI_Menu_CountdownState(&_appData->ecs, FALSE);
+    UI_Menu_PauseMenuSetShowing(&_appData->ecs, FALSE);
     
     
     GameplayData* gameplayData = &_appData->gameplayData;
@@ -730,7 +730,7 @@ void UI_Menu_RenderGameOverScreen(AppData* _appData ){
 
     
     
-     UI_Menu_GameOverUISetShowing(TRUE);
+     UI_Menu_GameOverUISetShowing(&_appData->ecs, TRUE);
     
     // Game Jam CORE MINI GAME end game stuff
     // only call this once
@@ -778,10 +778,10 @@ UI_Menu_RenderCountdown
 Render in game count down clock
  ================ */
 void UI_Menu_RenderCountdown(AppData* _appData){
-    UI_Menu_MainMenuSetShowing(FALSE);
-    UI_Menu_GameOverUISetShowing(FALSE);
-    UI_Menu_PlayingSetState(FALSE);
-    UI_Menu_CountdownState(TRUE);
+    UI_Menu_MainMenuSetShowing(&_appData->ecs, FALSE);
+    UI_Menu_GameOverUISetShowing(&_appData->ecs, FALSE);
+    UI_Menu_PlayingSetState(&_appData->ecs, FALSE);
+    UI_Menu_CountdownState(&_appData->ecs, TRUE);
 
     // this will loop 3 times then progress
     if (countDownTimer > -GO_DELAY)
@@ -812,11 +812,11 @@ UI_Menu_RenderPausedScreen
 Render paused screen
  ================ */
 void UI_Menu_RenderPausedScreen(AppData* _appData){
-    UI_Menu_PauseMenuSetShowing(TRUE);
-    UI_Menu_MainMenuSetShowing(FALSE);
-    UI_Menu_GameOverUISetShowing(FALSE);
-    UI_Menu_PlayingSetState(FALSE);
-    UI_Menu_CountdownState(FALSE);
+    UI_Menu_PauseMenuSetShowing(&_appData->ecs, TRUE);
+    UI_Menu_MainMenuSetShowing(&_appData->ecs, FALSE);
+    UI_Menu_GameOverUISetShowing(&_appData->ecs, FALSE);
+    UI_Menu_PlayingSetState(&_appData->ecs, FALSE);
+    UI_Menu_CountdownState(&_appData->ecs, FALSE);
 
         // detect start button pressed by any player
         
@@ -0,0 +1,16 @@
+// Host stand-in for libdragon.h, only what the AF_Lib headers touch
+#ifndef PHYSICS_BENCH_LIBDRAGON_H
+#define PHYSICS_BENCH_LIBDRAGON_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#define debugf printf
+
+#endif
@@ -0,0 +1,143 @@
+/*
+===============================================================================
+Host benchmark for the AF_Physics broadphase
+
+Fills an AF_ECS with moving box colliders and compares the sort and sweep
+pairs against the old all-against-all loop, both for correctness and time.
+Build with a different AF_ECS_TOTAL_ENTITIES to go past the game's limit.
+===============================================================================
+*/
+#include <libdragon.h>
+#include <time.h>
+#include "AF_Physics.h"
+
+#define FRAMES 600
+#define WORLD_SIZE 40.0f
+
+static AF_ECS ecs;
+static AF_Physics_BroadPhaseState broadPhaseState;
+static Vec3 velocities[AF_ECS_TOTAL_ENTITIES];
+static uint8_t bruteHits[AF_ECS_TOTAL_ENTITIES][AF_ECS_TOTAL_ENTITIES];
+
+static float RandomRange(float _min, float _max){
+	return _min + (_max - _min) * ((float)rand() / (float)RAND_MAX);
+}
+
+static double Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void SetupScene(void){
+	AF_ECS_Init(&ecs);
+	for(uint32_t i = 0; i < ecs.entitiesCount; ++i){
+		// leave a few entities without collider like the game does
+		if(i % 8 == 0){
+			continue;
+		}
+		ecs.colliders[i] = AF_CCollider_ADD_TYPE(AABB);
+		ecs.colliders[i].boundingVolume = (Vec3){RandomRange(0.5f, 3.0f), RandomRange(0.5f, 3.0f), RandomRange(0.5f, 3.0f)};
+		ecs.transforms[i].pos = (Vec3){RandomRange(-WORLD_SIZE, WORLD_SIZE), 0, RandomRange(-WORLD_SIZE, WORLD_SIZE)};
+		velocities[i] = (Vec3){RandomRange(-0.2f, 0.2f), 0, RandomRange(-0.2f, 0.2f)};
+	}
+}
+
+static void MoveScene(void){
+	for(uint32_t i = 0; i < ecs.entitiesCount; ++i){
+		Vec3* pos = &ecs.transforms[i].pos;
+		*pos = Vec3_ADD(*pos, velocities[i]);
+		if(pos->x < -WORLD_SIZE || pos->x > WORLD_SIZE) velocities[i].x = -velocities[i].x;
+		if(pos->z < -WORLD_SIZE || pos->z > WORLD_SIZE) velocities[i].z = -velocities[i].z;
+		ecs.colliders[i].pos = *pos;
+	}
+}
+
+// The old loop: every ordered pair, every entity
+static int BruteForce(void){
+	int hits = 0;
+	AF_Collision collision;
+	for(uint32_t i = 0; i < ecs.entitiesCount; ++i){
+		for(uint32_t x = 0; x < ecs.entitiesCount; ++x){
+			bruteHits[i][x] = 0;
+			if(i == x || AF_Component_GetHas(ecs.colliders[i].enabled) == FALSE || AF_Component_GetHas(ecs.colliders[x].enabled) == FALSE){
+				continue;
+			}
+			if(AF_Physics_AABB_Collide(&ecs, i, x, &collision) == TRUE){
+				bruteHits[i][x] = 1;
+				hits++;
+			}
+		}
+	}
+	return hits;
+}
+
+static int SortAndSweep(void){
+	int hits = 0;
+	AF_Collision collision;
+	AF_Physics_BroadPhase(&ecs, &broadPhaseState);
+	for(uint32_t i = 0; i < broadPhaseState.pairsCount; ++i){
+		if(AF_Physics_AABB_Collide(&ecs, broadPhaseState.pairs[i].entity1, broadPhaseState.pairs[i].entity2, &collision) == TRUE){
+			hits++;
+		}
+	}
+	return hits;
+}
+
+static int CountMismatches(void){
+	// every colliding pair must appear once in the broadphase output, ordered
+	static uint8_t found[AF_ECS_TOTAL_ENTITIES][AF_ECS_TOTAL_ENTITIES];
+	memset(found, 0, sizeof(found));
+	int mismatches = 0;
+	for(uint32_t i = 0; i < broadPhaseState.pairsCount; ++i){
+		AF_Physics_Pair pair = broadPhaseState.pairs[i];
+		if(pair.entity1 >= pair.entity2 || found[pair.entity1][pair.entity2]){
+			mismatches++;
+		}
+		if(i > 0 && AF_Physics_PairCompare(&broadPhaseState.pairs[i - 1], &pair) >= 0){
+			mismatches++;
+		}
+		found[pair.entity1][pair.entity2] = 1;
+	}
+	for(uint32_t i = 0; i < ecs.entitiesCount; ++i){
+		for(uint32_t x = i + 1; x < ecs.entitiesCount; ++x){
+			if(bruteHits[i][x] != bruteHits[x][i] || (bruteHits[i][x] && !found[i][x])){
+				mismatches++;
+			}
+		}
+	}
+	return mismatches;
+}
+
+int main(void){
+	srand(1234);
+	SetupScene();
+	AF_Physics_BroadPhase_Init(&broadPhaseState);
+
+	double bruteTime = 0;
+	double sweepTime = 0;
+	long bruteHitsTotal = 0;
+	long sweepHitsTotal = 0;
+	long pairsTotal = 0;
+	int mismatches = 0;
+	for(int frame = 0; frame < FRAMES; ++frame){
+		MoveScene();
+
+		double start = Now();
+		bruteHitsTotal += BruteForce();
+		double middle = Now();
+		sweepHitsTotal += SortAndSweep();
+		double end = Now();
+
+		bruteTime += middle - start;
+		sweepTime += end - middle;
+		pairsTotal += broadPhaseState.pairsCount;
+		mismatches += CountMismatches();
+	}
+
+	printf("entities: %d, frames: %d\n", AF_ECS_TOTAL_ENTITIES, FRAMES);
+	printf("brute force:    %8.0f ns/frame, %ld ordered hits\n", bruteTime / FRAMES, bruteHitsTotal);
+	printf("sort and sweep: %8.0f ns/frame, %ld hits from %ld pairs\n", sweepTime / FRAMES, sweepHitsTotal, pairsTotal);
+	printf("mismatches: %d\n", mismatches);
+	return (mismatches == 0 && bruteHitsTotal == 2 * sweepHitsTotal) ? 0 : 1;
+}
@@ -21,6 +21,9 @@ MapRenderer::MapRenderer() :
     assertf(surface.get(), "surface is null");
 
     mapSize = 1.f;
+    effectiveCount = -1;
+    coverageEnabled = false;
+    coverageSync = 0;
 
     rdpq_attach(surface.get(), nullptr);
         rdpq_set_scissor(0, 0, MapWidth, MapWidth);
@@ -37,6 +40,10 @@ MapRenderer::MapRenderer() :
         else p_tlut[i] = color_to_packed16(RGBA32(239, 239, 239, 255));
     }
 
+    for (int iy = 0; iy < TileCount; iy++) {
+        rowBlocks.emplace_back(nullptr, rspq_block_free);
+    }
+
     // TODO: use managed memory
     vertices = (T3DVertPacked*)malloc_uncached(sizeof(T3DVertPacked) * (MapWidth/TileSize) * (MapWidth/TileSize) * 2);
 
@@ -126,60 +133,134 @@ MapRenderer::~MapRenderer() {
 }
 
 void MapRenderer::render(float deltaTime, const T3DFrustum &frustum) {
-    for (auto splash = newSplashes.begin(); splash < newSplashes.end(); ++splash) {
-        __splash(*splash);
+    surface_t *s = surface.get();
+
+    // Last frame's blits are normally long done by now
+    if (coverage.hasPending()) {
+        rspq_syncpoint_wait(coverageSync);
+        for (auto &footprint : coverage.getPending()) {
+            __readFootprint(footprint);
+        }
+        coverage.commit((uint8_t*)CachedAddr(s->buffer), s->stride);
     }
-    newSplashes.clear();
 
-    for (auto step = newFootsteps.begin(); step < newFootsteps.end(); ++step) {
-        __step(*step);
+    // Blit everything that landed since the last frame in one go
+    if (newSplashes.begin() < newSplashes.end() || newFootsteps.begin() < newFootsteps.end()) {
+        rdpq_attach(s, nullptr);
+            rspq_block_run(paintBlock.get());
+
+            for (auto splash = newSplashes.begin(); splash < newSplashes.end(); ++splash) {
+                __splash(*splash);
+            }
+
+            for (auto step = newFootsteps.begin(); step < newFootsteps.end(); ++step) {
+                __step(*step);
+            }
+        rdpq_detach();
+
+        // A syncpoint only means the RSP got here, the fence holds it until
+        // the RDP has written the blits too. Skipped if nothing reads them.
+        if (coverage.hasPending()) {
+            rdpq_fence();
+            coverageSync = rspq_syncpoint_new();
+        }
     }
+    newSplashes.clear();
     newFootsteps.clear();
 
+    __updateColors();
+
     rspq_block_run(renderModeBlock.get());
 
-    for (int iy = 0; iy < MapWidth/TileSize; iy++) {
-        for (int ix = 0; ix < MapWidth/TileSize; ix++ ) {
-            int idx = iy * (MapWidth/TileSize) + ix;
+    for (int iy = 0; iy < TileCount; iy++) {
+        int first = iy * TileCount * 2;
+        int last = first + TileCount * 2 - 1;
 
-            int halfSegmentCount = (MapWidth/TileSize)/2;
-            int effectiveCount = (int)(halfSegmentCount * mapSize);
-            if (effectiveCount < MinSegmentCount/2) effectiveCount = MinSegmentCount/2;
+        // This assumes zero height
+        bool visible = t3d_frustum_vs_aabb_s16(&frustum, vertices[first].posA, vertices[last].posB);
+        if (!visible) continue;
 
-            // This assumes zero height
-            bool visible = t3d_frustum_vs_aabb_s16(&frustum, vertices[idx * 2].posA, vertices[idx * 2+1].posB);
-            if (!visible) continue;
+        if (paintTiles.isRowDirty(iy)) __recordRow(iy);
+        rspq_block_run(rowBlocks[iy].get());
+    }
+}
 
-            if (std::abs(ix - halfSegmentCount + 0.5f) > effectiveCount ||
-                std::abs(iy - halfSegmentCount + 0.5f) > effectiveCount) {
-                vertices[idx * 2].rgbaA = 0xAAAAAA'FF;
-                vertices[idx * 2].rgbaB = 0xAAAAAA'FF;
-                vertices[idx * 2+1].rgbaA = 0xAAAAAA'FF;
-                vertices[idx * 2+1].rgbaB = 0xAAAAAA'FF;
-            } else {
-                vertices[idx * 2].rgbaA = 0xFFFFFF'FF;
-                vertices[idx * 2].rgbaB = 0xFFFFFF'FF;
-                vertices[idx * 2+1].rgbaA = 0xFFFFFF'FF;
-                vertices[idx * 2+1].rgbaB = 0xFFFFFF'FF;
+void MapRenderer::__recordRow(int iy) {
+    uint16_t painted = paintTiles.getRow(iy);
+    uint16_t allTiles = (1u << TileCount) - 1;
+
+    // The textures are read from the surface when the block runs, so new paint
+    // on an already painted tile doesn't need a new block
+    rspq_block_begin();
+        // The whole row fits in the vertex cache
+        t3d_vert_load(&vertices[iy * TileCount * 2], 0, TileCount * 4);
+
+        if (painted != allTiles) {
+            // A clean tile is all TLUT entry 0, draw it flat instead of
+            // uploading it
+            rdpq_sync_pipe();
+            rdpq_set_prim_color(RGBA32(239, 239, 239, 255));
+            rdpq_mode_combiner(RDPQ_COMBINER1((PRIM, ZERO, SHADE, ZERO), (ZERO, ZERO, ZERO, SHADE)));
+            t3d_state_set_drawflags((T3DDrawFlags)(T3D_FLAG_DEPTH | T3D_FLAG_SHADED));
+
+            for (int ix = 0; ix < TileCount; ix++) {
+                if (paintTiles.isPainted(ix, iy)) continue;
+                t3d_tri_draw(ix * 4, ix * 4 + 1, ix * 4 + 2);
+                t3d_tri_draw(ix * 4 + 2, ix * 4 + 1, ix * 4 + 3);
             }
+        }
 
-            int pixelX = ix * TileSize;
-            int pixelY = iy * TileSize;
-            rdpq_sync_tile();
-            rdpq_sync_load();
+        if (painted != 0) {
             rdpq_sync_pipe();
+            rdpq_mode_combiner(RDPQ_COMBINER_TEX_SHADE);
+            t3d_state_set_drawflags((T3DDrawFlags)(T3D_FLAG_TEXTURED | T3D_FLAG_DEPTH | T3D_FLAG_SHADED));
+
+            for (int ix = 0; ix < TileCount; ix++) {
+                if (!paintTiles.isPainted(ix, iy)) continue;
 
-            rdpq_tex_upload_sub(TILE0, surface.get(), NULL, pixelX, pixelY, pixelX+TileSize, pixelY+TileSize);
+                int pixelX = ix * TileSize;
+                int pixelY = iy * TileSize;
+                rdpq_sync_tile();
+                rdpq_sync_load();
+                rdpq_sync_pipe();
 
-            // TODO: this is not efficient, load more vertices
-            t3d_vert_load(&vertices[idx * 2], 0, 4);
+                rdpq_tex_upload_sub(TILE0, surface.get(), NULL, pixelX, pixelY, pixelX+TileSize, pixelY+TileSize);
 
-            t3d_tri_draw(0, 1, 2);
-            t3d_tri_draw(2, 1, 3);
+                t3d_tri_draw(ix * 4, ix * 4 + 1, ix * 4 + 2);
+                t3d_tri_draw(ix * 4 + 2, ix * 4 + 1, ix * 4 + 3);
+            }
+        }
+    rowBlocks[iy] = U::RSPQBlock(rspq_block_end(), rspq_block_free);
+
+    paintTiles.cleanRow(iy);
+}
+
+void MapRenderer::__updateColors() {
+    int halfSegmentCount = TileCount/2;
+    int count = (int)(halfSegmentCount * mapSize);
+    if (count < MinSegmentCount/2) count = MinSegmentCount/2;
+
+    // The blocks load the vertices when they run, no need to record them again
+    if (count == effectiveCount) return;
+    effectiveCount = count;
+
+    for (int iy = 0; iy < TileCount; iy++) {
+        for (int ix = 0; ix < TileCount; ix++) {
+            int idx = iy * TileCount + ix;
+            uint32_t color = 0xFFFFFF'FF;
+            if (std::abs(ix - halfSegmentCount + 0.5f) > effectiveCount ||
+                std::abs(iy - halfSegmentCount + 0.5f) > effectiveCount) {
+                color = 0xAAAAAA'FF;
+            }
+            vertices[idx * 2].rgbaA = color;
+            vertices[idx * 2].rgbaB = color;
+            vertices[idx * 2+1].rgbaA = color;
+            vertices[idx * 2+1].rgbaB = color;
         }
     }
 }
 
+// Expects the surface to be attached with paintBlock's mode
 void MapRenderer::__splash(Splash &splash) {
     int safeMargin = 52;
     if (splash.x > MapWidth - safeMargin) return;
@@ -190,35 +271,38 @@ void MapRenderer::__splash(Splash &splash) {
     int id = randomRange(0, SplashVariations - 1);
     surface_t s = sprite_get_pixels(splashSprites[id].get());
 
-    rdpq_attach(surface.get(), nullptr);
-        rspq_block_run(paintBlock.get());
-
-        rdpq_set_scissor(splash.x - safeMargin, splash.y - safeMargin, splash.x + safeMargin, splash.y + safeMargin);
-        rdpq_blitparms_t params {
-            .width = 32,
-            .height = 32,
-            .flip_x = (bool)randomRange(0, 1),
-            .flip_y = true,
-            .cx = 16,
-            .cy = 16,
-            .scale_x = 0.8f + static_cast<float>(rand()) / RAND_MAX,
-            .scale_y = 0.8f + static_cast<float>(rand()) / RAND_MAX,
-            .theta = splash.direction,
-        };
-        // Set all channels to the same value b/c for an I8 target, RDP will
-        // interleave R&G channels
-        rdpq_set_prim_color(
-            RGBA32(
-                (uint8_t)(splash.team + 1),
-                (uint8_t)(splash.team + 1),
-                (uint8_t)(splash.team + 1),
-                255
-            )
-        );
-        rdpq_tex_blit(&s, splash.x, splash.y, &params);
-    rdpq_detach();
+    rdpq_set_scissor(splash.x - safeMargin, splash.y - safeMargin, splash.x + safeMargin, splash.y + safeMargin);
+    rdpq_blitparms_t params {
+        .width = 32,
+        .height = 32,
+        .flip_x = (bool)randomRange(0, 1),
+        .flip_y = true,
+        .cx = 16,
+        .cy = 16,
+        .scale_x = 0.8f + static_cast<float>(rand()) / RAND_MAX,
+        .scale_y = 0.8f + static_cast<float>(rand()) / RAND_MAX,
+        .theta = splash.direction,
+    };
+
+    float reach = PaintTiles::getBlitReach(params.width, params.height, params.cx, params.cy, params.scale_x, params.scale_y);
+    reach = std::min(reach, (float)safeMargin);
+    paintTiles.paint(splash.x, splash.y, reach);
+    __track(splash.x, splash.y, reach);
+
+    // Set all channels to the same value b/c for an I8 target, RDP will
+    // interleave R&G channels
+    rdpq_set_prim_color(
+        RGBA32(
+            (uint8_t)(splash.team + 1),
+            (uint8_t)(splash.team + 1),
+            (uint8_t)(splash.team + 1),
+            255
+        )
+    );
+    rdpq_tex_blit(&s, splash.x, splash.y, &params);
 }
 
+// Expects the surface to be attached with paintBlock's mode
 void MapRenderer::__step(Splash &step) {
     if (step.x > MapWidth - 16) return;
     if (step.x < 16) return;
@@ -227,32 +311,33 @@ void MapRenderer::__step(Splash &step) {
 
     surface_t s = sprite_get_pixels(footstep.get());
 
-    rdpq_attach(surface.get(), nullptr);
-        rspq_block_run(paintBlock.get());
-
-        rdpq_set_scissor(step.x - 16, step.y - 16, step.x + 16, step.y + 16);
-        rdpq_blitparms_t params {
-            .width = 8,
-            .height = 8,
-            .flip_x = !step.isFirst,
-            .flip_y = true,
-            .cx = 0,
-            .cy = 4,
-            .theta = step.direction,
-
-        };
-        // Set all channels to the same value b/c for an I8 target, RDP will
-        // interleave R&G channels
-        rdpq_set_prim_color(
-            RGBA32(
-                (uint8_t)(step.team + 1),
-                (uint8_t)(step.team + 1),
-                (uint8_t)(step.team + 1),
-                255
-            )
-        );
-        rdpq_tex_blit(&s, step.x, step.y, &params);
-    rdpq_detach();
+    rdpq_set_scissor(step.x - 16, step.y - 16, step.x + 16, step.y + 16);
+    rdpq_blitparms_t params {
+        .width = 8,
+        .height = 8,
+        .flip_x = !step.isFirst,
+        .flip_y = true,
+        .cx = 0,
+        .cy = 4,
+        .theta = step.direction,
+
+    };
+
+    float reach = PaintTiles::getBlitReach(params.width, params.height, params.cx, params.cy, 1.f, 1.f);
+    paintTiles.paint(step.x, step.y, reach);
+    __track(step.x, step.y, reach);
+
+    // Set all channels to the same value b/c for an I8 target, RDP will
+    // interleave R&G channels
+    rdpq_set_prim_color(
+        RGBA32(
+            (uint8_t)(step.team + 1),
+            (uint8_t)(step.team + 1),
+            (uint8_t)(step.team + 1),
+            255
+        )
+    );
+    rdpq_tex_blit(&s, step.x, step.y, &params);
 }
 
 void MapRenderer::splash(float x, float y, PlyNum team, float direction) {
@@ -292,4 +377,43 @@ float MapRenderer::getHalfSize() {
 void MapRenderer::setSize(float size) {
     assertf(size <= 1.f && size >= 0.f, "Incorrect size");
     mapSize = size;
+}
+
+// The surface through the cache, with the footprint's lines fetched again
+// since the RDP may have written to them. Reading it uncached would cost a
+// full memory access per texel.
+const uint8_t *MapRenderer::__readFootprint(const PaintCoverage::Footprint &footprint) {
+    surface_t *s = surface.get();
+    uint8_t *buffer = (uint8_t*)CachedAddr(s->buffer);
+
+    // Only ever read by the CPU, so there's nothing dirty to lose by
+    // invalidating whole lines
+    int x0 = footprint.x & ~15;
+    int x1 = (footprint.x + footprint.width + 15) & ~15;
+    for (int py = footprint.y; py < footprint.y + footprint.height; py++) {
+        data_cache_hit_invalidate(buffer + py * s->stride + x0, x1 - x0);
+    }
+    return buffer;
+}
+
+void MapRenderer::__track(float x, float y, float reach) {
+    if (!coverageEnabled) return;
+
+    auto footprint = PaintCoverage::getFootprint(x, y, reach);
+    if (footprint.width == 0) return;
+    coverage.track(__readFootprint(footprint), surface.get()->stride, footprint);
+}
+
+// Counts the whole surface on the first call, and keeps the counts up to date
+// from then on
+const PaintCoverage &MapRenderer::getCoverage() {
+    if (!coverageEnabled) {
+        surface_t *s = surface.get();
+        uint8_t *buffer = (uint8_t*)CachedAddr(s->buffer);
+        rspq_wait();
+        data_cache_hit_invalidate(buffer, s->stride * MapWidth);
+        coverage.rebuild(buffer, s->stride);
+        coverageEnabled = true;
+    }
+    return coverage;
 }
\ No newline at end of file
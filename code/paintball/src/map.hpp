@@ -10,20 +10,23 @@
 #include <memory>
 #include <vector>
 #include <cstdlib>
+#include <algorithm>
 
 #include "./constants.hpp"
 #include "./wrappers.hpp"
 #include "./list.hpp"
 #include "./common.hpp"
+#include "./paint-tiles.hpp"
+#include "./paint-coverage.hpp"
 
 #include "../../../core.h"
 
-constexpr int MapWidth = 32 * 16;
-constexpr int TileSize = 32;
 constexpr int SegmentSize = 75;
 constexpr int MinSegmentCount = 4;
 constexpr int SplashVariations = 4;
 
+static_assert(PlayerCount + 1 <= PaintLayers, "Not enough paint layers for all players");
+
 struct Splash {
     float x;
     float y;
@@ -40,6 +43,20 @@ class MapRenderer
         U::RSPQBlock renderModeBlock;
         U::RSPQBlock paintBlock;
         // U::RSPQBlock drawBlock;
+
+        // One block per tile row, draws the row's clean tiles flat and
+        // uploads only the painted ones. Re-recorded when a tile in the row
+        // gets its first paint.
+        std::vector<U::RSPQBlock> rowBlocks;
+        PaintTiles paintTiles;
+
+        // Only kept up to date once something asks for it
+        PaintCoverage coverage;
+        bool coverageEnabled;
+        // Signals the RDP is done with the blits coverage is waiting on,
+        // created behind an rdpq_fence
+        rspq_syncpoint_t coverageSync;
+
         U::Sprite footstep;
         U::Sprite splashSprites[SplashVariations];
 
@@ -54,9 +71,15 @@ class MapRenderer
 
         // As a ratio of the maximum map size
         float mapSize;
+        // Tiles per side, from the center, that are drawn in full color
+        int effectiveCount;
 
         void __splash(Splash &splash);
         void __step(Splash &);
+        void __recordRow(int iy);
+        void __updateColors();
+        void __track(float x, float y, float reach);
+        const uint8_t *__readFootprint(const PaintCoverage::Footprint &footprint);
     public:
         MapRenderer();
         ~MapRenderer();
@@ -65,6 +88,7 @@ class MapRenderer
         void step(float x, float y, PlyNum team, float direction, bool firstStep);
         float getHalfSize();
         void setSize(float size);
+        const PaintCoverage &getCoverage();
 };
 
 #endif // __MAP_H
@@ -0,0 +1,231 @@
+#ifndef __PAINT_COVERAGE_H
+#define __PAINT_COVERAGE_H
+
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "./paint-tiles.hpp"
+
+// Paint surface values, 0 is clean and team n paints n + 1
+constexpr int PaintLayers = 5;
+constexpr int NoOwner = -1;
+
+// Footprints are read and compared 4 texels at a time
+typedef uint32_t __attribute__((__may_alias__)) PaintWord;
+constexpr int PaintWordSize = sizeof(PaintWord);
+
+static_assert(MapWidth % PaintWordSize == 0, "Surface rows must be whole words");
+
+// How many texels of the paint surface each team owns, per tile and in total.
+// Kept up to date from the footprints of the blits instead of scanning the
+// surface: a footprint is copied before its blit is queued, and compared to
+// the surface once the RDP is done with it.
+class PaintCoverage
+{
+    public:
+        struct Footprint {
+            // Word aligned on x
+            int x;
+            int y;
+            int width;
+            int height;
+            // Into before
+            std::size_t offset;
+        };
+
+    private:
+        uint16_t tileCounts[TileCount * TileCount][PaintLayers];
+        int8_t tileOwners[TileCount * TileCount];
+        uint32_t totals[PaintLayers];
+
+        std::vector<Footprint> pending;
+        std::vector<uint32_t> before;
+
+        // Texels compared in the last commit
+        uint32_t lastDiffed;
+
+        void __updateOwner(int tile) {
+            int owner = NoOwner;
+            int best = 0;
+            for (int layer = 1; layer < PaintLayers; layer++) {
+                if (tileCounts[tile][layer] > best) {
+                    best = tileCounts[tile][layer];
+                    owner = layer - 1;
+                }
+            }
+            tileOwners[tile] = owner;
+        };
+
+    public:
+        PaintCoverage() {
+            reset();
+        };
+
+        // The whole surface is clean
+        void reset() {
+            for (int tile = 0; tile < TileCount * TileCount; tile++) {
+                tileCounts[tile][0] = TileSize * TileSize;
+                for (int layer = 1; layer < PaintLayers; layer++) {
+                    tileCounts[tile][layer] = 0;
+                }
+                tileOwners[tile] = NoOwner;
+            }
+            totals[0] = MapWidth * MapWidth;
+            for (int layer = 1; layer < PaintLayers; layer++) {
+                totals[layer] = 0;
+            }
+            pending.clear();
+            before.clear();
+            lastDiffed = 0;
+        };
+
+        // Count the whole surface from scratch, for when tracking starts late
+        void rebuild(const uint8_t *surface, int stride) {
+            reset();
+            for (int tile = 0; tile < TileCount * TileCount; tile++) {
+                tileCounts[tile][0] = 0;
+            }
+            totals[0] = 0;
+
+            for (int py = 0; py < MapWidth; py++) {
+                const uint8_t *row = surface + py * stride;
+                for (int px = 0; px < MapWidth; px++) {
+                    tileCounts[(py / TileSize) * TileCount + px / TileSize][row[px]]++;
+                    totals[row[px]]++;
+                }
+            }
+            for (int tile = 0; tile < TileCount * TileCount; tile++) {
+                __updateOwner(tile);
+            }
+        };
+
+        // Texels a blit reaching up to radius pixels away from x, y can
+        // change, width is 0 if it's all off the surface
+        static Footprint getFootprint(float x, float y, float radius) {
+            int x0 = (int)std::floor(x - radius);
+            int x1 = (int)std::ceil(x + radius);
+            int y0 = (int)std::floor(y - radius);
+            int y1 = (int)std::ceil(y + radius);
+            if (x0 < 0) x0 = 0;
+            if (y0 < 0) y0 = 0;
+            if (x1 > MapWidth) x1 = MapWidth;
+            if (y1 > MapWidth) y1 = MapWidth;
+            if (x0 >= x1 || y0 >= y1) return Footprint {0, 0, 0, 0, 0};
+
+            x0 &= ~(PaintWordSize - 1);
+            x1 = (x1 + PaintWordSize - 1) & ~(PaintWordSize - 1);
+            return Footprint {x0, y0, x1 - x0, y1 - y0, 0};
+        };
+
+        // Copy a footprint from getFootprint. Has to be called before its
+        // blit is queued. The surface must be word aligned.
+        void track(const uint8_t *surface, int stride, Footprint footprint) {
+            if (footprint.width == 0) return;
+
+            int words = footprint.width / PaintWordSize;
+            footprint.offset = before.size();
+            before.resize(before.size() + words * footprint.height);
+
+            PaintWord *copy = &before[footprint.offset];
+            for (int py = footprint.y; py < footprint.y + footprint.height; py++) {
+                const PaintWord *row = (const PaintWord*)(surface + py * stride + footprint.x);
+                for (int w = 0; w < words; w++) {
+                    *copy++ = row[w];
+                }
+            }
+            pending.push_back(footprint);
+        };
+
+        bool hasPending() const {
+            return !pending.empty();
+        };
+
+        const std::vector<Footprint> &getPending() const {
+            return pending;
+        };
+
+        // Count what the tracked blits changed. Has to be called once the RDP
+        // has finished all of them.
+        void commit(const uint8_t *surface, int stride) {
+            lastDiffed = 0;
+            for (std::size_t i = 0; i < pending.size(); i++) {
+                const Footprint &footprint = pending[i];
+                const PaintWord *copy = &before[footprint.offset];
+                int words = footprint.width / PaintWordSize;
+                uint16_t touchedTiles[TileCount] = {0};
+
+                for (int py = footprint.y; py < footprint.y + footprint.height; py++) {
+                    const PaintWord *row = (const PaintWord*)(surface + py * stride + footprint.x);
+                    for (int w = 0; w < words; w++) {
+                        uint32_t fromWord = copy[w];
+                        uint32_t toWord = row[w];
+                        if (fromWord == toWord) continue;
+
+                        // Byte order doesn't matter, both are read the same way
+                        const uint8_t *from = (const uint8_t*)&fromWord;
+                        const uint8_t *to = (const uint8_t*)&toWord;
+                        int px = footprint.x + w * PaintWordSize;
+                        int tile = (py / TileSize) * TileCount + px / TileSize;
+                        for (int b = 0; b < PaintWordSize; b++) {
+                            if (from[b] == to[b]) continue;
+                            tileCounts[tile][from[b]]--;
+                            tileCounts[tile][to[b]]++;
+                            totals[from[b]]--;
+                            totals[to[b]]++;
+                        }
+                        touchedTiles[py / TileSize] |= (uint16_t)(1u << (px / TileSize));
+                    }
+                    copy += words;
+                }
+                lastDiffed += footprint.width * footprint.height;
+
+                for (int iy = 0; iy < TileCount; iy++) {
+                    for (int ix = 0; ix < TileCount; ix++) {
+                        if ((touchedTiles[iy] >> ix) & 1) __updateOwner(iy * TileCount + ix);
+                    }
+                }
+
+                // Later footprints may have copied these texels before this
+                // blit landed, but they're counted with their new value now
+                for (std::size_t j = i + 1; j < pending.size(); j++) {
+                    const Footprint &later = pending[j];
+                    int x0 = std::max(footprint.x, later.x);
+                    int x1 = std::min(footprint.x + footprint.width, later.x + later.width);
+                    int y0 = std::max(footprint.y, later.y);
+                    int y1 = std::min(footprint.y + footprint.height, later.y + later.height);
+                    int laterWords = later.width / PaintWordSize;
+                    for (int py = y0; py < y1; py++) {
+                        const PaintWord *row = (const PaintWord*)(surface + py * stride);
+                        for (int px = x0; px < x1; px += PaintWordSize) {
+                            before[later.offset + (py - later.y) * laterWords + (px - later.x) / PaintWordSize] = row[px / PaintWordSize];
+                        }
+                    }
+                }
+            }
+            pending.clear();
+            before.clear();
+        };
+
+        // Texels painted by a team, or clean ones for NoOwner
+        uint32_t getTotal(int team) const {
+            return totals[team + 1];
+        };
+
+        uint16_t getTileCount(int ix, int iy, int team) const {
+            return tileCounts[iy * TileCount + ix][team + 1];
+        };
+
+        // The team with the most paint on a tile, NoOwner if it's clean.
+        // Ties go to the lowest team.
+        int getTileOwner(int ix, int iy) const {
+            return tileOwners[iy * TileCount + ix];
+        };
+
+        uint32_t getLastDiffed() const {
+            return lastDiffed;
+        };
+};
+
+#endif // __PAINT_COVERAGE_H
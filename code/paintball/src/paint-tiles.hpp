@@ -0,0 +1,93 @@
+#ifndef __PAINT_TILES_H
+#define __PAINT_TILES_H
+
+#include <cstdint>
+#include <cmath>
+
+// Kept free of libdragon so the host tools can use it as is
+constexpr int MapWidth = 32 * 16;
+constexpr int TileSize = 32;
+constexpr int TileCount = MapWidth / TileSize;
+
+static_assert(TileCount <= 16, "Tile rows are stored in 16 bits");
+
+// Keeps track of which tiles of the paint surface have paint on them, and
+// which tile rows changed since the map last recorded their draw calls.
+// Paint never comes off, so a tile only ever goes from clean to painted.
+class PaintTiles
+{
+    private:
+        // One bit per tile, bit ix of row iy
+        uint16_t painted[TileCount];
+        uint16_t dirtyRows;
+
+    public:
+        PaintTiles() {
+            reset();
+        };
+
+        // Everything clean, and every row needs recording
+        void reset() {
+            for (int iy = 0; iy < TileCount; iy++) {
+                painted[iy] = 0;
+            }
+            dirtyRows = (uint16_t)((1u << TileCount) - 1);
+        };
+
+        // Mark every tile that a blit reaching up to radius pixels away from
+        // x, y (in surface pixels) can touch
+        void paint(float x, float y, float radius) {
+            int x0 = (int)std::floor((x - radius) / TileSize);
+            int x1 = (int)std::floor((x + radius) / TileSize);
+            int y0 = (int)std::floor((y - radius) / TileSize);
+            int y1 = (int)std::floor((y + radius) / TileSize);
+            if (x0 < 0) x0 = 0;
+            if (y0 < 0) y0 = 0;
+            if (x1 > TileCount - 1) x1 = TileCount - 1;
+            if (y1 > TileCount - 1) y1 = TileCount - 1;
+            if (x0 > x1 || y0 > y1) return;
+
+            uint16_t bits = (uint16_t)(((1u << (x1 - x0 + 1)) - 1) << x0);
+            for (int iy = y0; iy <= y1; iy++) {
+                if ((painted[iy] & bits) != bits) {
+                    painted[iy] |= bits;
+                    dirtyRows |= (uint16_t)(1u << iy);
+                }
+            }
+        };
+
+        // How far from its position a sprite blit can reach, for a sprite
+        // turning around cx, cy. Doesn't depend on the order rotation and
+        // scaling are applied in. Adds a pixel for filtering.
+        static float getBlitReach(float width, float height, float cx, float cy, float scaleX, float scaleY) {
+            float dx = std::fmax(cx, width - cx);
+            float dy = std::fmax(cy, height - cy);
+            return std::fmax(scaleX, scaleY) * std::sqrt(dx * dx + dy * dy) + 1.f;
+        };
+
+        bool isPainted(int ix, int iy) const {
+            return (painted[iy] >> ix) & 1;
+        };
+
+        uint16_t getRow(int iy) const {
+            return painted[iy];
+        };
+
+        bool isRowDirty(int iy) const {
+            return (dirtyRows >> iy) & 1;
+        };
+
+        void cleanRow(int iy) {
+            dirtyRows &= (uint16_t)~(1u << iy);
+        };
+
+        int getPaintedCount() const {
+            int count = 0;
+            for (int iy = 0; iy < TileCount; iy++) {
+                count += __builtin_popcount(painted[iy]);
+            }
+            return count;
+        };
+};
+
+#endif // __PAINT_TILES_H
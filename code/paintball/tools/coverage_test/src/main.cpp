@@ -0,0 +1,270 @@
+/**
+ * Host check of the paint coverage index.
+ *
+ * Paints a CPU copy of the CI8 paint surface with seeded streams of splashes
+ * and footsteps, rasterizing rotated and scaled sprite masks the way
+ * rdpq_tex_blit would place them. Each blit's footprint is tracked before
+ * the blit lands, like MapRenderer does, and committed once a frame. Blits
+ * land either right after being queued or at the end of the frame, so
+ * overlapping footprints are copied both before and after an earlier blit
+ * changed them, the way the RDP can race the CPU.
+ *
+ * Like the game, tracking only starts when the index is first asked for,
+ * some way into the run, with a full count of the surface.
+ *
+ * Every few frames the team totals, per-tile counts and tile owners are
+ * compared to a scan of the whole surface. Exits with an error on the first
+ * mismatch. Also reports how many texels the commits compared, and how many
+ * 16 byte cache lines MapRenderer would fetch for the copies and the diffs,
+ * against the size of a full scan.
+ *
+ * Usage: coverage_test [frames] [seed]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <random>
+
+#include "../../../src/paint-coverage.hpp"
+
+constexpr int PlayerCount = 4;
+constexpr int SplashMargin = 52;
+constexpr int StepMargin = 16;
+constexpr int SplashVariations = 4;
+constexpr int CheckEvery = 15;
+constexpr int CacheLine = 16;
+
+constexpr int DefaultFrames = 20000;
+constexpr unsigned DefaultSeed = 1;
+
+struct Blit {
+    float x;
+    float y;
+    int width;
+    int height;
+    float cx;
+    float cy;
+    float scaleX;
+    float scaleY;
+    float theta;
+    int margin;
+    const uint8_t *mask;
+    uint8_t value;
+};
+
+alignas(CacheLine) static uint8_t surface[MapWidth * MapWidth];
+static uint8_t splashMasks[SplashVariations][32 * 32];
+static uint8_t stepMask[8 * 8];
+static std::mt19937 rng;
+
+static float randomFloat(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(rng);
+}
+
+static int randomInt(int min, int max) {
+    return std::uniform_int_distribution<int>(min, max)(rng);
+}
+
+// Blobby stand-ins for the splash sprites, with holes so partial overwrites
+// happen too
+static void makeMasks() {
+    for (int i = 0; i < SplashVariations; i++) {
+        for (int v = 0; v < 32; v++) {
+            for (int u = 0; u < 32; u++) {
+                float dx = u + 0.5f - 16, dy = v + 0.5f - 16;
+                float limit = 10 + 5 * std::sin(std::atan2(dy, dx) * (3 + i));
+                splashMasks[i][v * 32 + u] = dx * dx + dy * dy < limit * limit && randomInt(0, 7) != 0;
+            }
+        }
+    }
+    for (int v = 0; v < 8; v++) {
+        for (int u = 0; u < 8; u++) {
+            stepMask[v * 8 + u] = u > 0 && u < 7 && v > 1 && v < 7;
+        }
+    }
+}
+
+// Point sampled inverse mapping of a scaled, then rotated sprite, clipped to
+// the scissor
+static void applyBlit(const Blit &blit) {
+    float c = std::cos(blit.theta);
+    float s = std::sin(blit.theta);
+    int x0 = std::max(0, (int)(blit.x - blit.margin));
+    int y0 = std::max(0, (int)(blit.y - blit.margin));
+    int x1 = std::min(MapWidth, (int)(blit.x + blit.margin));
+    int y1 = std::min(MapWidth, (int)(blit.y + blit.margin));
+
+    for (int py = y0; py < y1; py++) {
+        for (int px = x0; px < x1; px++) {
+            float dx = px + 0.5f - blit.x;
+            float dy = py + 0.5f - blit.y;
+            float u = (dx * c + dy * s) / blit.scaleX + blit.cx;
+            float v = (-dx * s + dy * c) / blit.scaleY + blit.cy;
+            if (u < 0 || v < 0 || u >= blit.width || v >= blit.height) continue;
+            if (blit.mask[(int)v * blit.width + (int)u]) surface[py * MapWidth + px] = blit.value;
+        }
+    }
+}
+
+static bool makeSplash(float x, float y, int team, Blit &blit, float &reach) {
+    if (x > MapWidth - SplashMargin || x < SplashMargin) return false;
+    if (y > MapWidth - SplashMargin || y < SplashMargin) return false;
+
+    blit = Blit {
+        x, y, 32, 32, 16, 16,
+        0.8f + randomFloat(0, 1), 0.8f + randomFloat(0, 1),
+        randomFloat(0, 6.28f), SplashMargin,
+        splashMasks[randomInt(0, SplashVariations - 1)], (uint8_t)(team + 1),
+    };
+    reach = std::fmin(PaintTiles::getBlitReach(32, 32, 16, 16, blit.scaleX, blit.scaleY), (float)SplashMargin);
+    return true;
+}
+
+static bool makeStep(float x, float y, int team, Blit &blit, float &reach) {
+    if (x > MapWidth - StepMargin || x < StepMargin) return false;
+    if (y > MapWidth - StepMargin || y < StepMargin) return false;
+
+    blit = Blit { x, y, 8, 8, 0, 4, 1, 1, randomFloat(0, 6.28f), StepMargin, stepMask, (uint8_t)(team + 1) };
+    reach = PaintTiles::getBlitReach(8, 8, 0, 4, 1, 1);
+    return true;
+}
+
+// Lines MapRenderer::__readFootprint invalidates, and the reads fetch again
+static long getCacheLines(const PaintCoverage::Footprint &footprint) {
+    int x0 = footprint.x & ~(CacheLine - 1);
+    int x1 = (footprint.x + footprint.width + CacheLine - 1) & ~(CacheLine - 1);
+    return (long)footprint.height * (x1 - x0) / CacheLine;
+}
+
+// Count everything again from the surface and compare
+static bool check(const PaintCoverage &coverage, int frame) {
+    uint32_t totals[PaintLayers] = {0};
+    for (int iy = 0; iy < TileCount; iy++) {
+        for (int ix = 0; ix < TileCount; ix++) {
+            uint32_t counts[PaintLayers] = {0};
+            for (int py = iy * TileSize; py < (iy + 1) * TileSize; py++) {
+                for (int px = ix * TileSize; px < (ix + 1) * TileSize; px++) {
+                    counts[surface[py * MapWidth + px]]++;
+                }
+            }
+
+            int owner = NoOwner;
+            uint32_t best = 0;
+            for (int layer = 0; layer < PaintLayers; layer++) {
+                totals[layer] += counts[layer];
+                if (layer > 0 && counts[layer] > best) {
+                    best = counts[layer];
+                    owner = layer - 1;
+                }
+                if (coverage.getTileCount(ix, iy, layer - 1) != counts[layer]) {
+                    printf("FAIL: frame %d, tile %d,%d has %u texels of layer %d, index says %u\n",
+                        frame, ix, iy, counts[layer], layer, coverage.getTileCount(ix, iy, layer - 1));
+                    return false;
+                }
+            }
+            if (coverage.getTileOwner(ix, iy) != owner) {
+                printf("FAIL: frame %d, tile %d,%d is owned by %d, index says %d\n",
+                    frame, ix, iy, owner, coverage.getTileOwner(ix, iy));
+                return false;
+            }
+        }
+    }
+
+    for (int layer = 0; layer < PaintLayers; layer++) {
+        if (coverage.getTotal(layer - 1) != totals[layer]) {
+            printf("FAIL: frame %d, layer %d has %u texels, index says %u\n",
+                frame, layer, totals[layer], coverage.getTotal(layer - 1));
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : DefaultFrames;
+    unsigned seed = argc > 2 ? strtoul(argv[2], NULL, 0) : DefaultSeed;
+    rng.seed(seed);
+    makeMasks();
+
+    PaintCoverage coverage;
+    float playerX[PlayerCount], playerY[PlayerCount];
+    for (int p = 0; p < PlayerCount; p++) {
+        playerX[p] = randomFloat(64, MapWidth - 64);
+        playerY[p] = randomFloat(64, MapWidth - 64);
+    }
+
+    long diffed = 0;
+    long lines = 0;
+    long checks = 0;
+    int trackedFrames = 0;
+    int firstTracked = frames / 10;
+    double commitTime = 0, scanTime = 0;
+
+    for (int frame = 0; frame < frames; frame++) {
+        bool tracking = frame >= firstTracked;
+        if (frame == firstTracked) coverage.rebuild(surface, MapWidth);
+
+        Blit deferred[PlayerCount * 5];
+        int deferredCount = 0;
+
+        for (int p = 0; p < PlayerCount; p++) {
+            playerX[p] = std::fmin(std::fmax(playerX[p] + randomFloat(-6, 6), 0), MapWidth - 1);
+            playerY[p] = std::fmin(std::fmax(playerY[p] + randomFloat(-6, 6), 0), MapWidth - 1);
+
+            // Bursts land close together so footprints overlap within a frame
+            int shots = randomInt(0, 100) < 20 ? randomInt(1, 4) : 0;
+            for (int i = 0; i <= shots; i++) {
+                Blit blit;
+                float reach;
+                bool queued = i == 0
+                    ? makeStep(playerX[p], playerY[p], p, blit, reach)
+                    : makeSplash(playerX[p] + randomFloat(-40, 40), playerY[p] + randomFloat(-40, 40), randomInt(0, PlayerCount - 1), blit, reach);
+                if (!queued) continue;
+
+                if (tracking) {
+                    auto footprint = PaintCoverage::getFootprint(blit.x, blit.y, reach);
+                    lines += getCacheLines(footprint);
+                    coverage.track(surface, MapWidth, footprint);
+                }
+                if (randomInt(0, 1)) applyBlit(blit);
+                else deferred[deferredCount++] = blit;
+            }
+        }
+        for (int i = 0; i < deferredCount; i++) {
+            applyBlit(deferred[i]);
+        }
+
+        if (!tracking) continue;
+        trackedFrames++;
+
+        for (auto &footprint : coverage.getPending()) {
+            lines += getCacheLines(footprint);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        coverage.commit(surface, MapWidth);
+        commitTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        diffed += coverage.getLastDiffed();
+
+        if (frame % CheckEvery == 0 || frame == frames - 1) {
+            start = std::chrono::steady_clock::now();
+            if (!check(coverage, frame)) return 1;
+            scanTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            checks++;
+        }
+    }
+
+    printf("%d frames, seed %u, tracked from frame %d, %ld full checks passed\n", frames, seed, firstTracked, checks);
+    printf("clean %.1f%%", 100.0 * coverage.getTotal(NoOwner) / (MapWidth * MapWidth));
+    for (int p = 0; p < PlayerCount; p++) {
+        printf(", team %d %.1f%%", p + 1, 100.0 * coverage.getTotal(p) / (MapWidth * MapWidth));
+    }
+    printf("\n");
+    printf("texels compared/frame: index %.0f, full scan %d\n", (double)diffed / trackedFrames, MapWidth * MapWidth);
+    printf("cache lines read/frame: index %.0f, full scan %d\n", (double)lines / trackedFrames, MapWidth * MapWidth / CacheLine);
+    printf("host time/frame: commit %.2f us, full scan %.1f us\n", commitTime / trackedFrames, scanTime / checks);
+    return 0;
+}
@@ -0,0 +1,230 @@
+/**
+ * Host replay of paint splash streams for the map renderer.
+ *
+ * Plays seeded rounds of splashes and footsteps the way the game queues them:
+ * four players wander the map, leave a footstep every few frames and fire
+ * bullets that splash where they land. Every frame's paint goes through
+ * PaintTiles like MapRenderer::render does, and the replay counts what the
+ * old renderer (upload every tile, attach once per blit) and the new one
+ * (upload painted tiles only, one attach per frame, record dirty rows) would
+ * have sent to the RDP.
+ *
+ * Each blit is also rasterized on the CPU, in both rotation and scaling
+ * orders, and every pixel it can touch must be on a painted tile. Exits with
+ * an error if one isn't, or if a painted tile was never recorded.
+ *
+ * Usage: splash_replay [rounds] [seed]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <random>
+
+#include "../../../src/paint-tiles.hpp"
+
+// Same as the game
+constexpr int PlayerCount = 4;
+constexpr int FramesPerSecond = 30;
+constexpr float RoundTime = 60.f;
+constexpr int SplashMargin = 52;
+constexpr int StepMargin = 16;
+
+constexpr int DefaultRounds = 20;
+constexpr unsigned DefaultSeed = 1;
+
+struct Blit {
+    float x;
+    float y;
+    float width;
+    float height;
+    float cx;
+    float cy;
+    float scaleX;
+    float scaleY;
+    float theta;
+    int margin;
+};
+
+struct Walker {
+    float x;
+    float y;
+    float direction;
+    int nextStep;
+};
+
+struct Stats {
+    long frames = 0;
+    long blits = 0;
+    long oldUploads = 0;
+    long oldAttaches = 0;
+    long newUploads = 0;
+    long newAttaches = 0;
+    long rowRecords = 0;
+    long brokenPixels = 0;
+};
+
+static std::mt19937 rng;
+
+static float randomFloat(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(rng);
+}
+
+// Every pixel the blit can write to, sampled at a quarter texel, must be on a
+// painted tile. Checks both ways of applying rotation and scaling.
+static long checkFootprint(const Blit &blit, const PaintTiles &tiles) {
+    long broken = 0;
+    float c = std::cos(blit.theta);
+    float s = std::sin(blit.theta);
+
+    for (int order = 0; order < 2; order++) {
+        for (float u = 0; u <= blit.width; u += 0.25f) {
+            for (float v = 0; v <= blit.height; v += 0.25f) {
+                float dx = u - blit.cx;
+                float dy = v - blit.cy;
+                float px, py;
+                if (order == 0) {
+                    // Scale, then rotate
+                    dx *= blit.scaleX;
+                    dy *= blit.scaleY;
+                    px = dx * c - dy * s;
+                    py = dx * s + dy * c;
+                } else {
+                    // Rotate, then scale
+                    px = (dx * c - dy * s) * blit.scaleX;
+                    py = (dx * s + dy * c) * blit.scaleY;
+                }
+                px += blit.x;
+                py += blit.y;
+
+                // Scissor
+                if (std::fabs(px - blit.x) > blit.margin || std::fabs(py - blit.y) > blit.margin) continue;
+                if (px < 0 || py < 0 || px >= MapWidth || py >= MapWidth) continue;
+
+                int ix = (int)px / TileSize;
+                int iy = (int)py / TileSize;
+                if (!tiles.isPainted(ix, iy)) broken++;
+            }
+        }
+    }
+    return broken;
+}
+
+static bool queueSplash(float x, float y, float direction, PaintTiles &tiles, Blit &blit) {
+    if (x > MapWidth - SplashMargin || x < SplashMargin) return false;
+    if (y > MapWidth - SplashMargin || y < SplashMargin) return false;
+
+    blit = Blit {
+        x, y,
+        32, 32, 16, 16,
+        0.8f + randomFloat(0, 1), 0.8f + randomFloat(0, 1),
+        direction,
+        SplashMargin,
+    };
+    float reach = PaintTiles::getBlitReach(blit.width, blit.height, blit.cx, blit.cy, blit.scaleX, blit.scaleY);
+    tiles.paint(x, y, std::fmin(reach, (float)SplashMargin));
+    return true;
+}
+
+static bool queueStep(float x, float y, float direction, PaintTiles &tiles, Blit &blit) {
+    if (x > MapWidth - StepMargin || x < StepMargin) return false;
+    if (y > MapWidth - StepMargin || y < StepMargin) return false;
+
+    blit = Blit { x, y, 8, 8, 0, 4, 1, 1, direction, StepMargin };
+    tiles.paint(x, y, PaintTiles::getBlitReach(blit.width, blit.height, blit.cx, blit.cy, 1.f, 1.f));
+    return true;
+}
+
+static void playRound(Stats &stats) {
+    PaintTiles tiles;
+    uint16_t recorded[TileCount] = {0};
+    Walker walkers[PlayerCount];
+
+    for (auto &walker : walkers) {
+        walker = Walker { randomFloat(64, MapWidth - 64), randomFloat(64, MapWidth - 64), randomFloat(0, 6.28f), 0 };
+    }
+
+    int frames = (int)(RoundTime * FramesPerSecond);
+    for (int frame = 0; frame < frames; frame++) {
+        // Everything queued this frame, like newSplashes and newFootsteps
+        Blit blits[PlayerCount * 5];
+        int blitCount = 0;
+
+        // The map shrinks over the round, players stay inside it
+        float half = (MapWidth / 2.f) * (1.f - 0.75f * frame / frames);
+
+        for (auto &walker : walkers) {
+            walker.direction += randomFloat(-0.3f, 0.3f);
+            walker.x += std::cos(walker.direction) * 2.5f;
+            walker.y += std::sin(walker.direction) * 2.5f;
+            if (std::fabs(walker.x - MapWidth / 2.f) > half || std::fabs(walker.y - MapWidth / 2.f) > half) {
+                walker.direction += 3.14f;
+                walker.x = std::fmin(std::fmax(walker.x, MapWidth / 2.f - half), MapWidth / 2.f + half);
+                walker.y = std::fmin(std::fmax(walker.y, MapWidth / 2.f - half), MapWidth / 2.f + half);
+            }
+
+            if (--walker.nextStep <= 0) {
+                walker.nextStep = 8;
+                if (queueStep(walker.x, walker.y, walker.direction, tiles, blits[blitCount])) blitCount++;
+            }
+
+            // A bullet lands somewhere in front of the player
+            if (randomFloat(0, 1) < 0.1f) {
+                float distance = randomFloat(20, 200);
+                float x = walker.x + std::cos(walker.direction) * distance;
+                float y = walker.y + std::sin(walker.direction) * distance;
+                if (queueSplash(x, y, walker.direction + randomFloat(0, 0.785f), tiles, blits[blitCount])) blitCount++;
+            }
+        }
+
+        for (int i = 0; i < blitCount; i++) {
+            stats.brokenPixels += checkFootprint(blits[i], tiles);
+        }
+
+        stats.frames++;
+        stats.blits += blitCount;
+        stats.oldAttaches += blitCount;
+        stats.oldUploads += TileCount * TileCount;
+        stats.newAttaches += blitCount > 0;
+
+        for (int iy = 0; iy < TileCount; iy++) {
+            if (tiles.isRowDirty(iy)) {
+                recorded[iy] = tiles.getRow(iy);
+                tiles.cleanRow(iy);
+                stats.rowRecords++;
+            }
+            stats.newUploads += __builtin_popcount(recorded[iy]);
+        }
+    }
+
+    for (int iy = 0; iy < TileCount; iy++) {
+        if (recorded[iy] != tiles.getRow(iy)) {
+            printf("FAIL: row %d has painted tiles that were never recorded\n", iy);
+            stats.brokenPixels++;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    int rounds = argc > 1 ? atoi(argv[1]) : DefaultRounds;
+    unsigned seed = argc > 2 ? strtoul(argv[2], NULL, 0) : DefaultSeed;
+    rng.seed(seed);
+
+    Stats stats;
+    for (int round = 0; round < rounds; round++) {
+        playRound(stats);
+    }
+
+    double frames = stats.frames;
+    printf("%d rounds, seed %u, %ld frames, %.2f blits/frame\n", rounds, seed, stats.frames, stats.blits / frames);
+    printf("tile uploads/frame: before %.1f, after %.1f (%.1f%%)\n",
+        stats.oldUploads / frames, stats.newUploads / frames, 100.0 * stats.newUploads / stats.oldUploads);
+    printf("surface attaches/frame: before %.2f, after %.2f\n", stats.oldAttaches / frames, stats.newAttaches / frames);
+    printf("row blocks recorded/frame: %.3f\n", stats.rowRecords / frames);
+
+    if (stats.brokenPixels) {
+        printf("FAIL: %ld blit pixels on tiles not marked as painted\n", stats.brokenPixels);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,201 @@
+// Host stress test and benchmark for util/hash_map.c
+//
+// The stress test runs random sets, gets and deletes against a plain array
+// indexed by key and checks every key after each round. The cluster test
+// inserts keys that all share a home slot at every table size and checks the
+// probe limit doesn't keep doubling the table. The benchmark times
+// the lookups collision_scene_find_object does, on a map with entities
+// spawning and despawning the way they do in game.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "hash_map.h"
+
+#define MAX_KEY         4096
+#define STRESS_ROUNDS   2000
+#define STRESS_OPS      64
+
+#define CLUSTERED_KEYS  24
+
+#define LIVE_ENTITIES   128
+#define BENCH_FRAMES    20000
+#define LOOKUPS_PER_FRAME   64
+
+static void* reference[MAX_KEY];
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void* value_for(int key, int round) {
+    return (void*)(intptr_t)(key * 31 + round + 1);
+}
+
+// same hash as hash_map.c, used to check how far entries ended up from home
+static int home_slot(int key, int shift) {
+    return (int)((uint32_t)key * 2654435769u >> shift);
+}
+
+static int max_probe_distance(struct hash_map* hash_map) {
+    int mask = hash_map->capacity - 1;
+    int result = 0;
+
+    for (int i = 0; i < hash_map->capacity; i += 1) {
+        int key = hash_map->entries[i].key;
+
+        if (!key) {
+            continue;
+        }
+
+        int distance = (i - home_slot(key, hash_map->hash_shift)) & mask;
+
+        if (distance > result) {
+            result = distance;
+        }
+    }
+
+    return result;
+}
+
+static bool stress_test() {
+    struct hash_map hash_map;
+    hash_map_init(&hash_map, 8);
+    int count = 0;
+    int peak_count = 0;
+    bool ok = true;
+
+    for (int round = 0; round < STRESS_ROUNDS && ok; round += 1) {
+        // bias towards growing the map for the first half, then shrinking it
+        int delete_chance = round < STRESS_ROUNDS / 2 ? 30 : 70;
+
+        for (int op = 0; op < STRESS_OPS; op += 1) {
+            int key = 1 + rand() % (MAX_KEY - 1);
+
+            if (rand() % 100 < delete_chance) {
+                if (reference[key]) {
+                    count -= 1;
+                }
+                hash_map_delete(&hash_map, key);
+                reference[key] = NULL;
+            } else {
+                if (!reference[key]) {
+                    count += 1;
+                }
+                reference[key] = value_for(key, round);
+                hash_map_set(&hash_map, key, reference[key]);
+            }
+        }
+
+        if (count > peak_count) {
+            peak_count = count;
+        }
+
+        if (hash_map.count != count) {
+            printf("round %d: count %d, expected %d\n", round, hash_map.count, count);
+            ok = false;
+        }
+
+        for (int key = 1; key < MAX_KEY; key += 1) {
+            if (hash_map_get(&hash_map, key) != reference[key]) {
+                printf("round %d: key %d has the wrong value\n", round, key);
+                ok = false;
+                break;
+            }
+        }
+    }
+
+    printf("stress test: %s, %d keys (peak %d) in %d slots, longest probe %d\n", ok ? "ok" : "FAILED", hash_map.count, peak_count, hash_map.capacity, max_probe_distance(&hash_map));
+    hash_map_destroy(&hash_map);
+    return ok;
+}
+
+static bool cluster_test() {
+    struct hash_map hash_map;
+    hash_map_init(&hash_map, 32);
+    int keys[CLUSTERED_KEYS];
+    int count = 0;
+
+    // the same top 15 bits give the same home slot up to the largest table
+    for (int key = 1; count < CLUSTERED_KEYS; key += 1) {
+        if (home_slot(key, 17) == home_slot(1, 17)) {
+            keys[count++] = key;
+            hash_map_set(&hash_map, key, value_for(key, 0));
+        }
+    }
+
+    bool ok = true;
+
+    for (int i = 0; i < count; i += 1) {
+        if (hash_map_get(&hash_map, keys[i]) != value_for(keys[i], 0)) {
+            printf("cluster test: key %d has the wrong value\n", keys[i]);
+            ok = false;
+        }
+    }
+
+    // probe growth stops once the table is less than a quarter full
+    if (hash_map.capacity > count * 8) {
+        ok = false;
+    }
+
+    printf("cluster test: %s, %d keys in %d slots, longest probe %d\n", ok ? "ok" : "FAILED", hash_map.count, hash_map.capacity, max_probe_distance(&hash_map));
+    hash_map_destroy(&hash_map);
+    return ok;
+}
+
+static void benchmark() {
+    struct hash_map hash_map;
+    hash_map_init(&hash_map, 32);
+
+    int live[LIVE_ENTITIES];
+    int next_id = 1;
+
+    for (int i = 0; i < LIVE_ENTITIES; i += 1) {
+        live[i] = next_id++;
+        hash_map_set(&hash_map, live[i], value_for(live[i], 0));
+    }
+
+    int found = 0;
+    double lookup_time = 0;
+    double start = now();
+
+    for (int frame = 0; frame < BENCH_FRAMES; frame += 1) {
+        // an entity despawns and a new one takes its place, ids keep counting up
+        int slot = rand() % LIVE_ENTITIES;
+        hash_map_delete(&hash_map, live[slot]);
+        live[slot] = next_id++;
+        hash_map_set(&hash_map, live[slot], value_for(live[slot], 0));
+
+        double lookup_start = now();
+        for (int i = 0; i < LOOKUPS_PER_FRAME; i += 1) {
+            found += hash_map_get(&hash_map, live[(frame + i * 7) % LIVE_ENTITIES]) != NULL;
+        }
+        lookup_time += now() - lookup_start;
+    }
+
+    double total = now() - start;
+
+    printf("benchmark: %d live entities, %.1f ns/lookup, %.1f ns/frame, %d of %d found\n",
+        LIVE_ENTITIES,
+        lookup_time / ((double)BENCH_FRAMES * LOOKUPS_PER_FRAME),
+        total / BENCH_FRAMES,
+        found,
+        BENCH_FRAMES * LOOKUPS_PER_FRAME
+    );
+
+    hash_map_destroy(&hash_map);
+}
+
+int main() {
+    srand(64);
+
+    bool ok = stress_test();
+    ok = cluster_test() && ok;
+    benchmark();
+
+    return ok ? 0 : 1;
+}
@@ -2,10 +2,42 @@
 
 #include <malloc.h>
 #include <memory.h>
+#include <assert.h>
 
-// a 32 bit prime number
-#define MAGIC_PRIME 2748002342
+// Robin hood open addressing. Every entry sits at most a few slots past its
+// home slot, entries further from home take the slot of entries closer to
+// theirs on insert, and deleting shifts the following entries back instead
+// of leaving a tombstone. A lookup can stop as soon as it passes an entry
+// closer to its home than the key being looked for would be
+
+// 2^32 / golden ratio
+#define FIBONACCI_HASH  2654435769u
 #define MIN_CAPACITY    32
+// grow the table early if an insert pushes an entry further than this from
+// home, only while it is at least a quarter full so clustered keys can't
+// keep doubling it
+#define MAX_PROBE_DISTANCE  8
+
+#define EMPTY_KEY   0
+
+static inline int hash_map_home(int key, int shift) {
+    return (int)(((uint32_t)key * FIBONACCI_HASH) >> shift);
+}
+
+static inline int hash_map_distance(int key, int index, int mask, int shift) {
+    return (index - hash_map_home(key, shift)) & mask;
+}
+
+static int hash_map_shift(int capacity) {
+    int shift = 32;
+
+    while (capacity > 1) {
+        capacity >>= 1;
+        shift -= 1;
+    }
+
+    return shift;
+}
 
 void hash_map_init(struct hash_map* hash_map, int capacity) {
     if (capacity < MIN_CAPACITY) {
@@ -17,6 +49,7 @@ void hash_map_init(struct hash_map* hash_map, int capacity) {
     hash_map->entries = malloc(sizeof(struct hash_map_entry) * capacity);
     hash_map->capacity = capacity;
     hash_map->count = 0;
+    hash_map->hash_shift = hash_map_shift(capacity);
 
     memset(hash_map->entries, 0, sizeof(struct hash_map_entry) * capacity);
 }
@@ -25,44 +58,92 @@ void hash_map_destroy(struct hash_map* hash_map) {
     free(hash_map->entries);
 }
 
-struct hash_map_entry* hash_map_find_entry(struct hash_map_entry* entries, int capacity, int key) {
-    int mask = capacity - 1;
+struct hash_map_entry* hash_map_find_entry(struct hash_map_entry* entries, int capacity, int shift, int key) {
+    if (key == EMPTY_KEY) {
+        return NULL;
+    }
 
-    int index = (key * MAGIC_PRIME) & mask;
+    int mask = capacity - 1;
+    int index = hash_map_home(key, shift);
 
-    for (int i = 0; i < capacity; i += 1) {
+    for (int distance = 0; distance < capacity; distance += 1) {
         struct hash_map_entry* entry = &entries[index];
 
-        if (entry->key == key || entry->key == 0) {
+        if (entry->key == key) {
             return entry;
         }
 
+        if (entry->key == EMPTY_KEY || hash_map_distance(entry->key, index, mask, shift) < distance) {
+            return NULL;
+        }
+
         index = (index + 1) & mask;
     }
-    
+
     return NULL;
 }
 
+// inserts a key that isn't in the table yet, returns how far the furthest
+// entry it moved ended up from its home slot
+static int hash_map_insert(struct hash_map_entry* entries, int capacity, int shift, int key, void* value) {
+    int mask = capacity - 1;
+    int index = hash_map_home(key, shift);
+    int distance = 0;
+    int max_distance = 0;
+
+    struct hash_map_entry carry = { .key = key, .value = value };
+
+    for (;;) {
+        struct hash_map_entry* entry = &entries[index];
+
+        if (entry->key == EMPTY_KEY) {
+            *entry = carry;
+            return distance > max_distance ? distance : max_distance;
+        }
+
+        int entry_distance = hash_map_distance(entry->key, index, mask, shift);
+
+        if (entry_distance < distance) {
+            // take the slot from the entry closer to home and keep inserting that one
+            struct hash_map_entry tmp = *entry;
+            *entry = carry;
+            carry = tmp;
+
+            if (distance > max_distance) {
+                max_distance = distance;
+            }
+
+            distance = entry_distance;
+        }
+
+        index = (index + 1) & mask;
+        distance += 1;
+    }
+}
+
 void hash_map_resize(struct hash_map* hash_map) {
     int new_capacity = hash_map->capacity * 2;
+    int new_shift = hash_map->hash_shift - 1;
+    assert(new_capacity <= UINT16_MAX);
     struct hash_map_entry* new_entries = malloc(sizeof(struct hash_map_entry) * new_capacity);
     memset(new_entries, 0, sizeof(struct hash_map_entry) * new_capacity);
 
     for (int i = 0; i < hash_map->capacity; i += 1) {
         struct hash_map_entry* prev_entry = &hash_map->entries[i];
 
-        struct hash_map_entry* new_entry = hash_map_find_entry(new_entries, new_capacity, prev_entry->key);
-        new_entry->key = prev_entry->key;
-        new_entry->value = prev_entry->value;
+        if (prev_entry->key != EMPTY_KEY) {
+            hash_map_insert(new_entries, new_capacity, new_shift, prev_entry->key, prev_entry->value);
+        }
     }
 
     free(hash_map->entries);
     hash_map->entries = new_entries;
     hash_map->capacity = new_capacity;
+    hash_map->hash_shift = new_shift;
 }
 
 void* hash_map_get(struct hash_map* hash_map, int key) {
-    struct hash_map_entry* result = hash_map_find_entry(hash_map->entries, hash_map->capacity, key);
+    struct hash_map_entry* result = hash_map_find_entry(hash_map->entries, hash_map->capacity, hash_map->hash_shift, key);
 
     if (result) {
         return result->value;
@@ -72,30 +153,53 @@ void* hash_map_get(struct hash_map* hash_map, int key) {
 }
 
 void hash_map_set(struct hash_map* hash_map, int key, void* value) {
-    struct hash_map_entry* result = hash_map_find_entry(hash_map->entries, hash_map->capacity, key);
+    assert(key != EMPTY_KEY);
+
+    struct hash_map_entry* result = hash_map_find_entry(hash_map->entries, hash_map->capacity, hash_map->hash_shift, key);
+
+    if (result) {
+        result->value = value;
+        return;
+    }
 
     // check if the hash map should be grown
-    if (result->key != key && (hash_map->count << 1) >= hash_map->capacity) {
+    if ((hash_map->count << 1) >= hash_map->capacity) {
         hash_map_resize(hash_map);
-
-        result = hash_map_find_entry(hash_map->entries, hash_map->capacity, key);
     }
 
-    if (result->key == key) {
-        result->value = value;
-    } else {
-        result->key = key;
-        result->value = value;
-        hash_map->count += 1;
+    int distance = hash_map_insert(hash_map->entries, hash_map->capacity, hash_map->hash_shift, key, value);
+    hash_map->count += 1;
+
+    // keep lookups short, a bigger table spreads the keys out again
+    if (distance > MAX_PROBE_DISTANCE && (hash_map->count << 2) >= hash_map->capacity) {
+        hash_map_resize(hash_map);
     }
 }
 
 void hash_map_delete(struct hash_map* hash_map, int key) {
-    struct hash_map_entry* entry = hash_map_find_entry(hash_map->entries, hash_map->capacity, key);
+    struct hash_map_entry* entry = hash_map_find_entry(hash_map->entries, hash_map->capacity, hash_map->hash_shift, key);
 
-    if (entry && entry->key == key) {
-        hash_map->count -= 1;
-        entry->key = 0;
-        entry->value = 0;
+    if (!entry) {
+        return;
     }
-}
\ No newline at end of file
+
+    int mask = hash_map->capacity - 1;
+    int index = entry - hash_map->entries;
+
+    // shift the following entries back a slot until one is empty or already home
+    for (;;) {
+        int next_index = (index + 1) & mask;
+        struct hash_map_entry* next = &hash_map->entries[next_index];
+
+        if (next->key == EMPTY_KEY || hash_map_distance(next->key, next_index, mask, hash_map->hash_shift) == 0) {
+            break;
+        }
+
+        hash_map->entries[index] = *next;
+        index = next_index;
+    }
+
+    hash_map->entries[index].key = EMPTY_KEY;
+    hash_map->entries[index].value = NULL;
+    hash_map->count -= 1;
+}
@@ -8,10 +8,13 @@ struct hash_map_entry {
     void* value;
 };
 
+// open addressing with robin hood probing, key 0 is reserved for empty slots
 struct hash_map {
     struct hash_map_entry* entries;
     uint16_t capacity;
     uint16_t count;
+    // 32 - log2(capacity), the home slot is the top bits of the hashed key
+    uint8_t hash_shift;
 };
 
 // capacity must be a power of 2
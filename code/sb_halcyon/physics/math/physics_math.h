@@ -1,23 +0,0 @@
-#ifndef PHYSICS_MATH_H
-#define PHYSICS_MATH_H
-
-// Libraries
-
-#include <math.h>
-#include <float.h>
-
-#include "math_common.h"
-
-#include "vector2.h"
-#include "vector3.h"
-
-#include "matrix3x3.h"
-#include "matrix2x2.h"
-
-#include "quaternion.h"
-
-#include "transform.h"
-
-#include "math_functions.h"
-
-#endif
\ No newline at end of file
@@ -1,17 +0,0 @@
-#ifndef PHYSICS_H
-#define PHYSICS_H
-
-#include "math/physics_math.h"
-
-#include "body/rigid_body.h"
-
-#include "collision/contact_data.h"
-#include "collision/shapes/sphere.h"
-#include "collision/shapes/AABB.h"
-#include "collision/shapes/box.h"
-#include "collision/shapes/plane.h"
-#include "collision/shapes/ray.h"
-#include "collision/shapes/capsule.h"
-#include "collision/shapes/triangle.h"
-
-#endif
\ No newline at end of file
@@ -139,17 +139,67 @@ void actorCollision_updateFalling(Actor *actor, ActorContactData *actor_contact,
     }
 }
 
+// Test the actor against one platform's boxes, applies the response and returns true on a hit
+bool actorCollision_collidePlatform(Actor *actor, ActorContactData *actor_contact, ActorCollider *actor_collider, Platform *platform, const AABB *capsule_bounds)
+{
+    if (!aabb_contactAABB(capsule_bounds, &platform->collider.bounds))
+        return false;
+
+    // Check collision with each box in the platform's collider
+    for (int j = 0; j < 3; j++)
+    {
+        Box *box = &platform->collider.box[j];
+
+        // If the actor hits a box
+        if (actorCollision_contactBox(actor_collider, box))
+        {
+            // Set collision response
+            actorCollision_contactBoxSetData(actor_contact, actor_collider, box);
+            actorCollision_collideAndSlide(actor, actor_contact);
+            actorCollision_setGroundResponse(actor, actor_contact, actor_collider);
+
+            // If the actor is lower the top of the box (center.z+(size.z/2)), move there
+            if (actor->body.position.z < box->center.z + (box->size.z * 0.5f))
+                actor->body.position.z = box->center.z + (box->size.z * 0.5f);
+
+            // Set collided state parameter
+            actor->hasCollided = true;
+
+            // Handle platform collision here instead again for the platforms
+            platform->contact = true;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void actorCollision_collidePlatforms(Actor *actor, ActorContactData *actor_contact, ActorCollider *actor_collider, Platform *platforms)
 {
 
     actorCollision_updateFalling(actor, actor_contact, actor_collider);
 
-    // Calculate the grid cell the actor is in
-    int xCell = (int)fm_floorf((actor->body.position.x + 775) / 350);
-    int yCell = (int)fm_floorf((actor->body.position.y + 775) / 350);
+    // AABB around the capsule, tested against the platform bounds before the boxes
+    const Capsule *capsule = &actor_collider->body;
+    Vector3 radius = {capsule->radius, capsule->radius, capsule->radius};
+    AABB capsule_bounds = {
+        .minCoordinates = vector3_min(&capsule->start, &capsule->end),
+        .maxCoordinates = vector3_max(&capsule->start, &capsule->end)};
+    vector3_subtract(&capsule_bounds.minCoordinates, &radius);
+    vector3_add(&capsule_bounds.maxCoordinates, &radius);
 
-    if (xCell < 0 || xCell >= 7 || yCell < 0 || yCell >= 7)
+    // Calculate the grid cell the actor is in
+    int xCell, yCell;
+    if (!platform_gridCell(&actor->body.position, &xCell, &yCell))
     {
+        // Outside the grid, check every platform
+        for (size_t p = 0; p < PLATFORM_COUNT; p++)
+        {
+            if (actorCollision_collidePlatform(actor, actor_contact, actor_collider, &platforms[p], &capsule_bounds))
+                return; // Early exit if collision is detected
+        }
+
         // Actor is out of bounds; fall and skip collision
         actor->state = FALLING;
         actor->grounded = false;
@@ -159,8 +209,6 @@ void actorCollision_collidePlatforms(Actor *actor, ActorContactData *actor_conta
         return;
     }
 
-    const float collisionRangeSq = 175.0f * 175.0f;
-
     // Reset actor's collision state
     actor->hasCollided = false;
 
@@ -172,7 +220,7 @@ void actorCollision_collidePlatforms(Actor *actor, ActorContactData *actor_conta
             int nx = xCell + dx;
             int ny = yCell + dy;
 
-            if (nx < 0 || nx >= 7 || ny < 0 || ny >= 7)
+            if (!platform_gridContains(nx, ny))
             {
                 // Actor is out of bounds; fall and skip collision
                 actor->state = FALLING;
@@ -183,43 +231,10 @@ void actorCollision_collidePlatforms(Actor *actor, ActorContactData *actor_conta
                 continue;
             }
 
-            PlatformGridCell *cell = &platformGrid[nx][ny];
-            for (size_t i = 0; i < cell->count; i++)
+            for (int8_t p = platformGrid.head[nx][ny]; p != GRID_NONE; p = platformGrid.next[p])
             {
-                Platform *platform = &platforms[cell->platformIndices[i]];
-                fm_vec3_t actorPos = Vector3_to_fast(actor->body.position);
-                fm_vec3_t platformPos = Vector3_to_fast(platform->position);
-                float distanceSq = fm_vec3_distance2(&actorPos, &platformPos);
-                if (distanceSq <= collisionRangeSq)
-                {
-
-                    // Check collision with each box in the platform's collider
-                    for (int j = 0; j < 3; j++)
-                    {
-                        Box *box = &platform->collider.box[j];
-
-                        // If the actor hits a box
-                        if (actorCollision_contactBox(actor_collider, box))
-                        {
-                            // Set collision response
-                            actorCollision_contactBoxSetData(actor_contact, actor_collider, box);
-                            actorCollision_collideAndSlide(actor, actor_contact);
-                            actorCollision_setGroundResponse(actor, actor_contact, actor_collider);
-
-                            // If the actor is lower the top of the box (center.z+(size.z/2)), move there
-                            if (actor->body.position.z < box->center.z + (box->size.z * 0.5f))
-                                actor->body.position.z = box->center.z + (box->size.z * 0.5f);
-
-                            // Set collided state parameter
-                            actor->hasCollided = true;
-
-                            // Handle platform collision here instead again for the platforms
-                            platform->contact = true;
-
-                            return; // Early exit if collision is detected
-                        }
-                    }
-                }
+                if (actorCollision_collidePlatform(actor, actor_contact, actor_collider, &platforms[p], &capsule_bounds))
+                    return; // Early exit if collision is detected
             }
         }
     }
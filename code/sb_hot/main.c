@@ -37,7 +37,7 @@
 #include "control/controls.h"
 #include "time/time.h"
 
-#include "physics/physics.h"
+#include "../../physics/physics.h"
 
 #include "camera/camera.h"
 #include "camera/camera_states.h"
@@ -1,15 +0,0 @@
-#ifndef PHYSICS_CONFIG_H
-#define PHYSICS_CONFIG_H
-
-// ---------- Constants ---------- //
-
-/* Pi constant */
-#define PI 3.141592653589f
-
-/* 2*Pi constant */
-#define PI_TIMES_2 6.28318530f
-
-/* A numeric tolerance value used to handle floating-point precision issues. */
-#define TOLERANCE 1e-3f
-
-#endif
@@ -60,16 +60,48 @@ void ai_updateCam(ControllerData *control, float camera_angle)
     control->input.stick_y = (int8_t)(original_x * fm_sinf(angle_rad) + original_y * fm_cosf(angle_rad));
 }
 
+// Keep the platform if it's at a safe height and nearer than the current one
+void ai_checkSafePlatform(AI *ai, Actor *actor, Platform *platform, Platform **nearest_platform, float *min_distance_sq)
+{
+    const float current_platform_threshold_sq = 0.02f * 0.02f; // Squared threshold to ignore the current platform
+
+    // Skip platforms not at a safe height
+    if (platform->position.z <= ai->safe_height)
+        return;
+
+    // Calculate squared distance using fast math vector3
+    fm_vec3_t actorPos = Vector3_to_fast(actor->body.position);
+    fm_vec3_t platformPos = Vector3_to_fast(platform->position);
+    float distance_sq = fm_vec3_distance2(&platformPos, &actorPos);
+
+    // Ignore the current platform the AI is standing on
+    if (distance_sq < current_platform_threshold_sq)
+        return;
+
+    // Check if this platform is the nearest valid one
+    if (distance_sq < *min_distance_sq)
+    {
+        *min_distance_sq = distance_sq;
+        *nearest_platform = platform;
+    }
+}
+
 // Function to find the nearest platform at a safe height
 Platform *find_nearest_safe_platform(AI *ai, Actor *actor, Platform *platforms)
 {
     Platform *nearest_platform = NULL;
-    float min_distance_sq = FLT_MAX;                           // Store squared distance to avoid square root computation
-    const float current_platform_threshold_sq = 0.02f * 0.02f; // Squared threshold to ignore the current platform
+    float min_distance_sq = FLT_MAX; // Store squared distance to avoid square root computation
 
     // Calculate grid cell for the actor's current position
-    int xCell = (int)fm_floorf((actor->body.position.x + 700) / GRID_SIZE);
-    int yCell = (int)fm_floorf((actor->body.position.y + 700) / GRID_SIZE);
+    int xCell, yCell;
+    if (!platform_gridCell(&actor->body.position, &xCell, &yCell))
+    {
+        // Outside the grid, check every platform
+        for (size_t p = 0; p < PLATFORM_COUNT; p++)
+            ai_checkSafePlatform(ai, actor, &platforms[p], &nearest_platform, &min_distance_sq);
+
+        return nearest_platform;
+    }
 
     // Iterate through platforms in the same and adjacent grid cells
     for (int dx = -1; dx <= 1; dx++)
@@ -80,34 +112,10 @@ Platform *find_nearest_safe_platform(AI *ai, Actor *actor, Platform *platforms)
             int ny = yCell + dy;
 
             // Check if the cell is within bounds
-            if (nx >= 0 && nx < MAX_GRID_CELLS && ny >= 0 && ny < MAX_GRID_CELLS)
+            if (platform_gridContains(nx, ny))
             {
-                PlatformGridCell *cell = &platformGrid[nx][ny];
-                for (size_t i = 0; i < cell->count; i++)
-                {
-                    size_t platformIndex = cell->platformIndices[i];
-                    Platform *platform = &platforms[platformIndex];
-
-                    // Skip platforms not at a safe height
-                    if (platform->position.z <= ai->safe_height)
-                        continue;
-
-                    // Calculate squared distance using fast math vector3
-                    fm_vec3_t actorPos = Vector3_to_fast(actor->body.position);
-                    fm_vec3_t platformPos = Vector3_to_fast(platform->position);
-                    float distance_sq = fm_vec3_distance2(&platformPos, &actorPos);
-
-                    // Ignore the current platform the AI is standing on
-                    if (distance_sq < current_platform_threshold_sq)
-                        continue;
-
-                    // Check if this platform is the nearest valid one
-                    if (distance_sq < min_distance_sq)
-                    {
-                        min_distance_sq = distance_sq;
-                        nearest_platform = platform;
-                    }
-                }
+                for (int8_t p = platformGrid.head[nx][ny]; p != GRID_NONE; p = platformGrid.next[p])
+                    ai_checkSafePlatform(ai, actor, &platforms[p], &nearest_platform, &min_distance_sq);
             }
         }
     }
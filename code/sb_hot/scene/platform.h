@@ -5,6 +5,8 @@ typedef struct
 {
 
   Box box[3];
+  Vector3 extents; // Half size of the AABB around the three boxes
+  AABB bounds;     // That AABB around the current box centers, for the broadphase
 
 } PlatformCollider;
 
@@ -26,19 +28,25 @@ typedef struct
 #define OFFSET 350
 #define GRID_SIZE OFFSET // Size of each grid cell
 #define MAX_GRID_CELLS 7 // Adjust based on level size
+#define GRID_NONE -1
 
+// Platforms are linked per cell, so moving one between cells only touches those two cells
 typedef struct
 {
-  size_t platformIndices[PLATFORM_COUNT]; // Indices of platforms in this cell
-  size_t count;                           // Number of platforms in this cell
-} PlatformGridCell;
+  int8_t head[MAX_GRID_CELLS][MAX_GRID_CELLS]; // First platform in each cell
+  int8_t next[PLATFORM_COUNT];                 // Next platform in the same cell
+  int8_t cell[PLATFORM_COUNT];                 // Cell of each platform, x * MAX_GRID_CELLS + y
+  float originX, originY;                      // World position of the corner of cell 0,0
+  int cellsX, cellsY;                          // Cells covered by the platforms, up to MAX_GRID_CELLS
+} PlatformGrid;
 
-PlatformGridCell platformGrid[MAX_GRID_CELLS][MAX_GRID_CELLS];
+PlatformGrid platformGrid;
 
 Platform hexagons[PLATFORM_COUNT];
 
 // Forward Declarations
 
+void platform_updateBounds(Platform *platform);
 void platform_init(Platform *platform, T3DModel *model, Vector3 position, color_t color);
 void platform_loop(Platform *platform, Actor *actor, int diff);
 void platform_drawBatch(void);
@@ -58,6 +66,7 @@ void platform_init(Platform *platform, T3DModel *model, Vector3 position, color_
   platform->home = position;
 
   // Initialize the three boxes for collision within each hexagon
+  platform->collider.extents = (Vector3){0.0f, 0.0f, 0.0f};
   for (int j = 0; j < 3; j++)
   {
     platform->collider.box[j] = (Box){
@@ -70,7 +79,19 @@ void platform_init(Platform *platform, T3DModel *model, Vector3 position, color_
             (j == 0) ? 0.0f : (j == 1) ? 30.0f
                                        : -30.0f // Z rotation for boxes[0], boxes[1], and boxes[2]
         }};
+
+    // Grow the extents to fit the rotated box
+    Vector3 corners[8];
+    AABB local_aabb = box_getLocalAABB(&platform->collider.box[j]);
+    aabb_getCorners(&local_aabb, corners);
+    for (int c = 0; c < 8; c++)
+    {
+      point_transformToGlobalSpace(&corners[c], &(Vector3){0.0f, 0.0f, 0.0f}, &platform->collider.box[j].rotation);
+      Vector3 extent = vector3_returnAbsoluteVector(&corners[c]);
+      platform->collider.extents = vector3_max(&platform->collider.extents, &extent);
+    }
   }
+  platform_updateBounds(platform);
 
   platform->color = color; // Set color
 
@@ -81,24 +102,87 @@ void platform_init(Platform *platform, T3DModel *model, Vector3 position, color_
   platformIdx++;
 }
 
-void platform_assignGrid(Platform *platforms)
+// Whether a cell lies within the grid
+bool platform_gridContains(int xCell, int yCell)
 {
-  memset(platformGrid, 0, sizeof(platformGrid)); // Clear the grid
+  return xCell >= 0 && xCell < platformGrid.cellsX && yCell >= 0 && yCell < platformGrid.cellsY;
+}
 
-  for (size_t i = 0; i < PLATFORM_COUNT; i++)
+// Grid cell of a position, returns false if it's outside the grid
+bool platform_gridCell(const Vector3 *position, int *xCell, int *yCell)
+{
+  *xCell = (int)fm_floorf((position->x - platformGrid.originX) / GRID_SIZE);
+  *yCell = (int)fm_floorf((position->y - platformGrid.originY) / GRID_SIZE);
+  return platform_gridContains(*xCell, *yCell);
+}
+
+// Move a platform to the cell of its current position, if it changed
+void platform_updateGrid(Platform *platforms, size_t index)
+{
+  int xCell, yCell;
+  int8_t cell = platform_gridCell(&platforms[index].position, &xCell, &yCell) ? xCell * MAX_GRID_CELLS + yCell : GRID_NONE;
+  int8_t old_cell = platformGrid.cell[index];
+  if (cell == old_cell)
+    return;
+
+  // Unlink from the old cell
+  if (old_cell != GRID_NONE)
   {
-    int xCell = (int)fm_floorf((platforms[i].position.x + (OFFSET * 2)) / GRID_SIZE);
-    int yCell = (int)fm_floorf((platforms[i].position.y + (OFFSET * 2)) / GRID_SIZE);
+    int8_t *link = &platformGrid.head[old_cell / MAX_GRID_CELLS][old_cell % MAX_GRID_CELLS];
+    while (*link != (int8_t)index)
+      link = &platformGrid.next[*link];
+    *link = platformGrid.next[index];
+  }
 
-    if (xCell >= 0 && xCell < MAX_GRID_CELLS && yCell >= 0 && yCell < MAX_GRID_CELLS)
-    {
-      PlatformGridCell *cell = &platformGrid[xCell][yCell];
-      if (cell->count < PLATFORM_COUNT) // Ensure we don't exceed bounds
-        cell->platformIndices[cell->count++] = i;
-    }
+  // Link into the new one
+  platformGrid.cell[index] = cell;
+  platformGrid.next[index] = GRID_NONE;
+  if (cell != GRID_NONE)
+  {
+    platformGrid.next[index] = platformGrid.head[xCell][yCell];
+    platformGrid.head[xCell][yCell] = index;
   }
 }
 
+// Fit the grid around the platform centers and place every platform in it
+void platform_assignGrid(Platform *platforms)
+{
+  // Clear the grid
+  memset(platformGrid.head, GRID_NONE, sizeof(platformGrid.head));
+  memset(platformGrid.next, GRID_NONE, sizeof(platformGrid.next));
+  memset(platformGrid.cell, GRID_NONE, sizeof(platformGrid.cell));
+
+  Vector3 min = platforms[0].position;
+  Vector3 max = platforms[0].position;
+  for (size_t i = 1; i < PLATFORM_COUNT; i++)
+  {
+    min = vector3_min(&min, &platforms[i].position);
+    max = vector3_max(&max, &platforms[i].position);
+  }
+
+  // One cell per layout step, plus an empty cell of margin on each side so the
+  // neighbour search reaches past the outer platforms
+  platformGrid.cellsX = (int)fm_floorf((max.x - min.x) / GRID_SIZE) + 3;
+  platformGrid.cellsY = (int)fm_floorf((max.y - min.y) / GRID_SIZE) + 3;
+  assertf(platformGrid.cellsX <= MAX_GRID_CELLS && platformGrid.cellsY <= MAX_GRID_CELLS,
+          "Platform layout needs %dx%d grid cells", platformGrid.cellsX, platformGrid.cellsY);
+
+  // Center the cells on the layout
+  platformGrid.originX = (min.x + max.x - platformGrid.cellsX * GRID_SIZE) * 0.5f;
+  platformGrid.originY = (min.y + max.y - platformGrid.cellsY * GRID_SIZE) * 0.5f;
+
+  for (size_t i = 0; i < PLATFORM_COUNT; i++)
+    platform_updateGrid(platforms, i);
+}
+
+// Place the broadphase AABB around the current box centers
+void platform_updateBounds(Platform *platform)
+{
+  const Vector3 *center = &platform->collider.box[0].center;
+  platform->collider.bounds.minCoordinates = vector3_difference(center, &platform->collider.extents);
+  platform->collider.bounds.maxCoordinates = vector3_sum(center, &platform->collider.extents);
+}
+
 //// BEHAVIORS ~ Start ////
 
 // Example behavior: Oscillate platform x position to simulate shake
@@ -147,16 +231,23 @@ void platform_collideCheck(Platform *platform, Actor *actor)
 
 void platform_collideCheckOptimized(Platform *platforms, Actor *actor)
 {
-  int xCell = (int)floorf((actor->body.position.x + (OFFSET * 2)) / GRID_SIZE);
-  int yCell = (int)floorf((actor->body.position.y + (OFFSET * 2)) / GRID_SIZE);
+  const float collisionRangeSq = 150.0f * 150.0f;
 
-  if (xCell < 0 || xCell >= MAX_GRID_CELLS || yCell < 0 || yCell >= MAX_GRID_CELLS)
+  int xCell, yCell;
+  if (!platform_gridCell(&actor->body.position, &xCell, &yCell))
   {
-    return; // Actor is out of bounds
+    // Outside the grid, check every platform
+    for (size_t platformIndex = 0; platformIndex < PLATFORM_COUNT; platformIndex++)
+    {
+      if (vector3_squaredDistance(&actor->body.position, &platforms[platformIndex].position) <= collisionRangeSq)
+      {
+        platforms[platformIndex].contact = true;
+        return; // Early exit on collision
+      }
+    }
+    return;
   }
 
-  const float collisionRangeSq = 150.0f * 150.0f;
-
   // Check platforms in the same and adjacent cells
   for (int dx = -1; dx <= 1; dx++)
   {
@@ -165,12 +256,10 @@ void platform_collideCheckOptimized(Platform *platforms, Actor *actor)
       int nx = xCell + dx;
       int ny = yCell + dy;
 
-      if (nx >= 0 && nx < MAX_GRID_CELLS && ny >= 0 && ny < MAX_GRID_CELLS)
+      if (platform_gridContains(nx, ny))
       {
-        PlatformGridCell *cell = &platformGrid[nx][ny];
-        for (size_t i = 0; i < cell->count; i++)
+        for (int8_t platformIndex = platformGrid.head[nx][ny]; platformIndex != GRID_NONE; platformIndex = platformGrid.next[platformIndex])
         {
-          size_t platformIndex = cell->platformIndices[i];
           float distanceSq = vector3_squaredDistance(&actor->body.position, &platforms[platformIndex].position);
           if (distanceSq <= collisionRangeSq)
           {
@@ -190,6 +279,7 @@ void platform_loop(Platform *platform, Actor *actor, int diff)
   // Translate collision
   for (int j = 0; j < 3; j++)
     platform->collider.box[j].center = platform->position;
+  platform_updateBounds(platform);
 
   // Run behaviors
   // if(actor != NULL) platform_collideCheck(platform, actor);
@@ -230,6 +320,9 @@ void platform_loop(Platform *platform, Actor *actor, int diff)
       platform->position.z = platform->position.z + 1.0f + difficulty;
   }
 
+  // Keep the grid up to date with the behaviors
+  platform_updateGrid(hexagons, platform - hexagons);
+
   // Update matrix
   t3d_mat4fp_from_srt_euler(
       platform->mat,
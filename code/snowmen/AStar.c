@@ -1,100 +1,288 @@
 #include "AStar.h"
 
-void AStarRun(node* start, node* destination, NodeDynamicArray* path)//maybe no need for AllNodes?
-{
-    NodeDynamicArray SearchList;
-    NodeDA_Create(&SearchList);
-    NodeDA_Add(&SearchList, start);
-    // = start;
-    NodeDynamicArray ProcessedList;
-    NodeDA_Create(&ProcessedList);
-    //Loop
-    while(true)//searchList is not empty
-    {
-        //debugf("weeeeeeeeeeeeeeee\n");
-        //Get best node in searchList
-        node* current = NodeDA_GetAtIndex(&SearchList, 0);
-        for (int i = 1; i < SearchList.length; i++)//for i start at 1 is better than 0 I think
-        {
-            //best node is the one with the smallest F value
-            if ((NodeDA_GetAtIndex(&SearchList, i)->G + NodeDA_GetAtIndex(&SearchList, i)->H) < (current->G + current->H))
-            {
-                current = NodeDA_GetAtIndex(&SearchList, i);
-            }
-        }
-        //take current node out of search list and put into processed list
-        //processed.Add
-        NodeDA_Add(&ProcessedList, current);
-        //toSearch.remove
-        NodeDA_Remove(&SearchList, current);
+void AStarScratch_Create(AStarScratch* scratch, NodeDynamicArray* AllNodes)
+{
+    *scratch = (AStarScratch){
+        .nodes = malloc(sizeof(node*) * AllNodes->length),
+        .states = calloc(AllNodes->length, sizeof(AStarNodeState)),
+        .heap = malloc(sizeof(int) * AllNodes->length),
+        .heapLength = 0,
+        .capacity = AllNodes->length,
+        .generation = 0
+    };
+    for (int i = 0; i < AllNodes->length; i++)
+    {
+        AllNodes->nodeArray[i]->searchIndex = i;
+        scratch->nodes[i] = AllNodes->nodeArray[i];
+    }
+}
+
+void AStarScratch_Free(AStarScratch* scratch)
+{
+    free(scratch->nodes);
+    free(scratch->states);
+    free(scratch->heap);
+    *scratch = (AStarScratch){0};
+}
+
+static inline bool AStarHeapLess(AStarScratch* scratch, int a, int b)
+{
+    //best node is the one with the smallest F value, if there is a tie choose the one with lowest H
+    AStarNodeState* A = &scratch->states[a];
+    AStarNodeState* B = &scratch->states[b];
+    float FA = A->G + A->H;
+    float FB = B->G + B->H;
+    return FA < FB || (FA == FB && A->H < B->H);
+}
+
+static inline void AStarHeapSet(AStarScratch* scratch, int pos, int index)
+{
+    scratch->heap[pos] = index;
+    scratch->states[index].heapPos = pos;
+}
+
+static void AStarHeapUp(AStarScratch* scratch, int pos)
+{
+    int index = scratch->heap[pos];
+    while (pos > 0)
+    {
+        int parent = (pos - 1) / 2;
+        if (!AStarHeapLess(scratch, index, scratch->heap[parent])) break;
+        AStarHeapSet(scratch, pos, scratch->heap[parent]);
+        pos = parent;
+    }
+    AStarHeapSet(scratch, pos, index);
+}
+
+static void AStarHeapDown(AStarScratch* scratch, int pos)
+{
+    int index = scratch->heap[pos];
+    while (true)
+    {
+        int child = pos * 2 + 1;
+        if (child >= scratch->heapLength) break;
+        if (child + 1 < scratch->heapLength && AStarHeapLess(scratch, scratch->heap[child + 1], scratch->heap[child])) child++;
+        if (!AStarHeapLess(scratch, scratch->heap[child], index)) break;
+        AStarHeapSet(scratch, pos, scratch->heap[child]);
+        pos = child;
+    }
+    AStarHeapSet(scratch, pos, index);
+}
+
+static void AStarHeapPush(AStarScratch* scratch, int index)
+{
+    scratch->heapLength++;
+    AStarHeapSet(scratch, scratch->heapLength - 1, index);
+    AStarHeapUp(scratch, scratch->heapLength - 1);
+}
+
+static int AStarHeapPop(AStarScratch* scratch)
+{
+    int best = scratch->heap[0];
+    scratch->heapLength--;
+    if (scratch->heapLength > 0)
+    {
+        AStarHeapSet(scratch, 0, scratch->heap[scratch->heapLength]);
+        AStarHeapDown(scratch, 0);
+    }
+    return best;
+}
+
+bool AStarRun(AStarScratch* scratch, node* start, node* destination, NodeDynamicArray* path)
+{
+    assertf(start->searchIndex >= 0 && start->searchIndex < scratch->capacity && scratch->nodes[start->searchIndex] == start, "AStarRun: start node %d is not in the scratch graph", start->id);
+    assertf(destination->searchIndex >= 0 && destination->searchIndex < scratch->capacity && scratch->nodes[destination->searchIndex] == destination, "AStarRun: destination node %d is not in the scratch graph", destination->id);
+
+    //path storage is reused between searches, a path can never be longer than the graph
+    if (path->nodeArray == NULL) NodeDA_Create(path);
+    if (path->AllocatedLength < scratch->capacity + 1)
+    {
+        path->AllocatedLength = scratch->capacity + 1;
+        path->nodeArray = realloc(path->nodeArray, sizeof(node*) * path->AllocatedLength);
+    }
+    path->length = 0;
+
+    //new generation invalidates every open/closed flag from the last search without touching them
+    scratch->generation++;
+    if (scratch->generation == 0)
+    {
+        memset(scratch->states, 0, sizeof(AStarNodeState) * scratch->capacity);
+        scratch->generation = 1;
+    }
+    uint32_t gen = scratch->generation;
+    scratch->heapLength = 0;
+
+    AStarNodeState* startState = &scratch->states[start->searchIndex];
+    startState->G = 0.f;
+    startState->H = t3d_vec3_distance2(&start->location, &destination->location);
+    startState->backConnection = -1;
+    startState->openGen = gen;
+    AStarHeapPush(scratch, start->searchIndex);
+
+    while (scratch->heapLength > 0)
+    {
+        int currentIndex = AStarHeapPop(scratch);
+        node* current = scratch->nodes[currentIndex];
+        AStarNodeState* currentState = &scratch->states[currentIndex];
+        currentState->closedGen = gen;
 
         if (current == destination)
         {
-           //debugf("WE'RE HERE! %d\n", current->id);
             //Reached the end, get path back
-            //NodeDynamicArray path;
-            NodeDA_Create(path);
-            //debugf("uh 1\n");
-            //create dynamic array
-            node* currentPathNode = destination;
-            //debugf("uh 2\n");
-            while (currentPathNode != start)
+            int pathIndex = currentIndex;
+            while (pathIndex != start->searchIndex)
             {
-                //debugf("this id: %d\n", currentPathNode->id);
-                //Path.Add(currentPathNode)
-                NodeDA_Add(path, currentPathNode);
-                //debugf("woah 2\n");
-                currentPathNode = currentPathNode->backConnection;
-                //debugf("woah 3\n");
+                path->nodeArray[path->length++] = scratch->nodes[pathIndex];
+                pathIndex = scratch->states[pathIndex].backConnection;
             }
-
-            free(SearchList.nodeArray);
-            free(ProcessedList.nodeArray);
-            return; //&path;
+            return true;
         }
-        
-        for(int i = 0; i < current->neighbors.length; i++)
+
+        for (int i = 0; i < current->neighbors.length; i++)
         {
-            //does this neighbor exist in the search list?
-            if(NodeDA_Contains(&ProcessedList, NodeDA_GetAtIndex(&current->neighbors, i)))
+            node* neighbor = NodeDA_GetAtIndex(&current->neighbors, i);
+            AStarNodeState* neighborState = &scratch->states[neighbor->searchIndex];
+            if (neighborState->closedGen == gen)
             {
                 continue;
             }
-            //does this neighbor exist in the search list?
-            bool inSearch = NodeDA_Contains(&SearchList, NodeDA_GetAtIndex(&current->neighbors, i));
 
-            float costToNeighbor = current->G + t3d_vec3_distance2(&current->location, &NodeDA_GetAtIndex(&current->neighbors, i)->location);//current.GetDistanced(current->neighbors[i])!!!!;//Distance^2 between current node and this neighbor node
-                //this G value is the current one's + whatever it takes to travel there from current
-            if(!inSearch || costToNeighbor < NodeDA_GetAtIndex(&current->neighbors, i)->G)
+            //Distance^2 between current node and this neighbor node
+            float costToNeighbor = currentState->G + t3d_vec3_distance2(&current->location, &neighbor->location);
+            bool inSearch = neighborState->openGen == gen;
+            if (!inSearch || costToNeighbor < neighborState->G)
             {
-                //set G and add back connection
-                NodeDA_GetAtIndex(&current->neighbors, i)->G = costToNeighbor;
-                NodeDA_GetAtIndex(&current->neighbors, i)->backConnection = current;
+                neighborState->G = costToNeighbor;
+                neighborState->backConnection = currentIndex;
 
-                if(!inSearch)
+                if (!inSearch)
                 {
-                    //add to searchlist and set H
-                    NodeDA_Add(&SearchList, NodeDA_GetAtIndex(&current->neighbors, i));
-                    NodeDA_GetAtIndex(&current->neighbors, i)->H = t3d_vec3_distance2(&NodeDA_GetAtIndex(&current->neighbors, i)->location, &destination->location);//neighbor.GetDistance(targetNode)!!!!!!!!!!!!!!!!!!//Distance^2 between this neighbor and the target node
+                    //Distance^2 between this neighbor and the target node
+                    neighborState->H = t3d_vec3_distance2(&neighbor->location, &destination->location);
+                    neighborState->openGen = gen;
+                    AStarHeapPush(scratch, neighbor->searchIndex);
+                }
+                else
+                {
+                    AStarHeapUp(scratch, neighborState->heapPos);
                 }
             }
         }
-        //debugf("new node: %d\n", current->id);
-        for (int i = 0; i < SearchList.length; i++)
+    }
+
+    debugf("AStarRun: no path from %d to %d\n", start->id, destination->id);
+    return false;
+}
+
+
+
+static void AStarTable_Build(AStarTable* table, AStarScratch* scratch)
+{
+    int n = scratch->capacity;
+    if (table->capacity != n)
+    {
+        free(table->nextHop);
+        table->nextHop = n <= ASTAR_TABLE_MAX_NODES ? malloc(sizeof(int16_t) * n * n) : NULL;
+        table->capacity = n;
+    }
+    table->dirty = false;
+    if (table->nextHop == NULL) return;
+
+    //Floyd-Warshall on the same cost AStarRun uses (distance^2 per edge), graph is tiny so O(n^3) is fine
+    float* cost = malloc(sizeof(float) * n * n);
+    for (int i = 0; i < n * n; i++)
+    {
+        cost[i] = INFINITY;
+        table->nextHop[i] = -1;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        node* from = scratch->nodes[i];
+        cost[i * n + i] = 0.f;
+        table->nextHop[i * n + i] = i;
+        for (int j = 0; j < from->neighbors.length; j++)
         {
-            //debugf("In search List: %d\n",SearchList.nodeArray[i]->id);
+            node* to = NodeDA_GetAtIndex(&from->neighbors, j);
+            float edge = t3d_vec3_distance2(&from->location, &to->location);
+            if (edge < cost[i * n + to->searchIndex])
+            {
+                cost[i * n + to->searchIndex] = edge;
+                table->nextHop[i * n + to->searchIndex] = to->searchIndex;
+            }
         }
     }
-    //Check if current node is destination
-        //If current node is destination:
-        //Create path from dest to start
-    //Current node is in "processed" list, do not search
-    //Add all adjecent nodes to search list
-    //Find the lowest F values among the search list
-    //    If there is a tie, choose one with lowest H cost
-    //Chosen node is new current node
-    free(SearchList.nodeArray);
-    free(ProcessedList.nodeArray);
+    for (int k = 0; k < n; k++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            float costIK = cost[i * n + k];
+            if (costIK == INFINITY) continue;
+            for (int j = 0; j < n; j++)
+            {
+                float viaK = costIK + cost[k * n + j];
+                if (viaK < cost[i * n + j])
+                {
+                    cost[i * n + j] = viaK;
+                    table->nextHop[i * n + j] = table->nextHop[i * n + k];
+                }
+            }
+        }
+    }
+    free(cost);
+}
+
+void AStarTable_Create(AStarTable* table, AStarScratch* scratch)
+{
+    *table = (AStarTable){0};
+    AStarTable_Build(table, scratch);
+}
+
+void AStarTable_Invalidate(AStarTable* table)
+{
+    table->dirty = true;
+}
+
+void AStarTable_Free(AStarTable* table)
+{
+    free(table->nextHop);
+    *table = (AStarTable){0};
+}
+
+bool AStarTable_GetPath(AStarTable* table, AStarScratch* scratch, node* start, node* destination, NodeDynamicArray* path)
+{
+    if (table->dirty || table->capacity != scratch->capacity) AStarTable_Build(table, scratch);
+    if (table->nextHop == NULL) return AStarRun(scratch, start, destination, path);
+
+    if (path->nodeArray == NULL) NodeDA_Create(path);
+    if (path->AllocatedLength < scratch->capacity + 1)
+    {
+        path->AllocatedLength = scratch->capacity + 1;
+        path->nodeArray = realloc(path->nodeArray, sizeof(node*) * path->AllocatedLength);
+    }
+    path->length = 0;
+
+    int n = table->capacity;
+    int to = destination->searchIndex;
+    int current = start->searchIndex;
+    if (table->nextHop[current * n + to] < 0)
+    {
+        debugf("AStarTable_GetPath: no path from %d to %d\n", start->id, destination->id);
+        return false;
+    }
+
+    //walk start -> destination, then flip to match AStarRun's destination-first order
+    while (current != to)
+    {
+        current = table->nextHop[current * n + to];
+        path->nodeArray[path->length++] = scratch->nodes[current];
+    }
+    for (int i = 0; i < path->length / 2; i++)
+    {
+        node* swap = path->nodeArray[i];
+        path->nodeArray[i] = path->nodeArray[path->length - 1 - i];
+        path->nodeArray[path->length - 1 - i] = swap;
+    }
+    return true;
 }
 
 
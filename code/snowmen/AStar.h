@@ -25,14 +25,58 @@ typedef struct{
 typedef struct node{
   //int16_t v[3];
   NodeDynamicArray neighbors;
-  struct node* backConnection;
   T3DVec3 location;
-  float G;//true distance travelled till this point
-  float H;//estimated distance to the destination from this point
   int id;
+  int searchIndex;//dense index into AStarScratch, set by AStarScratch_Create
 } node;
 
-void AStarRun(node* start, node* destination, NodeDynamicArray* path);
+//Per-node search state, lives in the scratch arena so the shared graph is never written during a search
+typedef struct{
+  float G;//true distance travelled till this point
+  float H;//estimated distance to the destination from this point
+  int backConnection;//searchIndex of the node we came from
+  int heapPos;//position in the open heap, only valid while open
+  uint32_t openGen;//== scratch generation while in the open heap (or closed)
+  uint32_t closedGen;//== scratch generation once processed
+} AStarNodeState;
+
+//Caller-owned scratch, allocated once for a graph and reused by every search
+typedef struct{
+  node** nodes;//searchIndex -> node
+  AStarNodeState* states;
+  int* heap;//binary min-heap of searchIndex, ordered by F then H
+  int heapLength;
+  int capacity;
+  uint32_t generation;
+} AStarScratch;
+
+//Assigns searchIndex to every node in AllNodes and allocates the scratch for them
+void AStarScratch_Create(AStarScratch* scratch, NodeDynamicArray* AllNodes);
+
+void AStarScratch_Free(AStarScratch* scratch);
+
+//Fills path with destination..start (start excluded). Reuses path's storage, returns false if destination is unreachable
+bool AStarRun(AStarScratch* scratch, node* start, node* destination, NodeDynamicArray* path);
+
+//Largest graph the table is built for, n^2 next hops. Bigger graphs are searched with AStarRun instead
+#define ASTAR_TABLE_MAX_NODES 128
+
+//All-pairs next-hop table for a small static graph, replanning becomes a lookup instead of a search
+typedef struct{
+  int16_t* nextHop;//[from * capacity + to] -> searchIndex of the next node, -1 if unreachable. NULL if the graph is too big
+  int capacity;
+  bool dirty;//rebuilt on the next lookup
+} AStarTable;
+
+void AStarTable_Create(AStarTable* table, AStarScratch* scratch);
+
+//Call whenever nodes or neighbors of the scratch graph change
+void AStarTable_Invalidate(AStarTable* table);
+
+void AStarTable_Free(AStarTable* table);
+
+//Same output as AStarRun, but read from the table (rebuilt first if invalidated). Falls back to AStarRun without a table
+bool AStarTable_GetPath(AStarTable* table, AStarScratch* scratch, node* start, node* destination, NodeDynamicArray* path);
 
 
 
@@ -196,8 +196,7 @@ bool TestAllCollision(Actor* InstigatorActor, Actor** AllActors, T3DVec3* penetr
 {
     bool anyCollision=false;
     int numCollisions = 0;
-    int length = 14;//13//7;//sizeof(AllActors) / sizeof(AllActors[0]);
-    for (int i = 0; i < length; i++)//MUST CHANGE TO ACTUAL ARRAY LENGTH
+    for (int i = 0; i < ALL_ACTORS_COUNT; i++)
     {
         //debugf("int i = %d\n", i);
         if (AllActors[i] != InstigatorActor)
@@ -227,43 +226,96 @@ bool TestAllCollision(Actor* InstigatorActor, Actor** AllActors, T3DVec3* penetr
     return anyCollision;
 }
 
+bool TestAllCollisionManifold(Actor* InstigatorActor, Actor** AllActors, CollisionManifold* manifold, float deltaTime)
+{
+    //unlike TestAllCollision this doesn't stop at the first hit, so corners can be resolved in one step
+    manifold->numContacts = 0;
+    for (int i = 0; i < ALL_ACTORS_COUNT; i++)
+    {
+        if (AllActors[i] == InstigatorActor) continue;
+        if (AllActors[i]->collisionType == ECT_Mesh)
+        {
+            TestCapsuleMeshCollisionAll(InstigatorActor, AllActors[i], manifold);
+        }
+        else
+        {
+            T3DVec3 penetration_normal;
+            float penetration_depth;
+            if (TestCollision(InstigatorActor, AllActors[i], &penetration_normal, &penetration_depth, deltaTime))
+            {
+                CollisionManifold_Add(manifold, &penetration_normal, penetration_depth);
+            }
+        }
+    }
+    return manifold->numContacts > 0;
+}
+
 void CapsuleRespondCollideNSlide(Actor* CapsuleActor, T3DVec3* penetration_normal, float penetration_depth, float deltaTime)
 {
-  //CapsuleActor->Position = CapsuleActor->PrevPosition;
-  //debugf("Time to slide... Penetration Depth = %f\n", penetration_depth);
-  //debugf("Time to slide... Penetration Norm = %f, %f, %f\n", penetration_normal->v[0], penetration_normal->v[1], penetration_normal->v[2]);
+  CollisionManifold manifold = {
+    .contacts = {{*penetration_normal, penetration_depth}},
+    .numContacts = 1
+  };
+  CapsuleRespondCollideNSlideManifold(CapsuleActor, &manifold, deltaTime);
+}
 
-  float velocity_length = t3d_vec3_len(&CapsuleActor->CurrentVelocity);
-  T3DVec3 velocity_normalized = CapsuleActor->CurrentVelocity;
-  if (velocity_length == 0.f)
+void CapsuleRespondCollideNSlideManifold(Actor* CapsuleActor, const CollisionManifold* manifold, float deltaTime)
+{
+  //remove the velocity going into each contact normal, what is left slides along all of them
+  T3DVec3 velocity = CapsuleActor->CurrentVelocity;
+  for (int i = 0; i < manifold->numContacts; i++)
   {
-    //debugf("VINNY PLS\n");
-    //  velocity_length = 0.0001f;
-      velocity_normalized.v[0] = 0;
-      velocity_normalized.v[1] = 1;
-      velocity_normalized.v[2] = 0;
+    const T3DVec3* normal = &manifold->contacts[i].normal;
+    T3DVec3 undesired_motion = *normal;
+    scaleVector(&undesired_motion, t3d_vec3_dot(&velocity, normal));
+    t3d_vec3_diff(&velocity, &velocity, &undesired_motion);
   }
-  else
+
+  //in a corner, clipping against the second wall can point back into the first, slide along the crease instead
+  if (manifold->numContacts == 2)
   {
-    float invVelocityLength = 1 / velocity_length;//inversed velocity length
-    velocity_normalized.v[0] *= invVelocityLength;
-    velocity_normalized.v[1] *= invVelocityLength;
-    velocity_normalized.v[2] *= invVelocityLength;
+    if (t3d_vec3_dot(&velocity, &manifold->contacts[0].normal) < -0.0001f)
+    {
+      T3DVec3 crease;
+      t3d_vec3_cross(&crease, &manifold->contacts[0].normal, &manifold->contacts[1].normal);
+      if (t3d_vec3_len2(&crease) > 0.0001f)
+      {
+        fast_vec3_norm(&crease);
+        scaleVector(&crease, t3d_vec3_dot(&CapsuleActor->CurrentVelocity, &crease));
+        velocity = crease;
+      }
+      else
+      {
+        velocity = (T3DVec3){{0.f, 0.f, 0.f}};
+      }
+    }
   }
+  else if (manifold->numContacts > 2)
+  {
+    for (int i = 0; i < manifold->numContacts; i++)
+    {
+      if (t3d_vec3_dot(&velocity, &manifold->contacts[i].normal) < -0.0001f)
+      {
+        velocity = (T3DVec3){{0.f, 0.f, 0.f}};//boxed in
+        break;
+      }
+    }
+  }
+  CapsuleActor->CurrentVelocity = velocity;
 
-
-  T3DVec3 undesired_motion = *penetration_normal;
-  float scale_val = t3d_vec3_dot(&velocity_normalized, penetration_normal);
-  scaleVector(&undesired_motion, scale_val);
-
-  T3DVec3 desired_motion;
-  t3d_vec3_diff(&desired_motion, &velocity_normalized, &undesired_motion);
-  
-  CapsuleActor->CurrentVelocity = desired_motion;
-  scaleVector(&CapsuleActor->CurrentVelocity, velocity_length);
-
-  T3DVec3 RemovedPenetration = *penetration_normal;
-  scaleVector(&RemovedPenetration, (penetration_depth + 0.0001f));
+  //push out of every contact, only by what the previous pushes haven't already covered
+  T3DVec3 RemovedPenetration = {{0.f, 0.f, 0.f}};
+  for (int i = 0; i < manifold->numContacts; i++)
+  {
+    const CollisionContact* contact = &manifold->contacts[i];
+    float remaining = contact->depth - t3d_vec3_dot(&RemovedPenetration, &contact->normal);
+    if (remaining > 0.f)
+    {
+      T3DVec3 push = contact->normal;
+      scaleVector(&push, (remaining + 0.0001f));
+      t3d_vec3_add(&RemovedPenetration, &RemovedPenetration, &push);
+    }
+  }
   t3d_vec3_add(&CapsuleActor->Position, &CapsuleActor->Position, &RemovedPenetration);
 
   //finally apply velocity
@@ -274,20 +326,6 @@ void CapsuleRespondCollideNSlide(Actor* CapsuleActor, T3DVec3* penetration_norma
   }};
 
   t3d_vec3_add(&CapsuleActor->Position, &CapsuleActor->Position, &CapsuleActor->DesiredMovement);
-  // if (PlayerPosition.v[1] < -200.f)
-  //{
-  //PlayerPosition.v[1] = -200.f;
-  //if (PlayerState == EPS_Airborne)
-  //{  
-  //PlayerState = EPS_Idle;
-  //}
-  //}
-
-  //PlayerSphere.center = CapsuleActor->Position;
-
-  //PlayerCapsule.base = CapsuleActor->Position;
-  //PlayerCapsule.tip = CapsuleActor->Position;
-  //PlayerCapsule.tip.v[1] += (CapsuleActor.CollisionHeight*2);//half height for capsule
 
   CapsuleActor->collisionCenter = (T3DVec3){{
   CapsuleActor->Position.v[0],
@@ -343,112 +381,15 @@ bool TestCollision(Actor* InstigatorActor, Actor* OtherActor, T3DVec3* penetrati
     return false;
 }
 
-bool TraverseOctreeCapsule(struct Octree* node, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth, bool* ColHappened)
-{
-  //debugf("Happened? %d\n", *ColHappened);
-  if (*ColHappened) return true;//does this function need to return a bool anyway?
-  //for loop over all children
-  //check if capsule's AABB intersects this child's AABB
-    //if so, recursively call function on this node if this node has children
-    //if node does NOT have children, return vert list
-    //will have to combine multiple vert lists potentially if capsule is in multiple nodes
-  if (node->children == NULL) return false;
-
-  for (int i = 0; i < 8; i++)  
-  {
-    indicies_counter++;
-    /*debugf("i =  %d\n", i);
-    debugf("Capsule Min\n");
-        debugf("%f, %f, %f\n", capsule->Capsule_AABB_Min.v[0], capsule->Capsule_AABB_Min.v[1], capsule->Capsule_AABB_Min.v[2]);
-    debugf("Capsule Max\n");
-        debugf("%f, %f, %f\n", capsule->Capsule_AABB_Max.v[0], capsule->Capsule_AABB_Max.v[1], capsule->Capsule_AABB_Max.v[2]);
-    debugf("AABB Min\n");
-        debugf("%f, %f, %f\n", node->children[i].AABB_Min.v[0], node->children[i].AABB_Min.v[1], node->children[i].AABB_Min.v[2]);
-    debugf("AABB Max\n");
-        debugf("%f, %f, %f\n", node->children[i].AABB_Max.v[0], node->children[i].AABB_Max.v[1], node->children[i].AABB_Max.v[2]); */
-
-    if (TestAABBvsAABB(&capsule->Capsule_AABB_Min, &capsule->Capsule_AABB_Max, &node->children[i].AABB_Min, &node->children[i].AABB_Max))
-    /*if (capsule->Capsule_AABB_Min.v[0] <= node->children[i].AABB_Max.v[0] && capsule->Capsule_AABB_Max.v[0] >= node->children[i].AABB_Min.v[0] &&
-        capsule->Capsule_AABB_Min.v[1] <= node->children[i].AABB_Max.v[1] && capsule->Capsule_AABB_Max.v[1] >= node->children[i].AABB_Min.v[1] &&
-        capsule->Capsule_AABB_Min.v[2] <= node->children[i].AABB_Max.v[2] && capsule->Capsule_AABB_Max.v[2] >= node->children[i].AABB_Min.v[2])*/
-    //if (true)//check every single octant. If this works, that means collision works fine but we're putting the tris in wrong octants, or something like that
-    {
-      //debugf("we in the octant now boys %d\n", i);
-      /*debugf("if 1\n");
-      if (node->children == NULL) debugf("well shoot\n");
-      else debugf("oh ok\n");*/
-      if (node->children[i].children != NULL) 
-      {
-        //debugf("if 2\n");
-        if (TraverseOctreeCapsule(&node->children[i], capsule, penetration_normal, penetration_depth, ColHappened))
-        {
-          return true;
-        }
-      }
-      else
-      {
-        //debugf("else 2\n");
-        //numVertsToCheck += node->children[i]->numVertices
-        //add verts to vertsToCheck
-        //debugf("This node has no children, let's test it's triangles (%d)\n", node->children[i].numVertices/3);
-        for (int j = 0; j < node->children[i].numVertices; j += 3)
-        {
-          /*debugf("test trianlge %d\n", j / 3);
-          debugf("Verts to test:\n");
-          debugf("%f, %f, %f\n", node->children[i].vertices[j].v[0], node->children[i].vertices[j].v[1], node->children[i].vertices[j].v[2]);
-          debugf("%f, %f, %f\n", node->children[i].vertices[j+1].v[0], node->children[i].vertices[j+1].v[1], node->children[i].vertices[j+1].v[2]);
-          debugf("%f, %f, %f\n", node->children[i].vertices[j+2].v[0], node->children[i].vertices[j+2].v[1], node->children[i].vertices[j+2].v[2]);
-          debugf("Max and Min:\n");
-          debugf("%f, %f, %f\n", capsule->Capsule_AABB_Max.v[0], capsule->Capsule_AABB_Max.v[1], capsule->Capsule_AABB_Max.v[2]);
-          debugf("%f, %f, %f\n", capsule->Capsule_AABB_Min.v[0], capsule->Capsule_AABB_Min.v[1], capsule->Capsule_AABB_Min.v[2]);*/
-
-          
-          if (CollideCapsuleTriangle(&node->children[i].vertices[j], capsule, penetration_normal, penetration_depth))
-          {
-            //debugf("if 3\n");
-           // debugf("REAL collision at %d\n", i);
-              *ColHappened = true;
-              return true;
-          }
-        }
-      }
-    }
-  }
-  return false;
-}
-
-bool CollideCapsuleMeshOctree(struct Actor* actor, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth)
-{
-  bool* ColHappened = malloc(sizeof(bool));//this is kind of a crappy fix, should return array of all potential tris and only do CollideCapsuleTriangle in this func
-  *ColHappened = false;
-    /*for (int i = 0; i < actor->numCollisionTris; i++)
-    {
-        if (CollideCapsuleTriangle(&actor->CollisionVertices[i*3], capsule, penetration_normal, penetration_depth))
-        {
-            return true;
-        }
-    }
-    return false;*/
-    //malloc for vertstocheck
-    //T3DVec3* vertsToCheck = malloc(sizeof(T3DVec3))
-    //int numVertsToCheck;
-    TraverseOctreeCapsule(&actor->CollisionOctree, capsule, penetration_normal, penetration_depth, ColHappened);
-    if (*ColHappened)
-    {
-      //debugf("ALRIGHT! WE GOT A COLLISION!\n");
-      return true;
-    }
-    else{
-      return false;
-    }
-
-}
-
 bool CollideCapsuleMeshCached(struct Actor* actor, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth)
 {
   //debugf("Are we even getting here %d???????????????????????????????\n", actor->numCollisionTris);
   //T3DVec3 verticies[3];
   //int cringecounter = 0;
+    if (actor->CollisionBVH != NULL)
+    {
+      return CollideCapsuleBVH(actor->CollisionBVH, actor->numCollisionBVHNodes, &actor->CollisionBVHOffset, actor->CollisionVertices, capsule, penetration_normal, penetration_depth);
+    }
     for (int i = 0; i < actor->numCollisionTris; i++)
     {
       //debugf("I guess we're here: %d???????????????????????????????\n", actor->numCollisionTris);
@@ -466,13 +407,26 @@ bool CollideCapsuleMeshCached(struct Actor* actor, const CapsuleCollider* capsul
     return false;
 }
 
-bool TestCapsuleMeshCollision(Actor* CapsuleActor, Actor* StaticMeshActor, T3DVec3* penetration_normal, float* penetration_depth, float deltaTime)
+bool CollideCapsuleMeshCachedAll(struct Actor* actor, const CapsuleCollider* capsule, CollisionManifold* manifold)
 {
-  capsule_mesh_counter++;
-    //!!!!!!!!!!!!!!! Must set PrevPosition in Grounded movement!!!!!!!!!!!!!!!!!
-    //T3DVec3 penetration_normal;
-    //float penetration_depth;
+    if (actor->CollisionBVH != NULL)
+    {
+      return CollideCapsuleBVHAll(actor->CollisionBVH, actor->numCollisionBVHNodes, &actor->CollisionBVHOffset, actor->CollisionVertices, capsule, manifold);
+    }
+    T3DVec3 penetration_normal;
+    float penetration_depth;
+    for (int i = 0; i < actor->numCollisionTris; i++)
+    {
+        if (CollideCapsuleTriangle(&actor->CollisionVertices[i*3], capsule, &penetration_normal, &penetration_depth))
+        {
+            CollisionManifold_Add(manifold, &penetration_normal, penetration_depth);
+        }
+    }
+    return manifold->numContacts > 0;
+}
 
+static CapsuleCollider GetActorCapsule(Actor* CapsuleActor)
+{
     T3DVec3 playerTip = (T3DVec3){{
     CapsuleActor->collisionCenter.v[0],// + CapsuleActor->CollisionHeight,
     CapsuleActor->collisionCenter.v[1] - CapsuleActor->CollisionHeight,
@@ -486,22 +440,35 @@ bool TestCapsuleMeshCollision(Actor* CapsuleActor, Actor* StaticMeshActor, T3DVe
     }};
     //debugf("collision base: %f, %f, %f\n", playerBase.v[0], playerBase.v[1], playerBase.v[2]);
 
-    CapsuleCollider PlayerCapsule = (CapsuleCollider){
+    return (CapsuleCollider){
     CapsuleActor->collisionRadius,
     playerBase,
     playerTip,
     CapsuleActor->AABB_Min,
     CapsuleActor->AABB_Max
     };
+}
 
+bool TestCapsuleMeshCollisionAll(Actor* CapsuleActor, Actor* StaticMeshActor, CollisionManifold* manifold)
+{
+  capsule_mesh_counter++;
+  CapsuleCollider PlayerCapsule = GetActorCapsule(CapsuleActor);
+  return CollideCapsuleMeshCachedAll(StaticMeshActor, &PlayerCapsule, manifold);
+}
 
+bool TestCapsuleMeshCollision(Actor* CapsuleActor, Actor* StaticMeshActor, T3DVec3* penetration_normal, float* penetration_depth, float deltaTime)
+{
+  capsule_mesh_counter++;
+    //!!!!!!!!!!!!!!! Must set PrevPosition in Grounded movement!!!!!!!!!!!!!!!!!
+    //T3DVec3 penetration_normal;
+    //float penetration_depth;
+
+    CapsuleCollider PlayerCapsule = GetActorCapsule(CapsuleActor);
 
     //if (CollideCapsuleMesh(StaticMeshActor->model, &StaticMeshActor->Transform, &PlayerCapsule, &penetration_normal, &penetration_depth))
     if (CollideCapsuleMeshCached(StaticMeshActor, &PlayerCapsule, penetration_normal, penetration_depth)){
       //debugf("                      WORLDS COLLIDE\n");
     //debugf("   $       $       $     $    alright, let's test this mesh\n");
-    //if (CollideCapsuleMeshOctree(StaticMeshActor, &PlayerCapsule, penetration_normal, penetration_depth))
-    //{
       //debugf("Pen Depth: %f, Pen norm: %f, %f, %f\n", penetration_depth, penetration_normal.v[0], penetration_normal.v[1], penetration_normal.v[2]);
         
         return true;
@@ -636,10 +603,20 @@ void GenerateStaticCollisionNew(struct Actor* actor)
     {
         assertf(false, "Invalid collision file: %s", actor->collisionModelPath);
     }
-    assertf(model->magic[3] == 42,
+    assertf(model->magic[3] == 42 || model->magic[3] == 43,
     "Invalid T3D model version: %d != %d\n"
     "Please make a clean build of t3d and your project",
-    42, model->magic[3]);
+    43, model->magic[3]);
+    //ConvertVerticies and the BVH offset only use the translation, a rotated or scaled actor would collide with the unrotated mesh
+    for (int r = 0; r < 3; r++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            assertf(fabsf(actor->Transform.m[r][c] - (r == c ? 1.0f : 0.0f)) < 0.0001f,
+            "Collision mesh %s: only translation is supported, Transform has rotation or scale",
+            actor->collisionModelPath);
+        }
+    }
     /*debugf("Is indeed a collision file! Size: %d\n", size);
     debugf("%d \n", model->totalTriCount);//uint16_t
     debugf("%d \n", model->totalIndexCount);
@@ -678,6 +655,18 @@ void GenerateStaticCollisionNew(struct Actor* actor)
     }
 
     actor->numCollisionTris = model->totalTriCount;
+
+    //version 43 stores a BVH after the triangles, the triangles are already in leaf order
+    actor->CollisionBVH = NULL;
+    actor->numCollisionBVHNodes = 0;
+    if (model->magic[3] == 43 && model->bvhNodeCount > 0)
+    {
+        const CollisionBVHNode* nodes = (const CollisionBVHNode*)&model->tris[model->totalTriCount];
+        actor->CollisionBVH = malloc(sizeof(CollisionBVHNode) * model->bvhNodeCount);
+        memcpy(actor->CollisionBVH, nodes, sizeof(CollisionBVHNode) * model->bvhNodeCount);
+        actor->numCollisionBVHNodes = model->bvhNodeCount;
+        actor->CollisionBVHOffset = (T3DVec3){{actor->Transform.m[3][0], actor->Transform.m[3][1], actor->Transform.m[3][2]}};
+    }
     /*debugf("%f %f %f %f\n", actor->Transform.m[0][0], actor->Transform.m[0][1], actor->Transform.m[0][2], actor->Transform.m[0][3]);
     debugf("%f %f %f %f\n", actor->Transform.m[1][0], actor->Transform.m[1][1], actor->Transform.m[1][2], actor->Transform.m[1][3]);
     debugf("%f %f %f %f\n", actor->Transform.m[2][0], actor->Transform.m[2][1], actor->Transform.m[2][2], actor->Transform.m[2][3]);
@@ -692,6 +681,8 @@ void ActorFree(Actor* actor)
   if(actor->collisionType == ECT_Mesh)
   {
     free(actor->CollisionVertices);
+    free(actor->CollisionBVH);
+    actor->CollisionBVH = NULL;
   }
 if(actor->dpl != NULL)
 {
@@ -22,11 +22,13 @@ typedef struct {
 typedef struct {
   char magic[4];
   uint16_t totalTriCount;
-  uint16_t totalIndexCount;
+  uint16_t bvhNodeCount;//only valid for version 43, the nodes follow the triangles
 
   triangleCollision tris[];
 } CollisionStruct;
 
+#define ALL_ACTORS_COUNT 14//length of the AllActors list: 3 snowballs, 4 snowmen, 6 spawners, the environment
+
 enum ActorTypes {
     EAT_Player,
     EAT_Crate,
@@ -36,15 +38,6 @@ enum ActorTypes {
     EAT_SPAWNER
 };
 
-typedef struct Octree{
-    T3DVec3 AABB_Min;
-    T3DVec3 AABB_Max;
-    struct Octree *children;
-    T3DVec3 *vertices;
-    int numVertices;
-} Octree;
-
-
 typedef struct Actor{
     enum ActorTypes actorType;
     T3DModel *model;
@@ -67,7 +60,9 @@ typedef struct Actor{
     T3DMat4FP *TransformFP;
     T3DVec3 *CollisionVertices;//large array of 3 verts (tris)
     int numCollisionTris;
-    Octree CollisionOctree;
+    CollisionBVHNode *CollisionBVH;//NULL if the .col file has no BVH, then every triangle is tested
+    int numCollisionBVHNodes;
+    T3DVec3 CollisionBVHOffset;//translation added to the .col vertices, the BVH stays in local space, Transform must be translation only
     rspq_block_t *dpl;
     T3DVec3 BillboardPosition;
     float BillboardTimer;
@@ -101,8 +96,16 @@ bool TestCapsuleCapsuleCollision(Actor* CapsuleActor1, Actor* CapsuleActor2, flo
 
 void CapsuleRespondCollideNSlide(Actor* CapsuleActor, T3DVec3* penetration_normal, float penetration_depth, float deltaTime);
 
+bool TestAllCollisionManifold(Actor* InstigatorActor, Actor** AllActors, CollisionManifold* manifold, float deltaTime);//gathers contacts from every actor instead of stopping at the first
+
+bool TestCapsuleMeshCollisionAll(Actor* CapsuleActor, Actor* StaticMeshActor, CollisionManifold* manifold);
+
+void CapsuleRespondCollideNSlideManifold(Actor* CapsuleActor, const CollisionManifold* manifold, float deltaTime);//resolves all contacts in one step
+
 bool CollideCapsuleMeshCached(struct Actor* actor, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth); 
 
+bool CollideCapsuleMeshCachedAll(struct Actor* actor, const CapsuleCollider* capsule, CollisionManifold* manifold);
+
 void CalcCapsuleAABB(struct Actor* playerActor);
 
 void GenerateStaticCollisionNew(struct Actor* actor);
@@ -719,3 +719,93 @@ bool TestAABBvsAABB(const T3DVec3* aMin, const T3DVec3* aMax, const T3DVec3* bMi
     t3d_vec3_diff(&midMin, aMin, bMax);*/
 }
 
+static bool TraverseCapsuleBVH(const CollisionBVHNode* nodes, int numNodes, const T3DVec3* offset, const T3DVec3* triVerts, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth, CollisionManifold* manifold)
+{
+    //move the capsule AABB into the mesh's integer space once, instead of every node into world space
+    //node bounds are integers, so floor/ceil keeps the test exact
+    int32_t queryMin[3];
+    int32_t queryMax[3];
+    for (int i = 0; i < 3; i++)
+    {
+        queryMin[i] = (int32_t)floorf(capsule->Capsule_AABB_Min.v[i] - offset->v[i]);
+        queryMax[i] = (int32_t)ceilf(capsule->Capsule_AABB_Max.v[i] - offset->v[i]);
+    }
+
+    //nodes are depth-first, so entering a node is just going to the next one, no stack needed
+    int i = 0;
+    while (i < numNodes)
+    {
+        const CollisionBVHNode* node = &nodes[i];
+        if (queryMin[0] > node->aabbMax[0] || queryMax[0] < node->aabbMin[0] ||
+            queryMin[1] > node->aabbMax[1] || queryMax[1] < node->aabbMin[1] ||
+            queryMin[2] > node->aabbMax[2] || queryMax[2] < node->aabbMin[2])
+        {
+            i = node->skip;
+            continue;
+        }
+
+        if (node->triData != 0)
+        {
+            int firstTri = node->triData >> 4;
+            int triCount = node->triData & 0xF;
+            for (int t = firstTri; t < firstTri + triCount; t++)
+            {
+                if (CollideCapsuleTriangle(&triVerts[t*3], capsule, penetration_normal, penetration_depth))
+                {
+                    if (manifold == NULL) return true;
+                    CollisionManifold_Add(manifold, penetration_normal, *penetration_depth);
+                }
+            }
+        }
+        i++;
+    }
+    return manifold != NULL && manifold->numContacts > 0;
+}
+
+bool CollideCapsuleBVH(const CollisionBVHNode* nodes, int numNodes, const T3DVec3* offset, const T3DVec3* triVerts, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth)
+{
+    return TraverseCapsuleBVH(nodes, numNodes, offset, triVerts, capsule, penetration_normal, penetration_depth, NULL);
+}
+
+bool CollideCapsuleBVHAll(const CollisionBVHNode* nodes, int numNodes, const T3DVec3* offset, const T3DVec3* triVerts, const CapsuleCollider* capsule, CollisionManifold* manifold)
+{
+    T3DVec3 penetration_normal;
+    float penetration_depth;
+    return TraverseCapsuleBVH(nodes, numNodes, offset, triVerts, capsule, &penetration_normal, &penetration_depth, manifold);
+}
+
+void CollisionManifold_Add(CollisionManifold* manifold, const T3DVec3* penetration_normal, float penetration_depth)
+{
+    //contacts facing the same way (e.g. the triangles of one flat wall) are merged, keeping the deepest
+    for (int i = 0; i < manifold->numContacts; i++)
+    {
+        CollisionContact* contact = &manifold->contacts[i];
+        if (t3d_vec3_dot(&contact->normal, penetration_normal) > COLLISION_MANIFOLD_MERGE_DOT)
+        {
+            if (penetration_depth > contact->depth)
+            {
+                contact->normal = *penetration_normal;
+                contact->depth = penetration_depth;
+            }
+            return;
+        }
+    }
+
+    if (manifold->numContacts < COLLISION_MAX_CONTACTS)
+    {
+        manifold->contacts[manifold->numContacts++] = (CollisionContact){*penetration_normal, penetration_depth};
+        return;
+    }
+
+    //full, replace the shallowest contact if this one is deeper
+    int shallowest = 0;
+    for (int i = 1; i < manifold->numContacts; i++)
+    {
+        if (manifold->contacts[i].depth < manifold->contacts[shallowest].depth) shallowest = i;
+    }
+    if (penetration_depth > manifold->contacts[shallowest].depth)
+    {
+        manifold->contacts[shallowest] = (CollisionContact){*penetration_normal, penetration_depth};
+    }
+}
+
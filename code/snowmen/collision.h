@@ -35,6 +35,26 @@ typedef struct {
     T3DVec3 Capsule_AABB_Max;
 } CapsuleCollider;
 
+typedef struct {
+    int16_t aabbMin[3];//in the mesh's local space, same integer units as the vertices in the .col file
+    int16_t aabbMax[3];
+    uint16_t skip;//index of the next node when this subtree is not entered (depth-first order)
+    uint16_t triData;//leaf: (firstTri << 4) | triCount, inner: 0
+} CollisionBVHNode;
+
+#define COLLISION_MAX_CONTACTS 4
+#define COLLISION_MANIFOLD_MERGE_DOT 0.95f//contacts with normals closer than this are merged into one
+
+typedef struct {
+    T3DVec3 normal;
+    float depth;
+} CollisionContact;
+
+typedef struct {
+    CollisionContact contacts[COLLISION_MAX_CONTACTS];
+    int numContacts;
+} CollisionManifold;
+
 
 
 
@@ -76,6 +96,7 @@ float clamp_Float(float value, float min, float max);
 
 bool GetObjectFromModel(T3DObject* obj, const T3DModel* model, uint32_t c);
 
+//only adds the translation of mat, rotation and scale are ignored
 void ConvertVerticies(T3DVec3* verticies, const int16_t vertexFP[3][3], const T3DMat4* mat);
 
 T3DObject* t3d_model_get_nameless_object(const T3DModel *model, uint32_t i);
@@ -86,5 +107,15 @@ bool TestAABBCapsuleTriangle(const CapsuleCollider* capsule, const T3DVec3* vert
 
 bool TestAABBvsAABB(const T3DVec3* aMin, const T3DVec3* aMax, const T3DVec3* bMin, const T3DVec3* bMax);
 
+bool CollideCapsuleBVH(const CollisionBVHNode* nodes, int numNodes, const T3DVec3* offset, const T3DVec3* triVerts, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth);
+//Same result as testing every triangle in triVerts in order, but only visits the triangles whose BVH leaves overlap the capsule AABB
+//offset is the translation that was added to the .col vertices to get triVerts
+
+bool CollideCapsuleBVHAll(const CollisionBVHNode* nodes, int numNodes, const T3DVec3* offset, const T3DVec3* triVerts, const CapsuleCollider* capsule, CollisionManifold* manifold);
+//Like CollideCapsuleBVH, but doesn't stop at the first hit, every penetrating triangle is added to manifold
+
+void CollisionManifold_Add(CollisionManifold* manifold, const T3DVec3* penetration_normal, float penetration_depth);
+//Merges contacts with similar normals, if full the shallowest contact is replaced
+
 
 #endif
\ No newline at end of file
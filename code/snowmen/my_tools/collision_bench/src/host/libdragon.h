@@ -0,0 +1,17 @@
+#ifndef HOST_LIBDRAGON_H
+#define HOST_LIBDRAGON_H
+
+// Minimal host stand-in for libdragon, only covering what '../../collision.c' needs.
+// This lets the runtime collision code be compiled as-is for the host benchmark.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define debugf(...) fprintf(stderr, __VA_ARGS__)
+#define assertf(expr, ...) do { if(!(expr)) { fprintf(stderr, __VA_ARGS__); abort(); } } while(0)
+
+#endif
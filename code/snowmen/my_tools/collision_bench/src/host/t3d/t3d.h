@@ -0,0 +1,8 @@
+#ifndef HOST_T3D_H
+#define HOST_T3D_H
+
+// Host stand-in for tiny3d, see '../libdragon.h'.
+
+#include <libdragon.h>
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_T3DDEBUG_H
+#define HOST_T3DDEBUG_H
+
+// Empty host stand-in, collision.c includes it but uses nothing from it.
+
+#endif
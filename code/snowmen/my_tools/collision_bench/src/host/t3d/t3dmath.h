@@ -0,0 +1,46 @@
+#ifndef HOST_T3DMATH_H
+#define HOST_T3DMATH_H
+
+// Host stand-in for tiny3d's math header, see '../libdragon.h'.
+
+#include <libdragon.h>
+
+typedef struct {
+  float v[3];
+} T3DVec3;
+
+typedef struct {
+  float m[4][4];
+} T3DMat4;
+
+static inline void t3d_vec3_add(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b) {
+  for(int i=0; i<3; ++i)res->v[i] = a->v[i] + b->v[i];
+}
+
+static inline void t3d_vec3_diff(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b) {
+  for(int i=0; i<3; ++i)res->v[i] = a->v[i] - b->v[i];
+}
+
+static inline float t3d_vec3_dot(const T3DVec3 *a, const T3DVec3 *b) {
+  return a->v[0] * b->v[0] + a->v[1] * b->v[1] + a->v[2] * b->v[2];
+}
+
+static inline void t3d_vec3_cross(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b) {
+  T3DVec3 tmp = {{
+    a->v[1] * b->v[2] - a->v[2] * b->v[1],
+    a->v[2] * b->v[0] - a->v[0] * b->v[2],
+    a->v[0] * b->v[1] - a->v[1] * b->v[0]
+  }};
+  *res = tmp;
+}
+
+static inline float t3d_vec3_len2(const T3DVec3 *v) { return t3d_vec3_dot(v, v); }
+static inline float t3d_vec3_len(const T3DVec3 *v) { return sqrtf(t3d_vec3_len2(v)); }
+
+static inline float t3d_vec3_distance2(const T3DVec3 *a, const T3DVec3 *b) {
+  T3DVec3 diff;
+  t3d_vec3_diff(&diff, a, b);
+  return t3d_vec3_len2(&diff);
+}
+
+#endif
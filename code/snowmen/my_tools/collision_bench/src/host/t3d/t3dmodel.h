@@ -0,0 +1,42 @@
+#ifndef HOST_T3DMODEL_H
+#define HOST_T3DMODEL_H
+
+// Host stand-in for tiny3d's model header, only the layout 'CollideCapsuleMesh' reads.
+
+#include <t3d/t3dmath.h>
+
+#define T3D_CHUNK_TYPE_OBJECT 'O'
+
+typedef struct {
+  int16_t posA[3];
+  uint16_t normA;
+  int16_t posB[3];
+  uint16_t normB;
+  uint32_t rgbaA;
+  uint32_t rgbaB;
+  int16_t stA[2];
+  int16_t stB[2];
+} T3DVertPacked;
+
+typedef struct {
+  T3DVertPacked *vert;
+  uint16_t *indices;
+  uint32_t numIndices;
+} T3DObjectPart;
+
+typedef struct {
+  uint32_t numParts;
+  T3DObjectPart *parts;
+} T3DObject;
+
+typedef struct {
+  char type;
+  uint32_t offset;
+} T3DChunkOffset;
+
+typedef struct {
+  uint32_t chunkCount;
+  T3DChunkOffset chunkOffsets[];
+} T3DModel;
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_T3DSKELETON_H
+#define HOST_T3DSKELETON_H
+
+// Empty host stand-in, collision.c includes it but uses nothing from it.
+
+#endif
@@ -0,0 +1,252 @@
+/**
+ * Host benchmark for the capsule-vs-mesh BVH in 'collision.c'.
+ * Loads a '.col' file written by gltf_collision_importer, places player-sized capsules
+ * around the mesh and compares 'CollideCapsuleBVH' against testing every triangle in order,
+ * which is what 'CollideCapsuleMeshCached' does for files without a BVH.
+ * Both paths must report the same hit, normal and depth for every query.
+ * The all-contacts variants ('CollideCapsuleBVHAll') are compared the same way on their manifolds.
+ *
+ * Usage: collision_bench <file.col> [--queries=N] [--seed=N]
+ */
+#include "collision.h"
+
+#include <time.h>
+
+#define DEFAULT_QUERIES 20000
+#define MIN_TIMED_QUERIES 1000000
+
+// same values as the player actor and the environment actor in 'mygamemain.c'
+#define CAPSULE_RADIUS 10.f
+#define CAPSULE_HEIGHT 0.f
+static const T3DVec3 ENV_OFFSET = {{0.f, 0.f, -40.f}};
+
+typedef struct {
+  T3DVec3 *triVerts;
+  int numTris;
+  CollisionBVHNode *nodes;
+  int numNodes;
+  T3DVec3 boundsMin;
+  T3DVec3 boundsMax;
+} BenchMesh;
+
+typedef struct {
+  bool hit;
+  T3DVec3 normal;
+  float depth;
+  CollisionManifold manifold; // only for the all-contacts queries
+} QueryResult;
+
+static uint16_t readU16(const uint8_t *data) {
+  return (uint16_t)((data[0] << 8) | data[1]);
+}
+
+static double getTimeSec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRand(uint32_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+  return *state;
+}
+
+static float randRange(uint32_t *state, float min, float max) {
+  return min + (max - min) * ((nextRand(state) & 0xFFFFFF) / (float)0xFFFFFF);
+}
+
+static bool loadMesh(BenchMesh *mesh, const char *path) {
+  FILE *file = fopen(path, "rb");
+  if(!file) {
+    fprintf(stderr, "Could not open %s\n", path);
+    return false;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *data = malloc(size);
+  if(fread(data, 1, size, file) != (size_t)size || size < 8 || memcmp(data, "COL", 3) != 0) {
+    fprintf(stderr, "Invalid collision file: %s\n", path);
+    fclose(file);
+    free(data);
+    return false;
+  }
+  fclose(file);
+
+  // the file is big-endian, fields are read the same way 'GenerateStaticCollisionNew' does
+  int version = data[3];
+  mesh->numTris = readU16(data + 4);
+  mesh->numNodes = version == 43 ? readU16(data + 6) : 0;
+
+  mesh->triVerts = malloc(sizeof(T3DVec3) * mesh->numTris * 3);
+  const uint8_t *tri = data + 8;
+  for(int i=0; i<3; ++i) {
+    mesh->boundsMin.v[i] = INFINITY;
+    mesh->boundsMax.v[i] = -INFINITY;
+  }
+  for(int v=0; v<mesh->numTris*3; ++v, tri += 6) {
+    for(int i=0; i<3; ++i) {
+      float pos = (int16_t)readU16(tri + i*2) + ENV_OFFSET.v[i];
+      mesh->triVerts[v].v[i] = pos;
+      mesh->boundsMin.v[i] = fminf(mesh->boundsMin.v[i], pos);
+      mesh->boundsMax.v[i] = fmaxf(mesh->boundsMax.v[i], pos);
+    }
+  }
+
+  mesh->nodes = malloc(sizeof(CollisionBVHNode) * (mesh->numNodes ? mesh->numNodes : 1));
+  const uint8_t *node = tri;
+  for(int n=0; n<mesh->numNodes; ++n, node += 16) {
+    for(int i=0; i<3; ++i) {
+      mesh->nodes[n].aabbMin[i] = (int16_t)readU16(node + i*2);
+      mesh->nodes[n].aabbMax[i] = (int16_t)readU16(node + 6 + i*2);
+    }
+    mesh->nodes[n].skip = readU16(node + 12);
+    mesh->nodes[n].triData = readU16(node + 14);
+  }
+
+  free(data);
+  return true;
+}
+
+static void makeCapsule(CapsuleCollider *capsule, const T3DVec3 *position) {
+  // same shape as 'TestCapsuleMeshCollision' builds, AABB as in 'CalcCapsuleAABB'
+  T3DVec3 center = {{position->v[0], position->v[1] + CAPSULE_HEIGHT, position->v[2]}};
+  *capsule = (CapsuleCollider){
+    .radius = CAPSULE_RADIUS,
+    .tip = {{center.v[0], center.v[1] + CAPSULE_HEIGHT, center.v[2]}},
+    .base = {{center.v[0], center.v[1] - CAPSULE_HEIGHT, center.v[2]}},
+    .Capsule_AABB_Min = {{position->v[0] - CAPSULE_RADIUS, position->v[1] - CAPSULE_RADIUS, position->v[2] - CAPSULE_RADIUS}},
+    .Capsule_AABB_Max = {{position->v[0] + CAPSULE_RADIUS, position->v[1] + CAPSULE_HEIGHT*2 + CAPSULE_RADIUS, position->v[2] + CAPSULE_RADIUS}},
+  };
+}
+
+static void queryLinear(const BenchMesh *mesh, const CapsuleCollider *capsule, QueryResult *res) {
+  res->hit = false;
+  for(int t=0; t<mesh->numTris; ++t) {
+    if(CollideCapsuleTriangle(&mesh->triVerts[t*3], capsule, &res->normal, &res->depth)) {
+      res->hit = true;
+      return;
+    }
+  }
+}
+
+static void queryBVH(const BenchMesh *mesh, const CapsuleCollider *capsule, QueryResult *res) {
+  res->hit = CollideCapsuleBVH(mesh->nodes, mesh->numNodes, &ENV_OFFSET, mesh->triVerts, capsule, &res->normal, &res->depth);
+}
+
+static void queryLinearAll(const BenchMesh *mesh, const CapsuleCollider *capsule, QueryResult *res) {
+  res->manifold.numContacts = 0;
+  for(int t=0; t<mesh->numTris; ++t) {
+    if(CollideCapsuleTriangle(&mesh->triVerts[t*3], capsule, &res->normal, &res->depth)) {
+      CollisionManifold_Add(&res->manifold, &res->normal, res->depth);
+    }
+  }
+  res->hit = res->manifold.numContacts > 0;
+}
+
+static void queryBVHAll(const BenchMesh *mesh, const CapsuleCollider *capsule, QueryResult *res) {
+  res->manifold.numContacts = 0;
+  res->hit = CollideCapsuleBVHAll(mesh->nodes, mesh->numNodes, &ENV_OFFSET, mesh->triVerts, capsule, &res->manifold);
+}
+
+static bool sameManifold(const CollisionManifold *a, const CollisionManifold *b) {
+  if(a->numContacts != b->numContacts)return false;
+  return memcmp(a->contacts, b->contacts, sizeof(CollisionContact) * a->numContacts) == 0;
+}
+
+typedef void (*QueryFunc)(const BenchMesh*, const CapsuleCollider*, QueryResult*);
+
+static void runTimed(const char *name, QueryFunc func, const BenchMesh *mesh, const CapsuleCollider *capsules, int count, QueryResult *results) {
+  sphere_tri_counter = 0;
+  capsule_tri_counter = 0;
+  for(int q=0; q<count; ++q)func(mesh, &capsules[q], &results[q]);
+  double trisPerQuery = (double)(sphere_tri_counter + capsule_tri_counter) / count;
+  double narrowPerQuery = (double)capsule_tri_counter / count;
+
+  int rounds = (MIN_TIMED_QUERIES + count - 1) / count;
+  QueryResult tmp;
+  double start = getTimeSec();
+  for(int r=0; r<rounds; ++r) {
+    for(int q=0; q<count; ++q)func(mesh, &capsules[q], &tmp);
+  }
+  double time = getTimeSec() - start;
+  double total = (double)rounds * count;
+
+  printf("%-7s %10.0f queries/s  %8.1f ns/query  %7.2f tris/query  %5.2f past AABB/query\n",
+    name, total / time, time / total * 1e9, trisPerQuery, narrowPerQuery);
+}
+
+int main(int argc, char* argv[])
+{
+  const char *path = NULL;
+  int queryCount = DEFAULT_QUERIES;
+  uint32_t seed = 0x64;
+  for(int i=1; i<argc; ++i) {
+    if(strncmp(argv[i], "--queries=", 10) == 0)queryCount = atoi(argv[i] + 10);
+    else if(strncmp(argv[i], "--seed=", 7) == 0)seed = (uint32_t)atoi(argv[i] + 7);
+    else path = argv[i];
+  }
+  if(!path || queryCount <= 0 || seed == 0) {
+    printf("Usage: %s <file.col> [--queries=N] [--seed=N]\n", argv[0]);
+    return 1;
+  }
+
+  BenchMesh mesh;
+  if(!loadMesh(&mesh, path))return 1;
+  printf("%s: %d triangles, %d BVH nodes\n", path, mesh.numTris, mesh.numNodes);
+  if(mesh.numNodes == 0) {
+    printf("No BVH in this file, write it with 'gltf_collision --bvh'\n");
+    return 1;
+  }
+
+  // spread capsules over the whole mesh, most of them end up touching the floor or a wall
+  CapsuleCollider *capsules = malloc(sizeof(CapsuleCollider) * queryCount);
+  for(int q=0; q<queryCount; ++q) {
+    T3DVec3 pos = {{
+      randRange(&seed, mesh.boundsMin.v[0] - CAPSULE_RADIUS, mesh.boundsMax.v[0] + CAPSULE_RADIUS),
+      randRange(&seed, mesh.boundsMin.v[1] - CAPSULE_RADIUS, mesh.boundsMax.v[1]),
+      randRange(&seed, mesh.boundsMin.v[2] - CAPSULE_RADIUS, mesh.boundsMax.v[2] + CAPSULE_RADIUS),
+    }};
+    makeCapsule(&capsules[q], &pos);
+  }
+
+  QueryResult *resLinear = malloc(sizeof(QueryResult) * queryCount);
+  QueryResult *resBVH = malloc(sizeof(QueryResult) * queryCount);
+  runTimed("linear", queryLinear, &mesh, capsules, queryCount, resLinear);
+  runTimed("bvh", queryBVH, &mesh, capsules, queryCount, resBVH);
+
+  QueryResult *resLinearAll = malloc(sizeof(QueryResult) * queryCount);
+  QueryResult *resBVHAll = malloc(sizeof(QueryResult) * queryCount);
+  runTimed("lin-all", queryLinearAll, &mesh, capsules, queryCount, resLinearAll);
+  runTimed("bvh-all", queryBVHAll, &mesh, capsules, queryCount, resBVHAll);
+
+  int hits = 0;
+  int mismatches = 0;
+  int contacts = 0;
+  int multiContact = 0;
+  for(int q=0; q<queryCount; ++q) {
+    hits += resLinear[q].hit;
+    bool same = resLinear[q].hit == resBVH[q].hit;
+    if(same && resLinear[q].hit) {
+      same = resLinear[q].depth == resBVH[q].depth
+        && memcmp(&resLinear[q].normal, &resBVH[q].normal, sizeof(T3DVec3)) == 0;
+    }
+    same = same && resLinearAll[q].hit == resLinear[q].hit && sameManifold(&resLinearAll[q].manifold, &resBVHAll[q].manifold);
+    mismatches += !same;
+    contacts += resBVHAll[q].manifold.numContacts;
+    multiContact += resBVHAll[q].manifold.numContacts > 1;
+  }
+  printf("%d queries, %d hits, %d mismatches\n", queryCount, hits, mismatches);
+  printf("%.2f contacts per hit, %d hits with more than one contact\n", hits ? (double)contacts / hits : 0.0, multiContact);
+
+  free(resLinear);
+  free(resBVH);
+  free(resLinearAll);
+  free(resBVHAll);
+  free(capsules);
+  free(mesh.triVerts);
+  free(mesh.nodes);
+  return mismatches == 0 ? 0 : 1;
+}
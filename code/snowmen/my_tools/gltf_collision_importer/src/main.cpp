@@ -87,28 +87,49 @@ int main(int argc, char* argv[])
   fs::path gltfBasePath{gltfPath};
   
   uint16_t totalTriCount = 0;
+  const bool writeBVH = args.checkArg("--bvh");
+
+  // with '--bvh' the triangles are stored in BVH leaf order, followed by the nodes
+  CollisionBVH bvh{};
+  if(writeBVH) {
+    bvh = createTriangleBVH(allModels[0].triangles);
+  } else {
+    for(uint32_t i = 0; i < allModels[0].triangles.size(); i++)bvh.triOrder.push_back(i);
+  }
 
   BinaryFile file{};
   file.writeChars("COL", 3);
   //file.write(chunkCount);
-  file.write<uint8_t>(42);
+  file.write<uint8_t>(writeBVH ? 43 : 42); // version, 43 has a BVH after the triangles
   file.write<uint16_t>(69); // total vertex count (set later)
-  file.write<uint16_t>(420); // total index count (set later)
+  file.write<uint16_t>(writeBVH ? bvh.nodes.size() : 420); // BVH node count
   /*file.write(allModels[0].triangles[0].vert[0].pos[0]);
   file.write(allModels[0].triangles[0].vert[0].pos[1]);
   file.write(allModels[0].triangles[0].vert[0].pos[2]);*/
-  for (int i = 0; i < allModels[0].triangles.size(); i++)
+  for (uint32_t triIndex : bvh.triOrder)
   {
     for (int j = 0; j < 3; j++)
     {
-      file.write(allModels[0].triangles[i].vert[j].pos[0]);
-      file.write(allModels[0].triangles[i].vert[j].pos[1]);
-      file.write(allModels[0].triangles[i].vert[j].pos[2]);
+      file.write(allModels[0].triangles[triIndex].vert[j].pos[0]);
+      file.write(allModels[0].triangles[triIndex].vert[j].pos[1]);
+      file.write(allModels[0].triangles[triIndex].vert[j].pos[2]);
       
     }
     totalTriCount++;
   }
 
+  for (auto &node : bvh.nodes)
+  {
+    file.writeArray(node.aabbMin, 3);
+    file.writeArray(node.aabbMax, 3);
+    file.write(node.skip);
+    file.write(node.triData);
+  }
+
+  if(writeBVH) {
+    printf("BVH: %d nodes for %d triangles\n", (int)bvh.nodes.size(), (int)totalTriCount);
+  }
+
   file.setPos(0x04);
   file.write(totalTriCount);
 
@@ -80,4 +80,67 @@ std::vector<int16_t> createMeshBVH(const std::vector<ModelChunked> &modelChunks)
   std::vector<int16_t> treeData;
   writeBVH(treeData, bvh);
   return treeData;
-}
\ No newline at end of file
+}
+namespace
+{
+  uint16_t writeCollisionNode(CollisionBVH &out, const Bvh &bvh, const Node &node) {
+    uint16_t outIndex = out.nodes.size();
+    assert(out.nodes.size() < 0xFFFF);
+    auto &outNode = out.nodes.emplace_back();
+
+    // bounds come from integer vertex positions, so these casts are exact
+    outNode.aabbMin[0] = (int16_t)node.bounds[0];
+    outNode.aabbMin[1] = (int16_t)node.bounds[2];
+    outNode.aabbMin[2] = (int16_t)node.bounds[4];
+    outNode.aabbMax[0] = (int16_t)node.bounds[1];
+    outNode.aabbMax[1] = (int16_t)node.bounds[3];
+    outNode.aabbMax[2] = (int16_t)node.bounds[5];
+
+    if(node.is_leaf()) {
+      // triangles are re-ordered to follow the leaves, a leaf then only needs a range
+      size_t firstTri = out.triOrder.size();
+      size_t triCount = node.index.prim_count();
+      assert(firstTri < (1 << 12) && triCount < (1 << 4));
+      for(size_t i=0; i<triCount; ++i) {
+        out.triOrder.push_back(bvh.prim_ids[node.index.first_id() + i]);
+      }
+      out.nodes[outIndex].triData = (uint16_t)((firstTri << 4) | triCount);
+    } else {
+      writeCollisionNode(out, bvh, bvh.nodes[node.index.first_id()]);
+      writeCollisionNode(out, bvh, bvh.nodes[node.index.first_id() + 1]);
+    }
+    out.nodes[outIndex].skip = out.nodes.size();
+    return outIndex;
+  }
+}
+
+/**
+ * Creates a BVH over all triangles of a collision mesh.
+ * Nodes are in depth-first order with skip indices, so the runtime can walk it without a stack.
+ * The returned triangle order must be used when writing the triangles.
+ * @param triangles
+ */
+CollisionBVH createTriangleBVH(const std::vector<TriangleT3D> &triangles)
+{
+  std::vector<BBox> aabbs;
+  std::vector<BVec3> centers;
+  for(auto &tri : triangles)
+  {
+    BBox box = BBox::make_empty();
+    for(auto &vert : tri.vert) {
+      box.extend(BVec3(vert.pos[0], vert.pos[1], vert.pos[2]));
+    }
+    aabbs.push_back(box);
+    centers.push_back(box.get_center());
+  }
+
+  bvh::v2::ThreadPool thread_pool;
+  typename bvh::v2::DefaultBuilder<Node>::Config config;
+  config.quality = bvh::v2::DefaultBuilder<Node>::Quality::High;
+  auto bvh = bvh::v2::DefaultBuilder<Node>::build(thread_pool, aabbs, centers, config);
+
+  CollisionBVH res{};
+  writeCollisionNode(res, bvh, bvh.get_root());
+  assert(res.triOrder.size() == triangles.size());
+  return res;
+}
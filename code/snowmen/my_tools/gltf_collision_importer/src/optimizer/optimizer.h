@@ -7,4 +7,19 @@
 #include "../structs.h"
 
 void optimizeModelChunk(ModelChunked &model);
-std::vector<int16_t> createMeshBVH(const std::vector<ModelChunked> &modelChunks);
\ No newline at end of file
+std::vector<int16_t> createMeshBVH(const std::vector<ModelChunked> &modelChunks);
+
+// Node of the collision BVH, stored depth-first so the left child directly follows its parent
+struct CollisionBVHNode {
+  int16_t aabbMin[3]{};
+  int16_t aabbMax[3]{};
+  uint16_t skip{}; // index of the next node when this subtree is not entered
+  uint16_t triData{}; // leaf: (firstTri << 4) | triCount, inner: 0
+};
+
+struct CollisionBVH {
+  std::vector<CollisionBVHNode> nodes{};
+  std::vector<uint32_t> triOrder{}; // new triangle index -> original triangle index
+};
+
+CollisionBVH createTriangleBVH(const std::vector<TriangleT3D> &triangles);
\ No newline at end of file
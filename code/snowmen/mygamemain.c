@@ -77,7 +77,7 @@ bool fullScreen;
 
 float dist;
 
-Actor* AllActors[14];//13
+Actor* AllActors[ALL_ACTORS_COUNT];
 
 Actor EnvActor;
 
@@ -115,6 +115,8 @@ DecorationSpawnerStruct spawners[6];
 T3DVec3 DecorationSpawnerLocations[6];
 
 NodeDynamicArray AllNodes;
+AStarScratch AIScratch;
+AStarTable AIPathTable;
 
 //NodeDynamicArray testpath;
 
@@ -549,7 +551,7 @@ void AIPlayerLoop(PlayerStruct* playerStruct, int seed, float deltaTime)
     {
         //NodeDA_Free(&playerStruct->AIPath);
         //node **array = playerStruct->AIPath.nodeArray;
-        free(playerStruct->AIPath.nodeArray);
+        playerStruct->AIPath.length = 0;//storage is kept and reused by AStarTable_GetPath
         playerStruct->isDestGoalPickupDirectAI = false;
         //maybe a timer for waiting to make ai easier?
         //We want to walk towards a goal, choose which from goals not already achieved and are available on map (random)
@@ -683,14 +685,14 @@ void AIPlayerLoop(PlayerStruct* playerStruct, int seed, float deltaTime)
         //debugf("AI player pos = %f %f %f\n", playerStruct->PlayerActor.Position.v[0], playerStruct->PlayerActor.Position.v[1],  playerStruct->PlayerActor.Position.v[2]);
         node* startNode = NodeDA_GetClosestNode(&AllNodes, playerStruct->PlayerActor.Position);
 
-        //Run Astar with these two nodes, add the origin node to the path after it returns. Set ai_path index for player
+        //Look up the path between these two nodes, add the origin node to the path after it returns. Set ai_path index for player
         pizza++;
-        debugf("            Player %d Running AStarRun, times: %d\n", playerStruct->playerId+1, pizza);
+        debugf("            Player %d Looking up path, times: %d\n", playerStruct->playerId+1, pizza);
         debugf("            start node: %d\n", startNode->id);
         debugf("            End node: %d\n", GoalNode->id);
         debugf("            Goal type: %d\n", playerStruct->AIGoalType);
         debugf("            oh, and are we good? %d\n", playerStruct->AIGoalPickup != NULL);
-        AStarRun(startNode, GoalNode, &playerStruct->AIPath);
+        AStarTable_GetPath(&AIPathTable, &AIScratch, startNode, GoalNode, &playerStruct->AIPath);
         NodeDA_Add(&playerStruct->AIPath, startNode);
         playerStruct->ai_path_index = playerStruct->AIPath.length - 1;
 
@@ -1093,6 +1095,8 @@ void minigame_init()
     pizza = 0;
 
         BadNoGoodNodeCreation();
+        AStarScratch_Create(&AIScratch, &AllNodes);
+        AStarTable_Create(&AIPathTable, &AIScratch);
 
 
     
@@ -1372,7 +1376,7 @@ void minigame_init()
 
     ActorInit(&EnvActor);
 
-    AllActors[13] = &EnvActor;
+    AllActors[ALL_ACTORS_COUNT - 1] = &EnvActor;
 //////////////////////////////////////treeModel, treeMatFP, treeMat
 /*T3DMat4FP* treeMatFP;
 rspq_block_t *dplTree;
@@ -2445,6 +2449,8 @@ void minigame_cleanup()
     t3d_destroy(); 
     display_close();
 
+    AStarTable_Free(&AIPathTable);
+    AStarScratch_Free(&AIScratch);
     NodeDA_Free(&AllNodes);
 }
 
@@ -193,6 +193,7 @@ void PlayerInit(struct PlayerStruct* playerStruct, enum EPlayerId playerId)
 
 
   playerStruct->ai_path_index = 0;
+  playerStruct->AIPath = (NodeDynamicArray){0};
 
 
     T3DMat4 ArrowTransform;
@@ -502,8 +503,7 @@ bool GroundedMovement(PlayerStruct* ThisPlayer, Actor** AllActors, float XStick,
 -------------------Collision-------------------------
 *******************************************************/
     //debugf("Collision Begin\n");
-    T3DVec3 penetration_normal;
-    float penetration_depth = 0.f;
+    CollisionManifold manifold;
     bool collide = false;
     float deltaTimeFraction = deltaTime * .25f;
     T3DVec3 QuarterMovement;
@@ -518,16 +518,22 @@ bool GroundedMovement(PlayerStruct* ThisPlayer, Actor** AllActors, float XStick,
         ThisPlayer->PlayerActor.Position.v[2]
     }};
     //debugf("Movement Collision Test:\n");
-    if (TestAllCollision(&ThisPlayer->PlayerActor, AllActors, &penetration_normal, &penetration_depth, deltaTimeFraction))
+    //all contacts at once, so corners resolve in this step instead of over several frames
+    if (TestAllCollisionManifold(&ThisPlayer->PlayerActor, AllActors, &manifold, deltaTimeFraction))
     {
       collide = true;
-      //debugf("Well then... Penetration Depth = %f\n", penetration_depth);
-        //debugf("Collision Detected! Normal: %f %f %f, \nDepth: %f\n",penetration_normal.v[0], penetration_normal.v[1], penetration_normal.v[2],
-        //  penetration_depth);
         ThisPlayer->PlayerActor.Position = ThisPlayer->PlayerActor.PrevPosition;
-        penetration_normal.v[1] = 0.f;
-        fast_vec3_norm(&penetration_normal);
-        CapsuleRespondCollideNSlide(&ThisPlayer->PlayerActor, &penetration_normal, penetration_depth, deltaTimeFraction);
+        //players only slide horizontally, drop contacts that have no horizontal part
+        CollisionManifold flatManifold = {.numContacts = 0};
+        for (int c = 0; c < manifold.numContacts; c++)
+        {
+          T3DVec3 flatNormal = manifold.contacts[c].normal;
+          flatNormal.v[1] = 0.f;
+          if (t3d_vec3_len2(&flatNormal) < 0.0001f) continue;
+          fast_vec3_norm(&flatNormal);
+          CollisionManifold_Add(&flatManifold, &flatNormal, manifold.contacts[c].depth);
+        }
+        CapsuleRespondCollideNSlideManifold(&ThisPlayer->PlayerActor, &flatManifold, deltaTimeFraction);
         break;
     }
     //debugf("HA HA HA WHAT... Penetration Depth = %f\n", penetration_depth);
@@ -735,6 +741,7 @@ if(playerStruct->modelArrow != NULL)
 
 
   free(playerStruct->AIPath.nodeArray);
+  playerStruct->AIPath = (NodeDynamicArray){0};
 
   TriggerFree(&playerStruct->attackTrigger);
 
@@ -95,7 +95,7 @@ filesystem/snowmen/%.col: assets/snowmen/%.col
 # Reenable this after we find out how to build a tool as part of the pipeline
 # filesystem/snowmen/%.col: assets/snowmen/%.glb
 # 	@echo "    [CUSTOM_COLLISION] $@"
-# 	$(CUSTOM_GLTF_COLLISION) "$<" $@
+# 	$(CUSTOM_GLTF_COLLISION) "$<" $@ --bvh
 # 	$(N64_BINDIR)/mkasset -c 2 -o $(dir $@) $@
 
 filesystem/snowmen/%.t3dm: assets/snowmen/%.glb
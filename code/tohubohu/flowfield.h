@@ -0,0 +1,183 @@
+// Flow field (Dijkstra map) towards a single target on the walkability grid.
+// Computed once, then any number of agents read their next cell in O(1).
+
+#ifndef __FLOWFIELD_H
+#define __FLOWFIELD_H
+
+#include "jps.h"
+
+#define FLOW_UNREACHABLE 0xFFFF
+#define FLOW_NONE -1
+#define FLOW_COST_STRAIGHT 10
+#define FLOW_COST_DIAGONAL 14
+
+// Opposite directions are paired so that d ^ 1 reverses d
+const cell_t flow_directions[8] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {-1, -1}, {1, -1}, {-1, 1}};
+
+
+typedef struct {
+    const grid_t* grid;
+    cell_t target;
+    int tick;           // Caller defined timestamp of the last computation
+    bool valid;
+    uint16_t* dist;     // Cost to target, in FLOW_COST units
+    int8_t* next;       // Index in flow_directions of the next cell towards the target
+} flow_field_t;
+
+// Priority queue shared by all flow fields of a grid
+typedef struct {
+    uint16_t* heap;
+    uint16_t* heap_idx;
+    size_t heap_count;
+} flow_queue_t;
+
+void flow_field_init(flow_field_t* field, const grid_t* grid) {
+    const size_t size = grid->width * grid->height;
+    field->grid = grid;
+    field->target = (cell_t){-1, -1};
+    field->tick = 0;
+    field->valid = false;
+    field->dist = malloc(size * sizeof(uint16_t));
+    field->next = malloc(size * sizeof(int8_t));
+}
+
+void flow_field_free(flow_field_t* field) {
+    free(field->dist);
+    free(field->next);
+    field->dist = NULL;
+    field->next = NULL;
+    field->valid = false;
+}
+
+void flow_queue_init(flow_queue_t* queue, const grid_t* grid) {
+    const size_t size = grid->width * grid->height;
+    queue->heap = malloc(size * sizeof(uint16_t));
+    queue->heap_idx = malloc(size * sizeof(uint16_t));
+    queue->heap_count = 0;
+}
+
+void flow_queue_free(flow_queue_t* queue) {
+    free(queue->heap);
+    free(queue->heap_idx);
+    queue->heap = NULL;
+    queue->heap_idx = NULL;
+}
+
+void flow_queue_swap(flow_queue_t* queue, size_t index1, size_t index2) {
+    const uint16_t tmp = queue->heap[index1];
+    queue->heap[index1] = queue->heap[index2];
+    queue->heap[index2] = tmp;
+    queue->heap_idx[queue->heap[index1]] = index1;
+    queue->heap_idx[queue->heap[index2]] = index2;
+}
+
+void flow_queue_up(flow_queue_t* queue, const uint16_t* dist, size_t index) {
+    while (index > 0) {
+        const size_t parent = (index - 1) / 2;
+        if (dist[queue->heap[parent]] <= dist[queue->heap[index]]) {
+            break;
+        }
+        flow_queue_swap(queue, parent, index);
+        index = parent;
+    }
+}
+
+void flow_queue_down(flow_queue_t* queue, const uint16_t* dist, size_t index) {
+    while (true) {
+        const size_t left = (2 * index) + 1;
+        const size_t right = (2 * index) + 2;
+        size_t smallest = index;
+        if (left < queue->heap_count && dist[queue->heap[left]] < dist[queue->heap[smallest]]) {
+            smallest = left;
+        }
+        if (right < queue->heap_count && dist[queue->heap[right]] < dist[queue->heap[smallest]]) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
+        flow_queue_swap(queue, smallest, index);
+        index = smallest;
+    }
+}
+
+// Dijkstra from the target over the whole grid, same moves as the path finder (8 ways, no corner cutting)
+void flow_field_compute(flow_field_t* field, flow_queue_t* queue, cell_t target, int tick) {
+    const grid_t* grid = field->grid;
+    const size_t size = grid->width * grid->height;
+    memset(field->dist, 0xFF, size * sizeof(uint16_t));
+    memset(field->next, FLOW_NONE, size * sizeof(int8_t));
+    field->target = target;
+    field->tick = tick;
+    field->valid = true;
+
+    cell_t goal = jps_nearest_walkable(grid, target, 3);
+    if (goal.x < 0 || goal.x >= grid->width || goal.y < 0 || goal.y >= grid->height) {
+        return;
+    }
+    const uint16_t goal_idx = goal.y*grid->width + goal.x;
+    field->dist[goal_idx] = 0;
+    queue->heap_count = 0;
+    queue->heap[0] = goal_idx;
+    queue->heap_idx[goal_idx] = 0;
+    queue->heap_count = 1;
+
+    while (queue->heap_count > 0) {
+        const uint16_t current = queue->heap[0];
+        queue->heap_count--;
+        if (queue->heap_count > 0) {
+            queue->heap[0] = queue->heap[queue->heap_count];
+            queue->heap_idx[queue->heap[0]] = 0;
+            flow_queue_down(queue, field->dist, 0);
+        }
+
+        const int x = current % grid->width;
+        const int y = current / grid->width;
+        for (int d=0; d<8; d++) {
+            const int dx = flow_directions[d].x;
+            const int dy = flow_directions[d].y;
+            if (!grid_is_walkable(grid, x+dx, y+dy)) continue;
+            const bool diagonal = (dx != 0 && dy != 0);
+            if (diagonal && (!grid_is_walkable(grid, x+dx, y) || !grid_is_walkable(grid, x, y+dy))) continue;
+
+            const uint16_t neighbour = (y+dy)*grid->width + (x+dx);
+            const uint32_t cost = field->dist[current] + (diagonal ? FLOW_COST_DIAGONAL : FLOW_COST_STRAIGHT);
+            if (cost < field->dist[neighbour]) {
+                const bool queued = field->dist[neighbour] != FLOW_UNREACHABLE;
+                field->dist[neighbour] = cost;
+                // Moves are symmetric: the neighbour reaches the target by stepping back to us
+                field->next[neighbour] = d ^ 1;
+                if (!queued) {
+                    queue->heap[queue->heap_count] = neighbour;
+                    queue->heap_idx[neighbour] = queue->heap_count;
+                    queue->heap_count++;
+                }
+                flow_queue_up(queue, field->dist, queue->heap_idx[neighbour]);
+            }
+        }
+    }
+}
+
+bool flow_field_reachable(const flow_field_t* field, cell_t cell) {
+    const grid_t* grid = field->grid;
+    if (!field->valid || cell.x < 0 || cell.x >= grid->width || cell.y < 0 || cell.y >= grid->height) {
+        return false;
+    }
+    return field->dist[cell.y*grid->width + cell.x] != FLOW_UNREACHABLE;
+}
+
+// Move cell one step towards the target, returns false once there (or if the target can't be reached)
+bool flow_field_step(const flow_field_t* field, cell_t* cell) {
+    if (!flow_field_reachable(field, *cell)) {
+        return false;
+    }
+    const int8_t d = field->next[cell->y*field->grid->width + cell->x];
+    if (d == FLOW_NONE) {
+        return false;
+    }
+    cell->x += flow_directions[d].x;
+    cell->y += flow_directions[d].y;
+    return true;
+}
+
+#endif
@@ -1,5 +1,7 @@
 #include "game.h"
 #include "astar.h"
+#include "jps.h"
+#include "flowfield.h"
 #include "../../core.h"
 #include "../../minigame.h"
 #include <t3d/t3d.h>
@@ -27,11 +29,14 @@
 #define T3D_MODEL_SCALE 64
 #define MAP_REDUCTION_FACTOR 4
 #define MAX_PATH_VISIT 500
+#define MAX_PATH_JUMPS 200
 #define PATH_8_WAYS 1
+#define PATH_JPS 1
 #define PATH_LOOKUP 30
 #define PATH_LENGTH 10
 #define NO_PATH 9999
 #define WAYPOINT_DELAY 60
+#define FLOW_FIELD_DELAY 20
 #define WAYPOINT_DISTANCE_THRESHOLD 5.0f
 #define ACTION_DISTANCE_THRESHOLD 10.0f
 #define ACTION_TIME (50.0f/60.0f)
@@ -203,7 +208,11 @@ c2AABB actor_bounding_box(actor_t* actor) {
 int map_width;
 int map_height;
 T3DVec3 origin;
-char* map;
+grid_t map;
+jps_pool_t path_pool;
+flow_field_t chase_fields[MAXPLAYERS];   // Flow fields towards each chased player
+flow_queue_t chase_queue;
+int path_tick;
 
 inline static void to_pathmap_coords(T3DVec3 *res, const T3DVec3 *a) {
     t3d_vec3_scale(res, a, 1.0f/MAP_REDUCTION_FACTOR);
@@ -224,28 +233,28 @@ void update_obstacles() {
         for (int y=0; y<room.h; y++) {
             T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
             to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
+            grid_set_blocked(&map, (int)coords.v[0], (int)coords.v[2]);
         }
     }
     for (int x=room.w; x>room.w-margin; x--) {
         for (int y=0; y<room.h; y++) {
             T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
             to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
+            grid_set_blocked(&map, (int)coords.v[0], (int)coords.v[2]);
         }
     }
     for (int y=0; y<margin; y++) {
         for (int x=0; x<room.w; x++) {
             T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
             to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
+            grid_set_blocked(&map, (int)coords.v[0], (int)coords.v[2]);
         }
     }
     for (int y=room.h; y>room.h-margin; y--) {
         for (int x=0; x<room.w; x++) {
             T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
             to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
+            grid_set_blocked(&map, (int)coords.v[0], (int)coords.v[2]);
         }
     }
     // Furnitures
@@ -256,9 +265,7 @@ void update_obstacles() {
         to_pathmap_coords(&furniture_max, &furniture_max);
         for (int x=furniture_min.v[0]+1; x<furniture_max.v[0]; x++) {
             for (int y=furniture_min.v[2]+1; y<furniture_max.v[2]; y++) {
-                if (x >= 0 && x < map_width && y >= 0 && y < map_height) {
-                    *(map+y*map_width+x) = 1;
-                }
+                grid_set_blocked(&map, x, y);
             }
         }
     }
@@ -270,20 +277,14 @@ void update_obstacles() {
         to_pathmap_coords(&vault_max, &vault_max);
         for (int x=vault_min.v[0]+1; x<vault_max.v[0]; x++) {
             for (int y=vault_min.v[2]+1; y<vault_max.v[2]; y++) {
-                if (x >= 0 && x < map_width && y >= 0 && y < map_height) {
-                    *(map+y*map_width+x) = 1;
-                }
+                grid_set_blocked(&map, x, y);
             }
         }
     }
 }
 
 bool is_walkable(cell_t cell) {
-    bool walkable = (cell.x >= 0 && cell.x < map_width && cell.y >= 0 && cell.y < map_height);
-    if (walkable) {
-        return *(map+cell.y*map_width+cell.x) != 1;
-    }
-    return walkable;
+    return grid_is_walkable(&map, cell.x, cell.y);
 }
 
 void add_neighbours(node_list_t* list, cell_t cell) {
@@ -322,7 +323,12 @@ void update_path(PlyNum i) {
     to_pathmap_coords(&target, &players[i].target);
     cell_t start_node = {(int)start.v[0], (int)start.v[2]};
     cell_t target_node = {(int)target.v[0], (int)target.v[2]};
+#if PATH_JPS
+    // Jump points are cheap enough to search the whole room, no need to stop at path_lookup
+    path_t* path = jps_find_path(&path_pool, start_node, target_node, -1, MAX_PATH_JUMPS);
+#else
     path_t* path = find_path(start_node, target_node, players[i].path_lookup, MAX_PATH_VISIT);
+#endif
     if (get_path_count(path) > 1) {
         // Keep fewer waypoints when chasing a player
         int keep = players[i].state == MOVING_TO_PLAYER ? players[i].path_keep_chase : players[i].path_keep;
@@ -340,6 +346,44 @@ void update_path(PlyNum i) {
     free_path(path);
 }
 
+flow_field_t* get_chase_field(PlyNum target_idx) {
+    // Shared by all players chasing the same target, only recomputed when the target changed cell
+    flow_field_t* field = &chase_fields[target_idx];
+    T3DVec3 target;
+    to_pathmap_coords(&target, &players[target_idx].position);
+    cell_t target_node = {(int)target.v[0], (int)target.v[2]};
+    bool moved = (field->target.x != target_node.x || field->target.y != target_node.y);
+    if (!field->valid || (moved && path_tick - field->tick >= FLOW_FIELD_DELAY)) {
+        flow_field_compute(field, &chase_queue, target_node, path_tick);
+    }
+    return field;
+}
+
+void update_chase_path(PlyNum i) {
+    flow_field_t* field = get_chase_field(players[i].target_idx);
+    T3DVec3 start;
+    to_pathmap_coords(&start, &players[i].position);
+    cell_t node = jps_nearest_walkable(&map, (cell_t){(int)start.v[0], (int)start.v[2]}, 3);
+    if (!flow_field_reachable(field, node)) {
+        update_path(i);
+        return;
+    }
+    // Clear path
+    for (int j=0; j<PATH_LENGTH; j++) {
+        players[i].path[j].v[0] = NO_PATH;
+        players[i].path[j].v[2] = NO_PATH;
+    }
+    players[i].path_pos = 0;
+    // Read next waypoints from the flow field
+    do {
+        if (players[i].path_pos >= players[i].path_keep_chase)   break;
+        players[i].path[players[i].path_pos].v[0] = node.x;
+        players[i].path[players[i].path_pos].v[2] = node.y;
+        players[i].path_pos++;
+    } while (flow_field_step(field, &node));
+    players[i].path_pos = 0;
+}
+
 bool has_waypoints(PlyNum i) {
     return players[i].path[players[i].path_pos].v[0] != NO_PATH;
 }
@@ -741,7 +785,13 @@ void game_init()
     map_width = (room.w/MAP_REDUCTION_FACTOR) + 1;
     map_height = (room.h/MAP_REDUCTION_FACTOR) + 1;
     origin = (T3DVec3){{-map_width/2.0f, 0, -map_height/2.0f}};
-    map = calloc(1, sizeof(char) * map_width * map_height);
+    grid_init(&map, map_width, map_height);
+    jps_pool_init(&path_pool, &map);
+    for (size_t i = 0; i < MAXPLAYERS; i++) {
+        flow_field_init(&chase_fields[i], &map);
+    }
+    flow_queue_init(&chase_queue, &map);
+    path_tick = 0;
     update_obstacles();
 }
 
@@ -749,6 +799,7 @@ void game_init()
 void game_logic(float deltatime)
 {
     if (is_playing() && !is_paused()) {
+        path_tick++;
         // Player controls
         for (size_t i = 0; i < MAXPLAYERS; i++) {
             if (players[i].hurt_playing_time > 0) {
@@ -867,7 +918,11 @@ void game_logic(float deltatime)
                             next_state = MOVING_TO_FURNITURE;
                         }
 
-                        update_path(i);
+                        if (next_state == MOVING_TO_PLAYER) {
+                            update_chase_path(i);
+                        } else {
+                            update_path(i);
+                        }
                         if (has_waypoints(i)) {
                             reset_idle_delay(i);
                             players[i].state = next_state;
@@ -935,7 +990,7 @@ void game_logic(float deltatime)
                                 players[i].target.v[1] = players[target_idx].position.v[1];
                                 players[i].target.v[2] = players[target_idx].position.v[2];
                                 //debugf("Player #%d now chasing player #%d at *new* coords: %f %f\n", i, target_idx, players[i].target.v[0], players[i].target.v[2]);
-                                update_path(i);
+                                update_chase_path(i);
                             }
                         }
                         break;
@@ -1183,7 +1238,7 @@ void game_render_gl(float deltatime)
     /*
     for (int x=0; x<map_width; x++) {
         for (int y=0; y<map_height; y++) {
-            char walkable = *(map+y*map_width+x) == 0;
+            char walkable = grid_is_walkable(&map, x, y);
             T3DVec3 point = (T3DVec3){{x, 0, y}};
             from_pathmap_coords(&point, &point);
             float r = 1.0f;
@@ -1284,7 +1339,12 @@ void game_render_gl(float deltatime)
 
 void game_cleanup()
 {
-    free(map);
+    jps_pool_free(&path_pool);
+    for (size_t i = 0; i < MAXPLAYERS; i++) {
+        flow_field_free(&chase_fields[i]);
+    }
+    flow_queue_free(&chase_queue);
+    grid_free(&map);
 
 #if ENABLE_TEXT
     rdpq_text_unregister_font(FONT_BILLBOARD);
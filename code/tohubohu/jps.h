@@ -0,0 +1,380 @@
+// Jump Point Search on a bit-packed walkability grid (8 ways, no corner cutting)
+// Based on Harabor & Grastien's "Online Graph Pruning for Pathfinding on Grid Maps"
+
+#ifndef __JPS_H
+#define __JPS_H
+
+#include "astar.h"
+#include <assert.h>
+
+#define JPS_SQRT2 1.414f
+#define JPS_NO_PARENT 0xFFFF
+
+
+// Walkability grid, one bit per cell (set = blocked)
+
+typedef struct {
+    int width;
+    int height;
+    int stride;     // 32-bit words per row
+    uint32_t* bits;
+} grid_t;
+
+void grid_init(grid_t* grid, int width, int height) {
+    grid->width = width;
+    grid->height = height;
+    grid->stride = (width + 31) / 32;
+    grid->bits = calloc(grid->stride * height, sizeof(uint32_t));
+}
+
+void grid_free(grid_t* grid) {
+    free(grid->bits);
+    grid->bits = NULL;
+}
+
+void grid_clear(grid_t* grid) {
+    memset(grid->bits, 0, grid->stride * grid->height * sizeof(uint32_t));
+}
+
+void grid_set_blocked(grid_t* grid, int x, int y) {
+    if (x >= 0 && x < grid->width && y >= 0 && y < grid->height) {
+        grid->bits[y*grid->stride + (x >> 5)] |= (1u << (x & 31));
+    }
+}
+
+bool grid_is_walkable(const grid_t* grid, int x, int y) {
+    if (x < 0 || x >= grid->width || y < 0 || y >= grid->height) {
+        return false;
+    }
+    return !(grid->bits[y*grid->stride + (x >> 5)] & (1u << (x & 31)));
+}
+
+
+// Search state, one record per grid cell, allocated once.
+// Records are only valid when their stamp matches the pool generation, so
+// starting a new search does not need to clear them.
+
+typedef struct {
+    float cost;
+    float rank;
+    uint16_t parent;
+    uint16_t heap_idx;
+    uint16_t seen_gen;
+    uint16_t closed_gen;
+} jps_record_t;
+
+typedef struct {
+    const grid_t* grid;
+    jps_record_t* records;
+    uint16_t* heap;
+    size_t heap_count;
+    uint16_t generation;
+} jps_pool_t;
+
+void jps_pool_init(jps_pool_t* pool, const grid_t* grid) {
+    const size_t size = grid->width * grid->height;
+    assert(size < JPS_NO_PARENT);
+    pool->grid = grid;
+    pool->records = calloc(size, sizeof(jps_record_t));
+    pool->heap = malloc(size * sizeof(uint16_t));
+    pool->heap_count = 0;
+    pool->generation = 0;
+}
+
+void jps_pool_free(jps_pool_t* pool) {
+    free(pool->records);
+    free(pool->heap);
+    pool->records = NULL;
+    pool->heap = NULL;
+}
+
+float jps_distance(int x1, int y1, int x2, int y2) {
+    // Octile distance
+    const int dx = abs(x1 - x2);
+    const int dy = abs(y1 - y2);
+    return (dx < dy) ? (dy + (JPS_SQRT2 - 1) * dx) : (dx + (JPS_SQRT2 - 1) * dy);
+}
+
+void jps_heap_swap(jps_pool_t* pool, size_t index1, size_t index2) {
+    const uint16_t tmp = pool->heap[index1];
+    pool->heap[index1] = pool->heap[index2];
+    pool->heap[index2] = tmp;
+    pool->records[pool->heap[index1]].heap_idx = index1;
+    pool->records[pool->heap[index2]].heap_idx = index2;
+}
+
+void jps_heap_up(jps_pool_t* pool, size_t index) {
+    while (index > 0) {
+        const size_t parent = (index - 1) / 2;
+        if (pool->records[pool->heap[parent]].rank <= pool->records[pool->heap[index]].rank) {
+            break;
+        }
+        jps_heap_swap(pool, parent, index);
+        index = parent;
+    }
+}
+
+void jps_heap_down(jps_pool_t* pool, size_t index) {
+    while (true) {
+        const size_t left = (2 * index) + 1;
+        const size_t right = (2 * index) + 2;
+        size_t smallest = index;
+        if (left < pool->heap_count && pool->records[pool->heap[left]].rank < pool->records[pool->heap[smallest]].rank) {
+            smallest = left;
+        }
+        if (right < pool->heap_count && pool->records[pool->heap[right]].rank < pool->records[pool->heap[smallest]].rank) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
+        jps_heap_swap(pool, smallest, index);
+        index = smallest;
+    }
+}
+
+void jps_heap_push(jps_pool_t* pool, uint16_t node) {
+    pool->heap[pool->heap_count] = node;
+    pool->records[node].heap_idx = pool->heap_count;
+    pool->heap_count++;
+    jps_heap_up(pool, pool->heap_count - 1);
+}
+
+uint16_t jps_heap_pop(jps_pool_t* pool) {
+    const uint16_t node = pool->heap[0];
+    pool->heap_count--;
+    if (pool->heap_count > 0) {
+        pool->heap[0] = pool->heap[pool->heap_count];
+        pool->records[pool->heap[0]].heap_idx = 0;
+        jps_heap_down(pool, 0);
+    }
+    return node;
+}
+
+// Walk in a straight line from (x, y) until reaching the target or a cell with a forced neighbour
+bool jps_jump_straight(const grid_t* grid, int x, int y, int dx, int dy, cell_t target, cell_t* jump_point) {
+    while (true) {
+        x += dx;
+        y += dy;
+        if (!grid_is_walkable(grid, x, y)) {
+            return false;
+        }
+        if ((x == target.x && y == target.y)
+            || (dx != 0 && ((grid_is_walkable(grid, x, y-1) && !grid_is_walkable(grid, x-dx, y-1))
+                         || (grid_is_walkable(grid, x, y+1) && !grid_is_walkable(grid, x-dx, y+1))))
+            || (dy != 0 && ((grid_is_walkable(grid, x-1, y) && !grid_is_walkable(grid, x-1, y-dy))
+                         || (grid_is_walkable(grid, x+1, y) && !grid_is_walkable(grid, x+1, y-dy))))) {
+            *jump_point = (cell_t){x, y};
+            return true;
+        }
+    }
+}
+
+// Walk diagonally from (x, y), stopping where one of the straight scans finds a jump point
+bool jps_jump(const grid_t* grid, int x, int y, int dx, int dy, cell_t target, cell_t* jump_point) {
+    if (dx == 0 || dy == 0) {
+        return jps_jump_straight(grid, x, y, dx, dy, target, jump_point);
+    }
+    cell_t unused;
+    while (true) {
+        if (!grid_is_walkable(grid, x+dx, y) || !grid_is_walkable(grid, x, y+dy) || !grid_is_walkable(grid, x+dx, y+dy)) {
+            return false;
+        }
+        x += dx;
+        y += dy;
+        if ((x == target.x && y == target.y)
+            || jps_jump_straight(grid, x, y, dx, 0, target, &unused)
+            || jps_jump_straight(grid, x, y, 0, dy, target, &unused)) {
+            *jump_point = (cell_t){x, y};
+            return true;
+        }
+    }
+}
+
+// Directions worth exploring from a cell reached by moving along (dx, dy)
+int jps_prune_directions(const grid_t* grid, int x, int y, int dx, int dy, cell_t* dirs) {
+    int count = 0;
+    if (dx == 0 && dy == 0) {
+        for (int i=-1; i<=1; i++) {
+            for (int j=-1; j<=1; j++) {
+                if (i == 0 && j == 0) continue;
+                if (i != 0 && j != 0 && (!grid_is_walkable(grid, x+i, y) || !grid_is_walkable(grid, x, y+j))) continue;
+                if (grid_is_walkable(grid, x+i, y+j)) {
+                    dirs[count++] = (cell_t){i, j};
+                }
+            }
+        }
+    } else if (dx != 0 && dy != 0) {
+        const bool walk_x = grid_is_walkable(grid, x+dx, y);
+        const bool walk_y = grid_is_walkable(grid, x, y+dy);
+        if (walk_x) dirs[count++] = (cell_t){dx, 0};
+        if (walk_y) dirs[count++] = (cell_t){0, dy};
+        if (walk_x && walk_y && grid_is_walkable(grid, x+dx, y+dy)) dirs[count++] = (cell_t){dx, dy};
+    } else {
+        // Perpendicular directions are always kept: with corner cutting disabled they
+        // are the only way around an obstacle ending behind us
+        const int px = dy;
+        const int py = dx;
+        const bool walk_next = grid_is_walkable(grid, x+dx, y+dy);
+        const bool walk_left = grid_is_walkable(grid, x+px, y+py);
+        const bool walk_right = grid_is_walkable(grid, x-px, y-py);
+        if (walk_next) {
+            dirs[count++] = (cell_t){dx, dy};
+            if (walk_left && grid_is_walkable(grid, x+dx+px, y+dy+py)) dirs[count++] = (cell_t){dx+px, dy+py};
+            if (walk_right && grid_is_walkable(grid, x+dx-px, y+dy-py)) dirs[count++] = (cell_t){dx-px, dy-py};
+        }
+        if (walk_left) dirs[count++] = (cell_t){px, py};
+        if (walk_right) dirs[count++] = (cell_t){-px, -py};
+    }
+    return count;
+}
+
+// Closest walkable cell within a few rings around the given one, used when players stand in the wall margin
+cell_t jps_nearest_walkable(const grid_t* grid, cell_t cell, int max_radius) {
+    if (grid_is_walkable(grid, cell.x, cell.y)) {
+        return cell;
+    }
+    for (int r=1; r<=max_radius; r++) {
+        for (int i=-r; i<=r; i++) {
+            for (int j=-r; j<=r; j++) {
+                if ((abs(i) == r || abs(j) == r) && grid_is_walkable(grid, cell.x+i, cell.y+j)) {
+                    return (cell_t){cell.x+i, cell.y+j};
+                }
+            }
+        }
+    }
+    return cell;
+}
+
+// Same contract as find_path, except that max_visit counts expanded jump points
+// and the returned path is expanded back to one cell per step
+path_t* jps_find_path(jps_pool_t* pool, cell_t start, cell_t target, int max_cost, int max_visit) {
+    const grid_t* grid = pool->grid;
+    if (start.x < 0 || start.x >= grid->width || start.y < 0 || start.y >= grid->height) {
+        return NULL;
+    }
+
+    // Stamps wrapped around, stale records could look valid again
+    if (++pool->generation == 0) {
+        memset(pool->records, 0, grid->width * grid->height * sizeof(jps_record_t));
+        pool->generation = 1;
+    }
+    const uint16_t gen = pool->generation;
+    pool->heap_count = 0;
+
+    start = jps_nearest_walkable(grid, start, 3);
+    cell_t goal = jps_nearest_walkable(grid, target, 3);
+    const uint16_t start_idx = start.y*grid->width + start.x;
+    jps_record_t* record = &pool->records[start_idx];
+    record->cost = 0;
+    record->rank = jps_distance(start.x, start.y, goal.x, goal.y);
+    record->parent = JPS_NO_PARENT;
+    record->seen_gen = gen;
+    jps_heap_push(pool, start_idx);
+
+    uint16_t best = start_idx;
+    float best_estimate = record->rank;
+    bool found = false;
+    int remaining = max_visit;
+    cell_t dirs[8];
+
+    while (pool->heap_count > 0 && (max_visit == -1 || remaining-- > 0)) {
+        const uint16_t current = jps_heap_pop(pool);
+        jps_record_t* current_record = &pool->records[current];
+        current_record->closed_gen = gen;
+        const int x = current % grid->width;
+        const int y = current / grid->width;
+
+        if (x == goal.x && y == goal.y) {
+            best = current;
+            found = true;
+            break;
+        }
+
+        // Stop as soon as the best path reached the targeted cost
+        if (max_cost != -1 && pool->records[best].cost >= max_cost) {
+            break;
+        }
+
+        int dx = 0;
+        int dy = 0;
+        if (current_record->parent != JPS_NO_PARENT) {
+            const int parent_x = current_record->parent % grid->width;
+            const int parent_y = current_record->parent / grid->width;
+            dx = (x > parent_x) - (x < parent_x);
+            dy = (y > parent_y) - (y < parent_y);
+        }
+
+        const int dirs_count = jps_prune_directions(grid, x, y, dx, dy, dirs);
+        for (int d=0; d<dirs_count; d++) {
+            cell_t jump_point;
+            if (!jps_jump(grid, x, y, dirs[d].x, dirs[d].y, goal, &jump_point)) {
+                continue;
+            }
+            const uint16_t neighbour = jump_point.y*grid->width + jump_point.x;
+            jps_record_t* neighbour_record = &pool->records[neighbour];
+            if (neighbour_record->seen_gen == gen && neighbour_record->closed_gen == gen) {
+                continue;
+            }
+
+            const float cost = current_record->cost + jps_distance(x, y, jump_point.x, jump_point.y);
+            const float estimate = jps_distance(jump_point.x, jump_point.y, goal.x, goal.y);
+            if (neighbour_record->seen_gen != gen) {
+                neighbour_record->seen_gen = gen;
+                neighbour_record->cost = cost;
+                neighbour_record->rank = cost + estimate;
+                neighbour_record->parent = current;
+                jps_heap_push(pool, neighbour);
+            } else if (cost < neighbour_record->cost) {
+                neighbour_record->cost = cost;
+                neighbour_record->rank = cost + estimate;
+                neighbour_record->parent = current;
+                jps_heap_up(pool, neighbour_record->heap_idx);
+            }
+
+            // Keep track of the cell closest to the target in case it is unreachable
+            if (estimate < best_estimate || (estimate == best_estimate && cost < pool->records[best].cost)) {
+                best = neighbour;
+                best_estimate = estimate;
+            }
+        }
+    }
+
+    // Count cells along the jump points chain
+    size_t count = 1;
+    for (uint16_t n = best; pool->records[n].parent != JPS_NO_PARENT; n = pool->records[n].parent) {
+        const uint16_t p = pool->records[n].parent;
+        const int steps_x = abs((n % grid->width) - (p % grid->width));
+        const int steps_y = abs((n / grid->width) - (p / grid->width));
+        count += (steps_x > steps_y) ? steps_x : steps_y;
+    }
+
+    path_t* path = malloc(sizeof(path_t) + (count * sizeof(cell_t)));
+    path->capacity = count;
+    path->count = count;
+    path->cost = pool->records[best].cost;
+    path->incomplete = !found || goal.x != target.x || goal.y != target.y;
+
+    // Fill cells backwards, stepping from each jump point towards its parent
+    size_t i = count;
+    for (uint16_t n = best; ; n = pool->records[n].parent) {
+        int cx = n % grid->width;
+        int cy = n / grid->width;
+        const uint16_t p = pool->records[n].parent;
+        if (p == JPS_NO_PARENT) {
+            path->cells[--i] = (cell_t){cx, cy};
+            break;
+        }
+        const int px = p % grid->width;
+        const int py = p / grid->width;
+        while (cx != px || cy != py) {
+            path->cells[--i] = (cell_t){cx, cy};
+            cx += (px > cx) - (px < cx);
+            cy += (py > cy) - (py < cy);
+        }
+    }
+
+    return path;
+}
+
+#endif
@@ -10,7 +10,7 @@ typedef struct
     float penetration;
 } ContactData;
 
-void contactData_init(ContactData *contact)
+static inline void contactData_init(ContactData *contact)
 {
     contact->point = (Vector3){0, 0, 0};
     contact->normal = (Vector3){0, 0, 0};
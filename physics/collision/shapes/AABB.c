@@ -1,31 +1,4 @@
-#ifndef AABB_H
-#define AABB_H
-
-// structures
-
-typedef struct AABB
-{
-    Vector3 minCoordinates;
-    Vector3 maxCoordinates;
-} AABB;
-
-#define MAGIC_NUM 0
-
-// function prototypes
-
-void aabb_setFromCenterAndSize(AABB *aabb, const Vector3 *center, const Vector3 *size);
-void aabb_getCorners(const AABB *aabb, Vector3 corners[8]);
-
-Vector3 aabb_closestToPoint(const AABB *aabb, const Vector3 *point);
-Vector3 aabb_closestToSegment(const AABB *aabb, const Vector3 *a, const Vector3 *b);
-
-bool aabb_containsPoint(const AABB *aabb, const Vector3 *point);
-bool aabb_contactAABB(const AABB *a, const AABB *b);
-void aabb_contactAABBsetData(ContactData *contact, const AABB *a, const AABB *b);
-bool aabb_contactSphere(const AABB *aabb, const Sphere *sphere);
-void aabb_contactSphereSetData(ContactData *contact, const AABB *aabb, const Sphere *sphere);
-
-// function implementations
+#include "../../physics.h"
 
 void aabb_setFromCenterAndSize(AABB *aabb, const Vector3 *center, const Vector3 *size)
 {
@@ -318,5 +291,3 @@ void aabb_contactSphereSetData(ContactData *contact, const AABB *aabb, const Sph
     contact->normal = vector3_difference(&sphere->center, &contact->point);
     vector3_normalize(&contact->normal);
 }
-
-#endif
\ No newline at end of file
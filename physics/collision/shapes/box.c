@@ -1,25 +1,4 @@
-#ifndef BOX_H
-#define BOX_H
-
-// structures
-
-typedef struct
-{
-    Vector3 size;
-    Vector3 center;
-    Vector3 rotation;
-} Box;
-
-// function prototypes
-
-AABB box_getLocalAABB(const Box *box);
-
-bool box_contactSphere(const Box *box, const Sphere *sphere);
-void box_contactSphereSetData(ContactData *contact, const Box *box, const Sphere *sphere);
-
-void box_init(Box *box, Vector3 size, Vector3 center, Vector3 rotation, float scalar);
-
-// function implementations
+#include "../../physics.h"
 
 AABB box_getLocalAABB(const Box *box)
 {
@@ -73,5 +52,3 @@ void box_init(Box *box, Vector3 size, Vector3 center, Vector3 rotation, float sc
     box->center = vector3_returnScaled(&center, scalar);
     box->rotation = rotation;
 }
-
-#endif
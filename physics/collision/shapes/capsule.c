@@ -1,32 +1,4 @@
-#ifndef CAPSULE_H
-#define CAPSULE_H
-
-typedef struct
-{
-    Vector3 start;
-    Vector3 end;
-    float radius;
-    float length;
-} Capsule;
-
-// Function prototypes
-
-void capsule_setVertical(Capsule *capsule, const Vector3 *position);
-
-bool capsule_contactSphere(const Capsule *capsule, const Sphere *sphere);
-void capsule_contactSphereSetData(ContactData *contact, const Capsule *capsule, const Sphere *sphere);
-
-bool capsule_contactAABB(const Capsule *capsule, const AABB *aabb);
-void capsule_contactAABBSetData(ContactData *contact, const Capsule *capsule, const AABB *aabb);
-
-bool capsule_contactBox(const Capsule *capsule, const Box *box);
-void capsule_contactBoxSetData(ContactData *contact, const Capsule *capsule, const Box *box);
-
-bool capsule_contactPlane(const Capsule *capsule, const Plane *plane);
-
-bool capsule_intersectionRay(const Capsule *capsule, const Ray *ray);
-
-// Function implementations
+#include "../../physics.h"
 
 void capsule_setVertical(Capsule *capsule, const Vector3 *position)
 {
@@ -213,8 +185,3 @@ bool capsule_intersectsEdge(const Capsule *capsule, const Vector3 *edgeStart, co
     // Step 5: Check for intersection
     return distanceSquared <= combinedRadius * combinedRadius;
 }
-
-/*
- */
-
-#endif
\ No newline at end of file
@@ -1,23 +1,4 @@
-#ifndef PLANE_H
-#define PLANE_H
-
-// structures
-
-typedef struct
-{
-    Vector3 normal;     // Normal vector of the plane
-    float displacement; // Displacement from the origin along the normal
-} Plane;
-
-// function prototypes
-
-Vector3 plane_getNormalFromRotation(const Vector3 *rotation);
-float plane_getDisplacement(const Vector3 *normal, const Vector3 *point);
-void plane_setFromRotationAndPoint(Plane *plane, const Vector3 *rotation, const Vector3 *point);
-void plane_setFromNormalAndPoint(Plane *plane, const Vector3 *normal, const Vector3 *point);
-float plane_distanceToPoint(const Plane *plane, const Vector3 *point);
-
-// function implementations
+#include "../../physics.h"
 
 Vector3 plane_getNormalFromRotation(const Vector3 *rotation)
 {
@@ -72,5 +53,3 @@ void plane_contactSphereGetData(ContactData *contact, const Plane *plane, const
     Vector3 scaled_normal = vector3_returnScaled(&plane->normal, distance);
     contact->point = vector3_difference(&sphere->center, &scaled_normal);
 }
-
-#endif
@@ -1,29 +1,4 @@
-#ifndef RAY_H
-#define RAY_H
-
-// structures
-
-typedef struct
-{
-    Vector3 origin;
-    Vector3 direction;
-} Ray;
-
-// function prototypes
-
-Vector3 ray_getDirectionFromRotation(const Vector3 *rotation);
-void ray_setFromRotationAndPoint(Ray *ray, const Vector3 *origin, const Vector3 *rotation);
-
-bool ray_intersectionSphere(const Ray *ray, const Sphere *sphere);
-void raycast_sphere(ContactData *contact, const Ray *ray, const Sphere *sphere);
-
-bool ray_intersectionAABB(const Ray *ray, const AABB *aabb);
-void raycast_aabb(ContactData *contact, const Ray *ray, const AABB *aabb);
-
-bool ray_intersectionBox(const Ray *ray, const Box *box);
-void raycast_box(ContactData *contact, const Ray *ray, const Box *box);
-
-// function implementations
+#include "../../physics.h"
 
 Vector3 ray_getDirectionFromRotation(const Vector3 *rotation)
 {
@@ -286,5 +261,3 @@ void raycast_plane(ContactData *contact, const Ray *ray, const Plane *plane)
 
     contact->normal = plane->normal;
 }
-
-#endif
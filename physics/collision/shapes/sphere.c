@@ -1,16 +1,4 @@
-#ifndef SPHERE_H
-#define SPHERE_H
-
-// structures
-
-typedef struct
-{
-    Vector3 center;
-    float radius;
-} Sphere;
-
-bool sphere_contactSphere(const Sphere *s, const Sphere *t);
-void sphere_collisionTestSphere(ContactData *contact, const Sphere *s, const Sphere *t);
+#include "../../physics.h"
 
 bool sphere_contactSphere(const Sphere *s, const Sphere *t)
 {
@@ -34,5 +22,3 @@ void sphere_collisionTestSphere(ContactData *contact, const Sphere *s, const Sph
         t->center.y - contact->normal.y * t->radius,
         t->center.z - contact->normal.z * t->radius};
 }
-
-#endif
\ No newline at end of file
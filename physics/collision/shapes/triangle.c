@@ -1,24 +1,4 @@
-#ifndef TRIANGLE_H
-#define TRIANGLE_H
-
-typedef struct
-{
-    Vector3 start;
-    Vector3 end;
-} Edge;
-
-// Structure for a triangular plane
-typedef struct Triangle
-{
-    Vector3 vertA;
-    Vector3 vertB;
-    Vector3 vertC;
-    Vector3 normal;
-    Edge edge;
-} Triangle;
-
-void triangle_setVertices(Triangle *triangle, const Vector3 *vertexA, const Vector3 *vertexB, const Vector3 *vertexC);
-bool triangle_containsPoint(const Triangle *triangle, const Vector3 *point);
+#include "../../physics.h"
 
 // Sets up the triangle plane and computes its normal
 void triangle_setVertices(Triangle *triangle, const Vector3 *a, const Vector3 *b, const Vector3 *c)
@@ -70,5 +50,3 @@ void hex_init(Triangle *hexagon, Vector3 *center, Vector3 *vertices)
 
     hex_initEdges(&hexagon->edge, vertices);
 }
-
-#endif // TRIANGLE_H
@@ -0,0 +1,26 @@
+#ifndef TRIANGLE_H
+#define TRIANGLE_H
+
+typedef struct
+{
+    Vector3 start;
+    Vector3 end;
+} Edge;
+
+// Structure for a triangular plane
+typedef struct Triangle
+{
+    Vector3 vertA;
+    Vector3 vertB;
+    Vector3 vertC;
+    Vector3 normal;
+    Edge edge;
+} Triangle;
+
+void triangle_setVertices(Triangle *triangle, const Vector3 *vertexA, const Vector3 *vertexB, const Vector3 *vertexC);
+bool triangle_containsPoint(const Triangle *triangle, const Vector3 *point);
+
+void hex_initEdges(Edge *edges, Vector3 *vertices);
+void hex_init(Triangle *hexagon, Vector3 *center, Vector3 *vertices);
+
+#endif // TRIANGLE_H
@@ -3,44 +3,44 @@
 
 // function prototypes
 
-Vector3 vector3_multiplyByMatrix3x3(const Matrix3x3 *matrix, const Vector3 *vector);
-Vector3 vector3_rotateByQuaternion(const Vector3 *v, const Quaternion *q);
+static inline Vector3 vector3_multiplyByMatrix3x3(const Matrix3x3 *matrix, const Vector3 *vector);
+static inline Vector3 vector3_rotateByQuaternion(const Vector3 *v, const Quaternion *q);
 
-Vector3 vector3_transformToLocalSpace(const Vector3 *global_point, Vector3 local_center, Vector3 rotation);
-Vector3 vector3_transformToGlobalSpace(const Vector3 *local_point, Vector3 local_center, Vector3 rotation);
+static inline Vector3 vector3_transformToLocalSpace(const Vector3 *global_point, Vector3 local_center, Vector3 rotation);
+static inline Vector3 vector3_transformToGlobalSpace(const Vector3 *local_point, Vector3 local_center, Vector3 rotation);
 
-Vector3 vector3_reflect(const Vector3 *vector, const Vector3 *normal);
+static inline Vector3 vector3_reflect(const Vector3 *vector, const Vector3 *normal);
 
-Vector3 vector3_degToRad(const Vector3 *rotation);
-Vector3 vector3_clamp(const Vector3 *vector, float maxLength);
+static inline Vector3 vector3_degToRad(const Vector3 *rotation);
+static inline Vector3 vector3_clamp(const Vector3 *vector, float maxLength);
 
-bool vector3_areParallel(const Vector3 *vector1, const Vector3 *vector2);
-bool vector3_areOrthogonal(const Vector3 *vector1, const Vector3 *vector2);
+static inline bool vector3_areParallel(const Vector3 *vector1, const Vector3 *vector2);
+static inline bool vector3_areOrthogonal(const Vector3 *vector1, const Vector3 *vector2);
 
-void point_rotateZYX(Vector3 *point, const Vector3 *rotation);
-void point_rotateXYZ(Vector3 *point, const Vector3 *rotation);
-void point_transformToLocalSpace(Vector3 *global_point, const Vector3 *local_center, const Vector3 *local_rotation);
-void point_transformToGlobalSpace(Vector3 *local_point, const Vector3 *local_center, const Vector3 *local_rotation);
+static inline void point_rotateZYX(Vector3 *point, const Vector3 *rotation);
+static inline void point_rotateXYZ(Vector3 *point, const Vector3 *rotation);
+static inline void point_transformToLocalSpace(Vector3 *global_point, const Vector3 *local_center, const Vector3 *local_rotation);
+static inline void point_transformToGlobalSpace(Vector3 *local_point, const Vector3 *local_center, const Vector3 *local_rotation);
 
-Vector3 segment_closestToPoint(const Vector3 *seg_a, const Vector3 *seg_b, const Vector3 *point_c);
-void segment_closestPointsWithSegment(const Vector3 *seg1_a, const Vector3 *seg1_b, const Vector3 *seg2_a, const Vector3 *seg2_b, Vector3 *closest_seg1, Vector3 *closest_seg2);
-float segment_distanceToPoint(const Vector3 *a, const Vector3 *b, const Vector3 *p);
+static inline Vector3 segment_closestToPoint(const Vector3 *seg_a, const Vector3 *seg_b, const Vector3 *point_c);
+static inline void segment_closestPointsWithSegment(const Vector3 *seg1_a, const Vector3 *seg1_b, const Vector3 *seg2_a, const Vector3 *seg2_b, Vector3 *closest_seg1, Vector3 *closest_seg2);
+static inline float segment_distanceToPoint(const Vector3 *a, const Vector3 *b, const Vector3 *p);
 
-float line_distanceToPoint(const Vector3 *linePointA, const Vector3 *linePointB, const Vector3 *point);
+static inline float line_distanceToPoint(const Vector3 *linePointA, const Vector3 *linePointB, const Vector3 *point);
 
-float plane_intersectionWithSegment(const Vector3 *a, const Vector3 *b, float plane_displacement, const Vector3 *planeormal);
+static inline float plane_intersectionWithSegment(const Vector3 *a, const Vector3 *b, float plane_displacement, const Vector3 *planeormal);
 
-void triangle_getBarycentricCoordinates(const Vector3 *a, const Vector3 *b, const Vector3 *c, const Vector3 *p, float *u, float *v, float *w);
+static inline void triangle_getBarycentricCoordinates(const Vector3 *a, const Vector3 *b, const Vector3 *c, const Vector3 *p, float *u, float *v, float *w);
 
-Matrix3x3 rotationMatrix_getFromEuler(const Vector3 *rotation);
+static inline Matrix3x3 rotationMatrix_getFromEuler(const Vector3 *rotation);
 
-void rotate_normal(Vector3 *vector, const Vector3 *rotation);
+static inline void rotate_normal(Vector3 *vector, const Vector3 *rotation);
 
-Vector3 vector3_fromQuaternion(Quaternion q);
+static inline Vector3 vector3_fromQuaternion(Quaternion q);
 
 // function implementations
 
-inline Vector3 vector3_multiplyByMatrix3x3(const Matrix3x3 *matrix, const Vector3 *vector)
+static inline Vector3 vector3_multiplyByMatrix3x3(const Matrix3x3 *matrix, const Vector3 *vector)
 {
     return (Vector3){
         .x = matrix->row[0].x * vector->x + matrix->row[0].y * vector->y + matrix->row[0].z * vector->z,
@@ -48,7 +48,7 @@ inline Vector3 vector3_multiplyByMatrix3x3(const Matrix3x3 *matrix, const Vector
         .z = matrix->row[2].x * vector->x + matrix->row[2].y * vector->y + matrix->row[2].z * vector->z};
 }
 
-inline Vector3 vector3_rotateByQuaternion(const Vector3 *v, const Quaternion *q)
+static inline Vector3 vector3_rotateByQuaternion(const Vector3 *v, const Quaternion *q)
 {
     Vector3 u = {q->x, q->y, q->z};
     float s = q->w;
@@ -63,7 +63,7 @@ inline Vector3 vector3_rotateByQuaternion(const Vector3 *v, const Quaternion *q)
     return vector3_sum(&result, &rv3);
 }
 
-inline Vector3 vector3_transformToLocalSpace(const Vector3 *global_point, Vector3 local_center, Vector3 rotation)
+static inline Vector3 vector3_transformToLocalSpace(const Vector3 *global_point, Vector3 local_center, Vector3 rotation)
 {
     // Translate point by the inverse of Box's center
     Vector3 local_point = vector3_difference(global_point, &local_center);
@@ -75,7 +75,7 @@ inline Vector3 vector3_transformToLocalSpace(const Vector3 *global_point, Vector
     return local_point;
 }
 
-inline Vector3 vector3_transformToGlobalSpace(const Vector3 *local_point, Vector3 local_center, Vector3 rotation)
+static inline Vector3 vector3_transformToGlobalSpace(const Vector3 *local_point, Vector3 local_center, Vector3 rotation)
 {
     Vector3 global_point = *local_point;
     // Apply rotation to the local point to get it in the global space orientation
@@ -87,7 +87,7 @@ inline Vector3 vector3_transformToGlobalSpace(const Vector3 *local_point, Vector
     return global_point;
 }
 
-inline Vector3 vector3_degToRad(const Vector3 *rotation)
+static inline Vector3 vector3_degToRad(const Vector3 *rotation)
 {
     Vector3 result;
     result.x = rad(rotation->x);
@@ -96,7 +96,7 @@ inline Vector3 vector3_degToRad(const Vector3 *rotation)
     return result;
 }
 
-inline bool vector3_areParallel(const Vector3 *vector1, const Vector3 *vector2)
+static inline bool vector3_areParallel(const Vector3 *vector1, const Vector3 *vector2)
 {
     Vector3 crossProduct = {
         vector1->y * vector2->z - vector1->z * vector2->y,
@@ -105,14 +105,14 @@ inline bool vector3_areParallel(const Vector3 *vector1, const Vector3 *vector2)
     return (crossProduct.x * crossProduct.x + crossProduct.y * crossProduct.y + crossProduct.z * crossProduct.z) < 0.00001f;
 }
 
-inline bool vector3_areOrthogonal(const Vector3 *vector1, const Vector3 *vector2)
+static inline bool vector3_areOrthogonal(const Vector3 *vector1, const Vector3 *vector2)
 {
     float dotProduct = vector1->x * vector2->x + vector1->y * vector2->y + vector1->z * vector2->z;
     return fabsf(dotProduct) < 0.001f;
 }
 
 /* clamp a vector to a maximum length */
-inline Vector3 vector3_clamp(const Vector3 *vector, float maxLength)
+static inline Vector3 vector3_clamp(const Vector3 *vector, float maxLength)
 {
     float lengthSquare = vector->x * vector->x + vector->y * vector->y + vector->z * vector->z;
     if (lengthSquare > maxLength * maxLength)
@@ -123,14 +123,14 @@ inline Vector3 vector3_clamp(const Vector3 *vector, float maxLength)
     return *vector;
 }
 
-inline Vector3 vector3_reflect(const Vector3 *vector, const Vector3 *normal)
+static inline Vector3 vector3_reflect(const Vector3 *vector, const Vector3 *normal)
 {
     Vector3 scaled_normal = vector3_returnScaled(normal, vector3_returnDotProduct(vector, normal) * 2.0f);
     return vector3_difference(vector, &scaled_normal);
 }
 
 /* compute and return a point on segment from "seg_a" and "seg_b" that is closest to point "point_c" */
-inline Vector3 segment_closestToPoint(const Vector3 *seg_a, const Vector3 *seg_b, const Vector3 *point_c)
+static inline Vector3 segment_closestToPoint(const Vector3 *seg_a, const Vector3 *seg_b, const Vector3 *point_c)
 {
     Vector3 ab = {seg_b->x - seg_a->x, seg_b->y - seg_a->y, seg_b->z - seg_a->z};
     Vector3 ac = {point_c->x - seg_a->x, point_c->y - seg_a->y, point_c->z - seg_a->z};
@@ -158,7 +158,7 @@ inline Vector3 segment_closestToPoint(const Vector3 *seg_a, const Vector3 *seg_b
 
 /* segment_closestPointInBetween
 compute the closest points between two segments */
-inline void segment_closestPointsWithSegment(const Vector3 *seg1_a, const Vector3 *seg1_b,
+static inline void segment_closestPointsWithSegment(const Vector3 *seg1_a, const Vector3 *seg1_b,
                                              const Vector3 *seg2_a, const Vector3 *seg2_b,
                                              Vector3 *closest_seg1, Vector3 *closest_seg2)
 {
@@ -235,7 +235,7 @@ inline void segment_closestPointsWithSegment(const Vector3 *seg1_a, const Vector
 
 /* triangle_getBarycentricCoordinates
 compute the barycentric coordinates u, v, w of a point p inside the triangle (a, b, c) */
-inline void triangle_getBarycentricCoordinates(const Vector3 *a, const Vector3 *b, const Vector3 *c,
+static inline void triangle_getBarycentricCoordinates(const Vector3 *a, const Vector3 *b, const Vector3 *c,
                                                const Vector3 *p, float *u, float *v, float *w)
 {
     Vector3 v0 = {b->x - a->x, b->y - a->y, b->z - a->z};
@@ -256,7 +256,7 @@ inline void triangle_getBarycentricCoordinates(const Vector3 *a, const Vector3 *
 
 /* plane_intersectionWithSegment
 compute the intersection between a plane and a segment */
-inline float plane_intersectionWithSegment(const Vector3 *a, const Vector3 *b, float plane_displacement, const Vector3 *planeormal)
+static inline float plane_intersectionWithSegment(const Vector3 *a, const Vector3 *b, float plane_displacement, const Vector3 *planeormal)
 {
     const float parallelEpsilon = 0.0001f;
     float t = -1.0f;
@@ -275,7 +275,7 @@ inline float plane_intersectionWithSegment(const Vector3 *a, const Vector3 *b, f
 
 /* line_distanceToPoint
 compute the distance between a point "point" and a line given by the points "linePointA" and "linePointB" */
-inline float line_distanceToPoint(const Vector3 *linePointA, const Vector3 *linePointB, const Vector3 *point)
+static inline float line_distanceToPoint(const Vector3 *linePointA, const Vector3 *linePointB, const Vector3 *point)
 {
     float distAB = sqrt((linePointB->x - linePointA->x) * (linePointB->x - linePointA->x) +
                         (linePointB->y - linePointA->y) * (linePointB->y - linePointA->y) +
@@ -297,7 +297,7 @@ inline float line_distanceToPoint(const Vector3 *linePointA, const Vector3 *line
     return crossLength / distAB;
 }
 
-inline float segment_distanceToPoint(const Vector3 *a, const Vector3 *b, const Vector3 *p)
+static inline float segment_distanceToPoint(const Vector3 *a, const Vector3 *b, const Vector3 *p)
 {
     // Calculate the vector from a to b and from a to p
     Vector3 ab = vector3_difference(b, a);
@@ -316,7 +316,7 @@ inline float segment_distanceToPoint(const Vector3 *a, const Vector3 *b, const V
     return vector3_magnitude(&diff);
 }
 
-Matrix3x3 rotationMatrix_getFromEuler(const Vector3 *rotation)
+static inline Matrix3x3 rotationMatrix_getFromEuler(const Vector3 *rotation)
 {
     float rad_x = rad(rotation->x);
     float cos_rad_x = fm_cosf(rad_x);
@@ -362,7 +362,7 @@ Matrix3x3 rotationMatrix_getFromEuler(const Vector3 *rotation)
 //
 // as with the rotation matrix algorithm, this does not work when the point lays on any axis
 // for that you must use a quaternion rotation
-void point_rotateZYX(Vector3 *point, const Vector3 *rotation)
+static inline void point_rotateZYX(Vector3 *point, const Vector3 *rotation)
 {
     float rad_x = rad(rotation->x);
     float cos_rad_x = fm_cosf(rad_x);
@@ -390,7 +390,7 @@ void point_rotateZYX(Vector3 *point, const Vector3 *rotation)
     point->x = xY;
 }
 
-void point_rotateXYZ(Vector3 *point, const Vector3 *rotation)
+static inline void point_rotateXYZ(Vector3 *point, const Vector3 *rotation)
 {
     float rad_x = rad(rotation->x);
     float cos_rad_x = fm_cosf(rad_x);
@@ -421,7 +421,7 @@ void point_rotateXYZ(Vector3 *point, const Vector3 *rotation)
     point->z = zY;
 }
 
-void point_transformToLocalSpace(Vector3 *global_point, const Vector3 *local_center, const Vector3 *local_rotation)
+static inline void point_transformToLocalSpace(Vector3 *global_point, const Vector3 *local_center, const Vector3 *local_rotation)
 {
     // Translate point by the inverse of Box's center
     vector3_subtract(global_point, local_center);
@@ -431,7 +431,7 @@ void point_transformToLocalSpace(Vector3 *global_point, const Vector3 *local_cen
     point_rotateZYX(global_point, &inverse_rotation);
 }
 
-void point_transformToGlobalSpace(Vector3 *local_point, const Vector3 *local_center, const Vector3 *local_rotation)
+static inline void point_transformToGlobalSpace(Vector3 *local_point, const Vector3 *local_center, const Vector3 *local_rotation)
 {
     // Apply rotation to the local point to get it in the global space orientation
     Vector3 inverse_rotation = vector3_getInverse(local_rotation);
@@ -442,21 +442,21 @@ void point_transformToGlobalSpace(Vector3 *local_point, const Vector3 *local_cen
 }
 
 // another very convenient and very difficult to figure out algorithm
-void rotate_normal(Vector3 *vector, const Vector3 *rotation)
+static inline void rotate_normal(Vector3 *vector, const Vector3 *rotation)
 {
     Vector3 rad_rotation = vector3_degToRad(rotation);
     Quaternion q_rotation = quaternion_getFromVector(&rad_rotation);
     *vector = vector3_rotateByQuaternion(vector, &q_rotation);
 }
 
-void rotate_vector(Vector3 *vector, const Vector3 *rotation)
+static inline void rotate_vector(Vector3 *vector, const Vector3 *rotation)
 {
     Vector3 rad_rotation = vector3_degToRad(rotation);
     Quaternion q_rotation = quaternion_getFromVector(&rad_rotation);
     *vector = vector3_rotateByQuaternion(vector, &q_rotation);
 }
 
-inline Vector3 vector3_fromQuaternion(Quaternion q)
+static inline Vector3 vector3_fromQuaternion(Quaternion q)
 {
     Vector3 euler;
 
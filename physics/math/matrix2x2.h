@@ -13,56 +13,56 @@ typedef struct
 } Matrix2x2;
 
 // Function prototypes
-void matrix2x2_init(Matrix2x2 *matrix);
-void matrix2x2_clear(Matrix2x2 *matrix);
+static inline void matrix2x2_init(Matrix2x2 *matrix);
+static inline void matrix2x2_clear(Matrix2x2 *matrix);
 
-void matrix2x2_set(Matrix2x2 *matrix, float a1, float a2, float b1, float b2);
-void matrix2x2_setWithValue(Matrix2x2 *matrix, float value);
+static inline void matrix2x2_set(Matrix2x2 *matrix, float a1, float a2, float b1, float b2);
+static inline void matrix2x2_setWithValue(Matrix2x2 *matrix, float value);
 
-Vector2 matrix2x2_returnColumn(const Matrix2x2 *matrix, int i);
-Vector2 matrix2x2_returnRow(const Matrix2x2 *matrix, int i);
+static inline Vector2 matrix2x2_returnColumn(const Matrix2x2 *matrix, int i);
+static inline Vector2 matrix2x2_returnRow(const Matrix2x2 *matrix, int i);
 
-Matrix2x2 matrix2x2_sum(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
-void matrix2x2_add(Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
+static inline Matrix2x2 matrix2x2_sum(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
+static inline void matrix2x2_add(Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
 
-Matrix2x2 matrix2x2_difference(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
-void matrix2x2_subtract(Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
+static inline Matrix2x2 matrix2x2_difference(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
+static inline void matrix2x2_subtract(Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
 
-Matrix2x2 matrix2x2_returnScaled(const Matrix2x2 *matrix, float scalar);
-void matrix2x2_scale(Matrix2x2 *matrix, float scalar);
+static inline Matrix2x2 matrix2x2_returnScaled(const Matrix2x2 *matrix, float scalar);
+static inline void matrix2x2_scale(Matrix2x2 *matrix, float scalar);
 
-Matrix2x2 matrix2x2_returnProduct(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
-Vector2 matrix2x2_returnProductByVector(const Matrix2x2 *matrix, const Vector2 *vector);
+static inline Matrix2x2 matrix2x2_returnProduct(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
+static inline Vector2 matrix2x2_returnProductByVector(const Matrix2x2 *matrix, const Vector2 *vector);
 
-Matrix2x2 matrix2x2_returnNegative(const Matrix2x2 *matrix);
-Matrix2x2 matrix2x2_returnTranspose(const Matrix2x2 *matrix);
-float matrix2x2_returnDeterminant(const Matrix2x2 *matrix);
-float matrix2x2_returnTrace(const Matrix2x2 *matrix);
-Matrix2x2 matrix2x2_returnInverse(const Matrix2x2 *matrix);
-Matrix2x2 matrix2x2_returnAbsoluteMatrix(const Matrix2x2 *matrix);
+static inline Matrix2x2 matrix2x2_returnNegative(const Matrix2x2 *matrix);
+static inline Matrix2x2 matrix2x2_returnTranspose(const Matrix2x2 *matrix);
+static inline float matrix2x2_returnDeterminant(const Matrix2x2 *matrix);
+static inline float matrix2x2_returnTrace(const Matrix2x2 *matrix);
+static inline Matrix2x2 matrix2x2_returnInverse(const Matrix2x2 *matrix);
+static inline Matrix2x2 matrix2x2_returnAbsoluteMatrix(const Matrix2x2 *matrix);
 
-void matrix2x2_setIdentity(Matrix2x2 *matrix);
-Matrix2x2 matrix2x2_returnIdentity();
+static inline void matrix2x2_setIdentity(Matrix2x2 *matrix);
+static inline Matrix2x2 matrix2x2_returnIdentity();
 
-int matrix2x2_equals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
-int matrix2x2_notEquals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
+static inline int matrix2x2_equals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
+static inline int matrix2x2_notEquals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2);
 
 // Implementations
 
 /* Initializes all values in the matrix to zero. */
-void matrix2x2_init(Matrix2x2 *matrix)
+static inline void matrix2x2_init(Matrix2x2 *matrix)
 {
     matrix2x2_set(matrix, 0.0f, 0.0f, 0.0f, 0.0f);
 }
 
 /* Initializes the matrix with a given value. */
-void matrix2x2_setWithValue(Matrix2x2 *matrix, float value)
+static inline void matrix2x2_setWithValue(Matrix2x2 *matrix, float value)
 {
     matrix2x2_set(matrix, value, value, value, value);
 }
 
 /* Sets all values in the matrix. */
-void matrix2x2_set(Matrix2x2 *matrix, float a1, float a2, float b1, float b2)
+static inline void matrix2x2_set(Matrix2x2 *matrix, float a1, float a2, float b1, float b2)
 {
     matrix->row[0].x = a1;
     matrix->row[0].y = a2;
@@ -71,27 +71,27 @@ void matrix2x2_set(Matrix2x2 *matrix, float a1, float a2, float b1, float b2)
 }
 
 /* Sets the matrix to zero. */
-void matrix2x2_clear(Matrix2x2 *matrix)
+static inline void matrix2x2_clear(Matrix2x2 *matrix)
 {
     matrix2x2_set(matrix, 0.0f, 0.0f, 0.0f, 0.0f);
 }
 
 /* Returns a column of the matrix. */
-Vector2 matrix2x2_returnColumn(const Matrix2x2 *matrix, int i)
+static inline Vector2 matrix2x2_returnColumn(const Matrix2x2 *matrix, int i)
 {
     assert(i >= 0 && i < 2);
     return (Vector2){matrix->row[0].x, matrix->row[1].x};
 }
 
 /* Returns a row of the matrix. */
-Vector2 matrix2x2_returnRow(const Matrix2x2 *matrix, int i)
+static inline Vector2 matrix2x2_returnRow(const Matrix2x2 *matrix, int i)
 {
     assert(i >= 0 && i < 2);
     return matrix->row[i];
 }
 
 /* Returns the transpose of the matrix. */
-Matrix2x2 matrix2x2_returnTranspose(const Matrix2x2 *matrix)
+static inline Matrix2x2 matrix2x2_returnTranspose(const Matrix2x2 *matrix)
 {
     return (Matrix2x2){
         .row = {
@@ -100,25 +100,25 @@ Matrix2x2 matrix2x2_returnTranspose(const Matrix2x2 *matrix)
 }
 
 /* Returns the determinant of the matrix. */
-float matrix2x2_returnDeterminant(const Matrix2x2 *matrix)
+static inline float matrix2x2_returnDeterminant(const Matrix2x2 *matrix)
 {
     return matrix->row[0].x * matrix->row[1].y - matrix->row[1].x * matrix->row[0].y;
 }
 
 /* Returns the trace of the matrix. */
-float matrix2x2_returnTrace(const Matrix2x2 *matrix)
+static inline float matrix2x2_returnTrace(const Matrix2x2 *matrix)
 {
     return matrix->row[0].x + matrix->row[1].y;
 }
 
 /* Sets the matrix to the identity matrix. */
-void matrix2x2_setIdentity(Matrix2x2 *matrix)
+static inline void matrix2x2_setIdentity(Matrix2x2 *matrix)
 {
     matrix2x2_set(matrix, 1.0f, 0.0f, 0.0f, 1.0f);
 }
 
 /* Returns the 2x2 identity matrix. */
-Matrix2x2 matrix2x2_returnIdentity()
+static inline Matrix2x2 matrix2x2_returnIdentity()
 {
     Matrix2x2 identityMatrix;
     matrix2x2_setIdentity(&identityMatrix);
@@ -126,7 +126,7 @@ Matrix2x2 matrix2x2_returnIdentity()
 }
 
 /* Returns the 2x2 zero matrix. */
-Matrix2x2 matrix2x2_zero()
+static inline Matrix2x2 matrix2x2_zero()
 {
     Matrix2x2 zeroMatrix;
     matrix2x2_clear(&zeroMatrix);
@@ -134,7 +134,7 @@ Matrix2x2 matrix2x2_zero()
 }
 
 /* Returns the inverse of the matrix. */
-Matrix2x2 matrix2x2_returnInverse(const Matrix2x2 *matrix)
+static inline Matrix2x2 matrix2x2_returnInverse(const Matrix2x2 *matrix)
 {
     float determinant = matrix2x2_returnDeterminant(matrix);
     assert(determinant > FLT_EPSILON);
@@ -148,7 +148,7 @@ Matrix2x2 matrix2x2_returnInverse(const Matrix2x2 *matrix)
 }
 
 /* Returns the matrix with absolute values. */
-Matrix2x2 matrix2x2_returnAbsoluteMatrix(const Matrix2x2 *matrix)
+static inline Matrix2x2 matrix2x2_returnAbsoluteMatrix(const Matrix2x2 *matrix)
 {
     return (Matrix2x2){
         .row = {
@@ -157,7 +157,7 @@ Matrix2x2 matrix2x2_returnAbsoluteMatrix(const Matrix2x2 *matrix)
 }
 
 /* Adds two matrices. */
-Matrix2x2 matrix2x2_sum(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
+static inline Matrix2x2 matrix2x2_sum(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 {
     return (Matrix2x2){
         .row = {
@@ -166,7 +166,7 @@ Matrix2x2 matrix2x2_sum(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 }
 
 /* Subtracts matrix2 from matrix1. */
-Matrix2x2 matrix2x2_difference(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
+static inline Matrix2x2 matrix2x2_difference(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 {
     return (Matrix2x2){
         .row = {
@@ -175,7 +175,7 @@ Matrix2x2 matrix2x2_difference(const Matrix2x2 *matrix1, const Matrix2x2 *matrix
 }
 
 /* Returns the negative of the matrix. */
-Matrix2x2 matrix2x2_returnNegative(const Matrix2x2 *matrix)
+static inline Matrix2x2 matrix2x2_returnNegative(const Matrix2x2 *matrix)
 {
     return (Matrix2x2){
         .row = {
@@ -184,7 +184,7 @@ Matrix2x2 matrix2x2_returnNegative(const Matrix2x2 *matrix)
 }
 
 /* Multiplies the matrix by a scalar. */
-Matrix2x2 matrix2x2_returnScaled(const Matrix2x2 *matrix, float scalar)
+static inline Matrix2x2 matrix2x2_returnScaled(const Matrix2x2 *matrix, float scalar)
 {
     return (Matrix2x2){
         .row = {
@@ -193,7 +193,7 @@ Matrix2x2 matrix2x2_returnScaled(const Matrix2x2 *matrix, float scalar)
 }
 
 /* Multiplies two matrices. */
-Matrix2x2 matrix2x2_returnProduct(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
+static inline Matrix2x2 matrix2x2_returnProduct(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 {
     return (Matrix2x2){
         .row = {
@@ -204,7 +204,7 @@ Matrix2x2 matrix2x2_returnProduct(const Matrix2x2 *matrix1, const Matrix2x2 *mat
 }
 
 /* Multiplies the matrix by a vector. */
-Vector2 matrix2x2_returnProductByVector(const Matrix2x2 *matrix, const Vector2 *vector)
+static inline Vector2 matrix2x2_returnProductByVector(const Matrix2x2 *matrix, const Vector2 *vector)
 {
     return (Vector2){
         .x = matrix->row[0].x * vector->x + matrix->row[0].y * vector->y,
@@ -212,20 +212,20 @@ Vector2 matrix2x2_returnProductByVector(const Matrix2x2 *matrix, const Vector2 *
 }
 
 /* Checks if two matrices are equal. */
-int matrix2x2_equals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
+static inline int matrix2x2_equals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 {
     return (matrix1->row[0].x == matrix2->row[0].x && matrix1->row[0].y == matrix2->row[0].y &&
             matrix1->row[1].x == matrix2->row[1].x && matrix1->row[1].y == matrix2->row[1].y);
 }
 
 /* Checks if two matrices are not equal. */
-int matrix2x2_notEquals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
+static inline int matrix2x2_notEquals(const Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 {
     return !matrix2x2_equals(matrix1, matrix2);
 }
 
 /* Adds matrix2 to matrix1 and assigns the result to matrix1. */
-void matrix2x2_add(Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
+static inline void matrix2x2_add(Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 {
     matrix1->row[0].x += matrix2->row[0].x;
     matrix1->row[0].y += matrix2->row[0].y;
@@ -234,7 +234,7 @@ void matrix2x2_add(Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 }
 
 /* Subtracts matrix2 from matrix1 and assigns the result to matrix1. */
-void matrix2x2_subtract(Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
+static inline void matrix2x2_subtract(Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 {
     matrix1->row[0].x -= matrix2->row[0].x;
     matrix1->row[0].y -= matrix2->row[0].y;
@@ -243,7 +243,7 @@ void matrix2x2_subtract(Matrix2x2 *matrix1, const Matrix2x2 *matrix2)
 }
 
 /* Multiplies matrix1 by a scalar and assigns the result to matrix1. */
-void matrix2x2_scale(Matrix2x2 *matrix, float scalar)
+static inline void matrix2x2_scale(Matrix2x2 *matrix, float scalar)
 {
     matrix->row[0].x *= scalar;
     matrix->row[0].y *= scalar;
@@ -15,58 +15,58 @@ typedef struct
 } Matrix3x3;
 
 // Function prototypes
-void matrix3x3_init(Matrix3x3 *matrix);
-void matrix3x3_clear(Matrix3x3 *matrix);
+static inline void matrix3x3_init(Matrix3x3 *matrix);
+static inline void matrix3x3_clear(Matrix3x3 *matrix);
 
-void matrix3x3_set(Matrix3x3 *matrix, float a1, float a2, float a3, float b1, float b2, float b3, float c1, float c2, float c3);
-void matrix3x3_setWithValue(Matrix3x3 *matrix, float value);
+static inline void matrix3x3_set(Matrix3x3 *matrix, float a1, float a2, float a3, float b1, float b2, float b3, float c1, float c2, float c3);
+static inline void matrix3x3_setWithValue(Matrix3x3 *matrix, float value);
 
-Vector3 matrix3x3_returnColumn(const Matrix3x3 *matrix, int i);
-Vector3 matrix3x3_returnRow(const Matrix3x3 *matrix, int i);
+static inline Vector3 matrix3x3_returnColumn(const Matrix3x3 *matrix, int i);
+static inline Vector3 matrix3x3_returnRow(const Matrix3x3 *matrix, int i);
 
-void matrix3x3_add(Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
-Matrix3x3 matrix3x3_sum(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
+static inline void matrix3x3_add(Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
+static inline Matrix3x3 matrix3x3_sum(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
 
-void matrix3x3_subtract(Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
-Matrix3x3 matrix3x3_difference(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
+static inline void matrix3x3_subtract(Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
+static inline Matrix3x3 matrix3x3_difference(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
 
-Matrix3x3 matrix3x3_returnScaled(const Matrix3x3 *matrix, float scalar);
-void matrix3x3_scale(Matrix3x3 *matrix, float scalar);
+static inline Matrix3x3 matrix3x3_returnScaled(const Matrix3x3 *matrix, float scalar);
+static inline void matrix3x3_scale(Matrix3x3 *matrix, float scalar);
 
-Matrix3x3 matrix3x3_multiply(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
-Vector3 matrix3x3_multiplyByVector(const Matrix3x3 *matrix, const Vector3 *vector);
+static inline Matrix3x3 matrix3x3_multiply(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
+static inline Vector3 matrix3x3_multiplyByVector(const Matrix3x3 *matrix, const Vector3 *vector);
 
-Matrix3x3 matrix3x3_returnNegative(const Matrix3x3 *matrix);
-Matrix3x3 matrix3x3_returnTranspose(const Matrix3x3 *matrix);
-float matrix3x3_returnDeterminant(const Matrix3x3 *matrix);
-float matrix3x3_returnTrace(const Matrix3x3 *matrix);
-Matrix3x3 matrix3x3_returnInverse(const Matrix3x3 *matrix);
-Matrix3x3 matrix3x3_returnAbsoluteMatrix(const Matrix3x3 *matrix);
+static inline Matrix3x3 matrix3x3_returnNegative(const Matrix3x3 *matrix);
+static inline Matrix3x3 matrix3x3_returnTranspose(const Matrix3x3 *matrix);
+static inline float matrix3x3_returnDeterminant(const Matrix3x3 *matrix);
+static inline float matrix3x3_returnTrace(const Matrix3x3 *matrix);
+static inline Matrix3x3 matrix3x3_returnInverse(const Matrix3x3 *matrix);
+static inline Matrix3x3 matrix3x3_returnAbsoluteMatrix(const Matrix3x3 *matrix);
 
-void matrix3x3_setIdentity(Matrix3x3 *matrix);
-Matrix3x3 matrix3x3_returnIdentity();
+static inline void matrix3x3_setIdentity(Matrix3x3 *matrix);
+static inline Matrix3x3 matrix3x3_returnIdentity();
 
-Matrix3x3 matrix3x3_computeSkewSymmetricMatrixForCrossProduct(const Vector3 *vector);
+static inline Matrix3x3 matrix3x3_computeSkewSymmetricMatrixForCrossProduct(const Vector3 *vector);
 
-int matrix3x3_equals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
-int matrix3x3_notEquals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
+static inline int matrix3x3_equals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
+static inline int matrix3x3_notEquals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2);
 
 // Implementations
 
 /* Initializes the matrix to zero. */
-void matrix3x3_init(Matrix3x3 *matrix)
+static inline void matrix3x3_init(Matrix3x3 *matrix)
 {
     matrix3x3_set(matrix, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
 }
 
 /* Initializes the matrix with a given value. */
-void matrix3x3_setWithValue(Matrix3x3 *matrix, float value)
+static inline void matrix3x3_setWithValue(Matrix3x3 *matrix, float value)
 {
     matrix3x3_set(matrix, value, value, value, value, value, value, value, value, value);
 }
 
 /* Sets all values in the matrix. */
-void matrix3x3_set(Matrix3x3 *matrix, float a1, float a2, float a3,
+static inline void matrix3x3_set(Matrix3x3 *matrix, float a1, float a2, float a3,
                    float b1, float b2, float b3, float c1, float c2, float c3)
 {
     matrix->row[0].x = a1;
@@ -81,7 +81,7 @@ void matrix3x3_set(Matrix3x3 *matrix, float a1, float a2, float a3,
 }
 
 /* Sets the matrix to zero. */
-void matrix3x3_clear(Matrix3x3 *matrix)
+static inline void matrix3x3_clear(Matrix3x3 *matrix)
 {
     vector3_set(&matrix->row[0], 0.0f, 0.0f, 0.0f);
     vector3_set(&matrix->row[1], 0.0f, 0.0f, 0.0f);
@@ -89,21 +89,21 @@ void matrix3x3_clear(Matrix3x3 *matrix)
 }
 
 /* Returns a column of the matrix. */
-Vector3 matrix3x3_returnColumn(const Matrix3x3 *matrix, int i)
+static inline Vector3 matrix3x3_returnColumn(const Matrix3x3 *matrix, int i)
 {
     assert(i >= 0 && i < 3);
     return (Vector3){matrix->row[0].x, matrix->row[1].x, matrix->row[2].x};
 }
 
 /* Returns a row of the matrix. */
-Vector3 matrix3x3_returnRow(const Matrix3x3 *matrix, int i)
+static inline Vector3 matrix3x3_returnRow(const Matrix3x3 *matrix, int i)
 {
     assert(i >= 0 && i < 3);
     return matrix->row[i];
 }
 
 /* Returns the transpose of the matrix. */
-Matrix3x3 matrix3x3_returnTranspose(const Matrix3x3 *matrix)
+static inline Matrix3x3 matrix3x3_returnTranspose(const Matrix3x3 *matrix)
 {
     return (Matrix3x3){
         .row = {
@@ -113,7 +113,7 @@ Matrix3x3 matrix3x3_returnTranspose(const Matrix3x3 *matrix)
 }
 
 /* Returns the determinant of the matrix. */
-float matrix3x3_returnDeterminant(const Matrix3x3 *matrix)
+static inline float matrix3x3_returnDeterminant(const Matrix3x3 *matrix)
 {
     return (matrix->row[0].x * (matrix->row[1].y * matrix->row[2].z - matrix->row[2].y * matrix->row[1].z) -
             matrix->row[0].y * (matrix->row[1].x * matrix->row[2].z - matrix->row[2].x * matrix->row[1].z) +
@@ -121,13 +121,13 @@ float matrix3x3_returnDeterminant(const Matrix3x3 *matrix)
 }
 
 /* Returns the trace of the matrix. */
-float matrix3x3_returnTrace(const Matrix3x3 *matrix)
+static inline float matrix3x3_returnTrace(const Matrix3x3 *matrix)
 {
     return (matrix->row[0].x + matrix->row[1].y + matrix->row[2].z);
 }
 
 /* Returns the inverse of the matrix. */
-Matrix3x3 matrix3x3_returnInverse(const Matrix3x3 *matrix)
+static inline Matrix3x3 matrix3x3_returnInverse(const Matrix3x3 *matrix)
 {
     float determinant = matrix3x3_returnDeterminant(matrix);
     // Check if the determinant is equal to zero
@@ -152,7 +152,7 @@ Matrix3x3 matrix3x3_returnInverse(const Matrix3x3 *matrix)
 }
 
 /* Returns the matrix with absolute values. */
-Matrix3x3 matrix3x3_returnAbsoluteMatrix(const Matrix3x3 *matrix)
+static inline Matrix3x3 matrix3x3_returnAbsoluteMatrix(const Matrix3x3 *matrix)
 {
     return (Matrix3x3){
         .row = {
@@ -162,13 +162,13 @@ Matrix3x3 matrix3x3_returnAbsoluteMatrix(const Matrix3x3 *matrix)
 }
 
 /* Sets the matrix to the identity matrix. */
-void matrix3x3_setIdentity(Matrix3x3 *matrix)
+static inline void matrix3x3_setIdentity(Matrix3x3 *matrix)
 {
     matrix3x3_set(matrix, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f);
 }
 
 /* Returns the 3x3 identity matrix. */
-Matrix3x3 matrix3x3_returnIdentity()
+static inline Matrix3x3 matrix3x3_returnIdentity()
 {
     Matrix3x3 identityMatrix;
     matrix3x3_setIdentity(&identityMatrix);
@@ -176,7 +176,7 @@ Matrix3x3 matrix3x3_returnIdentity()
 }
 
 /* Returns a skew-symmetric matrix for cross product. */
-Matrix3x3 matrix3x3_computeSkewSymmetricMatrixForCrossProduct(const Vector3 *vector)
+static inline Matrix3x3 matrix3x3_computeSkewSymmetricMatrixForCrossProduct(const Vector3 *vector)
 {
     return (Matrix3x3){
         .row = {
@@ -186,7 +186,7 @@ Matrix3x3 matrix3x3_computeSkewSymmetricMatrixForCrossProduct(const Vector3 *vec
 }
 
 /* Adds two matrices. */
-Matrix3x3 matrix3x3_sum(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
+static inline Matrix3x3 matrix3x3_sum(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 {
     return (Matrix3x3){
         .row = {
@@ -196,7 +196,7 @@ Matrix3x3 matrix3x3_sum(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 }
 
 /* Subtracts matrix2 from matrix1. */
-Matrix3x3 matrix3x3_difference(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
+static inline Matrix3x3 matrix3x3_difference(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 {
     return (Matrix3x3){
         .row = {
@@ -206,7 +206,7 @@ Matrix3x3 matrix3x3_difference(const Matrix3x3 *matrix1, const Matrix3x3 *matrix
 }
 
 /* Returns the negative of the matrix. */
-Matrix3x3 matrix3x3_returnNegative(const Matrix3x3 *matrix)
+static inline Matrix3x3 matrix3x3_returnNegative(const Matrix3x3 *matrix)
 {
     return (Matrix3x3){
         .row = {
@@ -216,7 +216,7 @@ Matrix3x3 matrix3x3_returnNegative(const Matrix3x3 *matrix)
 }
 
 /* Multiplies the matrix by a scalar. */
-Matrix3x3 matrix3x3_returnScaled(const Matrix3x3 *matrix, float scalar)
+static inline Matrix3x3 matrix3x3_returnScaled(const Matrix3x3 *matrix, float scalar)
 {
     return (Matrix3x3){
         .row = {
@@ -226,7 +226,7 @@ Matrix3x3 matrix3x3_returnScaled(const Matrix3x3 *matrix, float scalar)
 }
 
 /* Multiplies two matrices. */
-Matrix3x3 matrix3x3_multiply(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
+static inline Matrix3x3 matrix3x3_multiply(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 {
     Matrix3x3 result;
     result.row[0].x = matrix1->row[0].x * matrix2->row[0].x + matrix1->row[0].y * matrix2->row[1].x + matrix1->row[0].z * matrix2->row[2].x;
@@ -245,7 +245,7 @@ Matrix3x3 matrix3x3_multiply(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 }
 
 /* Multiplies the matrix by a vector. */
-Vector3 matrix3x3_multiplyByVector(const Matrix3x3 *matrix, const Vector3 *vector)
+static inline Vector3 matrix3x3_multiplyByVector(const Matrix3x3 *matrix, const Vector3 *vector)
 {
     return (Vector3){
         .x = matrix->row[0].x * vector->x + matrix->row[0].y * vector->y + matrix->row[0].z * vector->z,
@@ -254,7 +254,7 @@ Vector3 matrix3x3_multiplyByVector(const Matrix3x3 *matrix, const Vector3 *vecto
 }
 
 /* Checks if two matrices are equal. */
-int matrix3x3_equals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
+static inline int matrix3x3_equals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 {
     return (matrix1->row[0].x == matrix2->row[0].x && matrix1->row[0].y == matrix2->row[0].y && matrix1->row[0].z == matrix2->row[0].z &&
             matrix1->row[1].x == matrix2->row[1].x && matrix1->row[1].y == matrix2->row[1].y && matrix1->row[1].z == matrix2->row[1].z &&
@@ -262,13 +262,13 @@ int matrix3x3_equals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 }
 
 /* Checks if two matrices are not equal. */
-int matrix3x3_notEquals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
+static inline int matrix3x3_notEquals(const Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 {
     return !matrix3x3_equals(matrix1, matrix2);
 }
 
 /* Adds matrix2 to matrix1 and assigns the result to matrix1. */
-void matrix3x3_add(Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
+static inline void matrix3x3_add(Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 {
     matrix1->row[0].x += matrix2->row[0].x;
     matrix1->row[0].y += matrix2->row[0].y;
@@ -282,7 +282,7 @@ void matrix3x3_add(Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 }
 
 /* Subtracts matrix2 from matrix1 and assigns the result to matrix1. */
-void matrix3x3_subtract(Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
+static inline void matrix3x3_subtract(Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 {
     matrix1->row[0].x -= matrix2->row[0].x;
     matrix1->row[0].y -= matrix2->row[0].y;
@@ -296,7 +296,7 @@ void matrix3x3_subtract(Matrix3x3 *matrix1, const Matrix3x3 *matrix2)
 }
 
 /* Multiplies matrix1 by a scalar and assigns the result to matrix1. */
-void matrix3x3_scale(Matrix3x3 *matrix, float scalar)
+static inline void matrix3x3_scale(Matrix3x3 *matrix, float scalar)
 {
     matrix->row[0].x *= scalar;
     matrix->row[0].y *= scalar;
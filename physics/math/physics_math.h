@@ -3,8 +3,13 @@
 
 // Libraries
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
 #include <math.h>
 #include <float.h>
+#include <fmath.h>
 
 #include "math_common.h"
 
@@ -16,64 +16,64 @@ typedef struct
 } Quaternion;
 
 // Function prototypes
-void quaternion_set(Quaternion *q, float x, float y, float z, float w);
-void quaternion_init(Quaternion *q);
-void quaternion_clear(Quaternion *q);
+static inline void quaternion_set(Quaternion *q, float x, float y, float z, float w);
+static inline void quaternion_init(Quaternion *q);
+static inline void quaternion_clear(Quaternion *q);
 
-void quaternion_setWithVector(Quaternion *q, float w, const Vector3 *v);
+static inline void quaternion_setWithVector(Quaternion *q, float w, const Vector3 *v);
 
-Quaternion quaternion_sum(const Quaternion *q, const Quaternion *r);
-Quaternion quaternion_difference(const Quaternion *q, const Quaternion *r);
-Quaternion quaternion_returnScaled(const Quaternion *q, float scalar);
-Quaternion quaternion_returnProduct(const Quaternion *q, const Quaternion *r);
-Vector3 quaternion_getVectorProduct(const Quaternion *q, const Vector3 *vector);
+static inline Quaternion quaternion_sum(const Quaternion *q, const Quaternion *r);
+static inline Quaternion quaternion_difference(const Quaternion *q, const Quaternion *r);
+static inline Quaternion quaternion_returnScaled(const Quaternion *q, float scalar);
+static inline Quaternion quaternion_returnProduct(const Quaternion *q, const Quaternion *r);
+static inline Vector3 quaternion_getVectorProduct(const Quaternion *q, const Vector3 *vector);
 
-void quaternion_setIdentity(Quaternion *q);
-Vector3 quaternion_returnVectorV(const Quaternion *q);
-float quaternion_magnitude(const Quaternion *q);
-float quaternion_squaredMagnitude(const Quaternion *q);
-void quaternion_normalize(Quaternion *q);
-void quaternion_invert(Quaternion *q);
+static inline void quaternion_setIdentity(Quaternion *q);
+static inline Vector3 quaternion_returnVectorV(const Quaternion *q);
+static inline float quaternion_magnitude(const Quaternion *q);
+static inline float quaternion_squaredMagnitude(const Quaternion *q);
+static inline void quaternion_normalize(Quaternion *q);
+static inline void quaternion_invert(Quaternion *q);
 
-Quaternion quaternion_returnUnit(const Quaternion *q);
+static inline Quaternion quaternion_returnUnit(const Quaternion *q);
 
-Quaternion quaternion_getConjugate(const Quaternion *q);
-Quaternion quaternion_getInverse(const Quaternion *q);
-float quaternion_dotProduct(const Quaternion *q, const Quaternion *r);
+static inline Quaternion quaternion_getConjugate(const Quaternion *q);
+static inline Quaternion quaternion_getInverse(const Quaternion *q);
+static inline float quaternion_dotProduct(const Quaternion *q, const Quaternion *r);
 
-bool quaternion_isFinite(const Quaternion *q);
-bool quaternion_isUnit(const Quaternion *q);
-bool quaternion_isValid(const Quaternion *q);
-bool quaternion_equals(const Quaternion *q, const Quaternion *r);
+static inline bool quaternion_isFinite(const Quaternion *q);
+static inline bool quaternion_isUnit(const Quaternion *q);
+static inline bool quaternion_isValid(const Quaternion *q);
+static inline bool quaternion_equals(const Quaternion *q, const Quaternion *r);
 
-void quaternion_setFromEulerAngles(Quaternion *quaternion, float angleX, float angleY, float angleZ);
-Quaternion quaternion_getFromEulerAngles(float angleX, float angleY, float angleZ);
-Quaternion quaternion_getFromVector(const Vector3 *rotation);
-Quaternion quaternion_getFromMatrix(const Matrix3x3 *matrix);
+static inline void quaternion_setFromEulerAngles(Quaternion *quaternion, float angleX, float angleY, float angleZ);
+static inline Quaternion quaternion_getFromEulerAngles(float angleX, float angleY, float angleZ);
+static inline Quaternion quaternion_getFromVector(const Vector3 *rotation);
+static inline Quaternion quaternion_getFromMatrix(const Matrix3x3 *matrix);
 
-void quaternion_setRotationAngleAxis(Quaternion *quaternion, float *angle, Vector3 *axis);
-Matrix3x3 quaternion_getMatrix(const Quaternion *quaternion);
+static inline void quaternion_setRotationAngleAxis(Quaternion *quaternion, float *angle, Vector3 *axis);
+static inline Matrix3x3 quaternion_getMatrix(const Quaternion *quaternion);
 
-Quaternion quaternion_slerp(const Quaternion *q, const Quaternion *r, float t);
+static inline Quaternion quaternion_slerp(const Quaternion *q, const Quaternion *r, float t);
 
-Quaternion quat_from_array(float arr[4]);
+static inline Quaternion quat_from_array(float arr[4]);
 
 // Implementations
 
 /* Initializes the quaternion to zero. */
-void quaternion_init(Quaternion *q)
+static inline void quaternion_init(Quaternion *q)
 {
     quaternion_set(q, 0.0f, 0.0f, 0.0f, 0.0f);
 }
 
 /* Initializes the quaternion with the component w and the vector v=(x y z). */
-void quaternion_setWithVector(Quaternion *q, float w, const Vector3 *v)
+static inline void quaternion_setWithVector(Quaternion *q, float w, const Vector3 *v)
 {
     quaternion_set(q, v->x, v->y, v->z, w);
 }
 
 /* Sets all values in the quaternion. */
-void quaternion_set(Quaternion *q, float x, float y, float z, float w)
+static inline void quaternion_set(Quaternion *q, float x, float y, float z, float w)
 {
     q->x = x;
     q->y = y;
@@ -82,37 +82,37 @@ void quaternion_set(Quaternion *q, float x, float y, float z, float w)
 }
 
 /* Sets the quaternion to zero. */
-void quaternion_clear(Quaternion *q)
+static inline void quaternion_clear(Quaternion *q)
 {
     quaternion_set(q, 0.0f, 0.0f, 0.0f, 0.0f);
 }
 
 /* Sets the quaternion to the identity quaternion. */
-void quaternion_setIdentity(Quaternion *q)
+static inline void quaternion_setIdentity(Quaternion *q)
 {
     quaternion_set(q, 0.0f, 0.0f, 0.0f, 1.0f);
 }
 
 /* Returns the vector v=(x y z) of the quaternion. */
-Vector3 quaternion_returnVectorV(const Quaternion *q)
+static inline Vector3 quaternion_returnVectorV(const Quaternion *q)
 {
     return (Vector3){q->x, q->y, q->z};
 }
 
 /* Returns the length of the quaternion. */
-float quaternion_magnitude(const Quaternion *q)
+static inline float quaternion_magnitude(const Quaternion *q)
 {
     return sqrtf(q->x * q->x + q->y * q->y + q->z * q->z + q->w * q->w);
 }
 
 /* Returns the square of the length of the quaternion. */
-float quaternion_squaredMagnitude(const Quaternion *q)
+static inline float quaternion_squaredMagnitude(const Quaternion *q)
 {
     return q->x * q->x + q->y * q->y + q->z * q->z + q->w * q->w;
 }
 
 /* Normalizes the quaternion. */
-void quaternion_normalize(Quaternion *q)
+static inline void quaternion_normalize(Quaternion *q)
 {
     float l = quaternion_magnitude(q);
     assert(l > TOLERANCE);
@@ -123,7 +123,7 @@ void quaternion_normalize(Quaternion *q)
 }
 
 /* Inverses the quaternion. */
-void quaternion_invert(Quaternion *q)
+static inline void quaternion_invert(Quaternion *q)
 {
     q->x = -q->x;
     q->y = -q->y;
@@ -131,7 +131,7 @@ void quaternion_invert(Quaternion *q)
 }
 
 /* Returns the unit quaternion. */
-Quaternion quaternion_returnUnit(const Quaternion *q)
+static inline Quaternion quaternion_returnUnit(const Quaternion *q)
 {
     float ql = quaternion_magnitude(q);
     assert(ql > TOLERANCE);
@@ -139,68 +139,68 @@ Quaternion quaternion_returnUnit(const Quaternion *q)
 }
 
 /* Returns the identity quaternion. */
-Quaternion quaternion_identity()
+static inline Quaternion quaternion_identity()
 {
     return (Quaternion){0.0f, 0.0f, 0.0f, 1.0f};
 }
 
 /* Returns the conjugate of the quaternion. */
-Quaternion quaternion_getConjugate(const Quaternion *q)
+static inline Quaternion quaternion_getConjugate(const Quaternion *q)
 {
     return (Quaternion){-q->x, -q->y, -q->z, q->w};
 }
 
 /* Returns the inverse of the quaternion. */
-Quaternion quaternion_getInverse(const Quaternion *q)
+static inline Quaternion quaternion_getInverse(const Quaternion *q)
 {
     return quaternion_getConjugate(q);
 }
 
 /* Computes the dot product between two quaternions. */
-float quaternion_dotProduct(const Quaternion *q, const Quaternion *r)
+static inline float quaternion_dotProduct(const Quaternion *q, const Quaternion *r)
 {
     return q->x * r->x + q->y * r->y + q->z * r->z + q->w * r->w;
 }
 
 /* Checks if the quaternion's values are finite. */
-bool quaternion_isFinite(const Quaternion *q)
+static inline bool quaternion_isFinite(const Quaternion *q)
 {
     return isFinite(q->x) && isFinite(q->y) && isFinite(q->z) && isFinite(q->w);
 }
 
 /* Checks if the quaternion is a unit quaternion. */
-bool quaternion_isUnit(const Quaternion *q)
+static inline bool quaternion_isUnit(const Quaternion *q)
 {
     float length = quaternion_magnitude(q);
     return fabsf(length - 1.0f) < 1e-5f;
 }
 
 /* Checks if the quaternion is valid. */
-bool quaternion_isValid(const Quaternion *q)
+static inline bool quaternion_isValid(const Quaternion *q)
 {
     return quaternion_isFinite(q) && quaternion_isUnit(q);
 }
 
 /* Adds two quaternions. */
-Quaternion quaternion_sum(const Quaternion *q, const Quaternion *r)
+static inline Quaternion quaternion_sum(const Quaternion *q, const Quaternion *r)
 {
     return (Quaternion){q->x + r->x, q->y + r->y, q->z + r->z, q->w + r->w};
 }
 
 /* Subtracts r from q. */
-Quaternion quaternion_difference(const Quaternion *q, const Quaternion *r)
+static inline Quaternion quaternion_difference(const Quaternion *q, const Quaternion *r)
 {
     return (Quaternion){q->x - r->x, q->y - r->y, q->z - r->z, q->w - r->w};
 }
 
 /* Multiplies the quaternion by a scalar. */
-Quaternion quaternion_returnScaled(const Quaternion *q, float scalar)
+static inline Quaternion quaternion_returnScaled(const Quaternion *q, float scalar)
 {
     return (Quaternion){q->x * scalar, q->y * scalar, q->z * scalar, q->w * scalar};
 }
 
 /* Multiplies two quaternions. */
-Quaternion quaternion_returnProduct(const Quaternion *q, const Quaternion *r)
+static inline Quaternion quaternion_returnProduct(const Quaternion *q, const Quaternion *r)
 {
     return (Quaternion){
         q->w * r->x + r->w * q->x + q->y * r->z - q->z * r->y,
@@ -210,7 +210,7 @@ Quaternion quaternion_returnProduct(const Quaternion *q, const Quaternion *r)
 }
 
 /* Multiplies the quaternion by a vector. */
-Vector3 quaternion_getVectorProduct(const Quaternion *q, const Vector3 *vector)
+static inline Vector3 quaternion_getVectorProduct(const Quaternion *q, const Vector3 *vector)
 {
     float prodX = q->w * vector->x + q->y * vector->z - q->z * vector->y;
     float prodY = q->w * vector->y + q->z * vector->x - q->x * vector->z;
@@ -224,13 +224,13 @@ Vector3 quaternion_getVectorProduct(const Quaternion *q, const Vector3 *vector)
 }
 
 /* Checks if two quaternions are equal. */
-bool quaternion_equals(const Quaternion *q, const Quaternion *r)
+static inline bool quaternion_equals(const Quaternion *q, const Quaternion *r)
 {
     return (q->x == r->x && q->y == r->y && q->z == r->z && q->w == r->w);
 }
 
 /* Initializes the quaternion using Euler angles. */
-void quaternion_setFromEulerAngles(Quaternion *quaternion, float angleX, float angleY, float angleZ)
+static inline void quaternion_setFromEulerAngles(Quaternion *quaternion, float angleX, float angleY, float angleZ)
 {
     float angle = angleX * 0.5f;
     float sinX = fm_sinf(angle);
@@ -259,7 +259,7 @@ void quaternion_setFromEulerAngles(Quaternion *quaternion, float angleX, float a
 }
 
 /* Returns a quaternion constructed from Euler angles (in radians). */
-Quaternion quaternion_getFromEulerAngles(float angleX, float angleY, float angleZ)
+static inline Quaternion quaternion_getFromEulerAngles(float angleX, float angleY, float angleZ)
 {
     Quaternion quaternion;
     quaternion_setFromEulerAngles(&quaternion, angleX, angleY, angleZ);
@@ -267,7 +267,7 @@ Quaternion quaternion_getFromEulerAngles(float angleX, float angleY, float angle
 }
 
 /* Returns a quaternion constructed from Euler angles (in radians). */
-Quaternion quaternion_getFromVector(const Vector3 *rotation)
+static inline Quaternion quaternion_getFromVector(const Vector3 *rotation)
 {
     Quaternion quaternion;
     quaternion_setFromEulerAngles(&quaternion, rotation->x, rotation->y, rotation->z);
@@ -275,7 +275,7 @@ Quaternion quaternion_getFromVector(const Vector3 *rotation)
 }
 
 /* Creates a unit quaternion from a rotation matrix. */
-Quaternion quaternion_getFromMatrix(const Matrix3x3 *matrix)
+static inline Quaternion quaternion_getFromMatrix(const Matrix3x3 *matrix)
 {
     Quaternion quaternion;
 
@@ -353,7 +353,7 @@ Quaternion quaternion_getFromMatrix(const Matrix3x3 *matrix)
 }
 
 /* Computes the rotation angle (in radians) and the rotation axis. */
-void quaternion_setRotationAngleAxis(Quaternion *quaternion, float *angle, Vector3 *axis)
+static inline void quaternion_setRotationAngleAxis(Quaternion *quaternion, float *angle, Vector3 *axis)
 {
     /* Compute the rotation angle */
     *angle = acosf(quaternion->w) * 2.0f;
@@ -369,7 +369,7 @@ void quaternion_setRotationAngleAxis(Quaternion *quaternion, float *angle, Vecto
 }
 
 /* Returns the orientation matrix corresponding to this quaternion. */
-Matrix3x3 quaternion_getMatrix(const Quaternion *quaternion)
+static inline Matrix3x3 quaternion_getMatrix(const Quaternion *quaternion)
 {
     float nQ = quaternion->x * quaternion->x + quaternion->y * quaternion->y + quaternion->z * quaternion->z + quaternion->w * quaternion->w;
     float s = 0.0f;
@@ -401,7 +401,7 @@ Matrix3x3 quaternion_getMatrix(const Quaternion *quaternion)
             {xzs - wys, yzs + wxs, 1.0f - xxs - yys}}};
 }
 
-Quaternion quaternion_slerp(const Quaternion *q, const Quaternion *r, float t)
+static inline Quaternion quaternion_slerp(const Quaternion *q, const Quaternion *r, float t)
 {
     assert(t >= 0.0f && t <= 1.0f);
 
@@ -444,7 +444,7 @@ Quaternion quaternion_slerp(const Quaternion *q, const Quaternion *r, float t)
     return quaternion_sum(&q1, &q2);
 }
 
-Vector3 quaternion_rotateVector(Vector3 v, Quaternion q)
+static inline Vector3 quaternion_rotateVector(Vector3 v, Quaternion q)
 {
     Vector3 u = {q.x, q.y, q.z};
     float s = q.w;
@@ -460,7 +460,7 @@ Vector3 quaternion_rotateVector(Vector3 v, Quaternion q)
     return result;
 }
 
-inline Quaternion quat_from_array(float arr[4])
+static inline Quaternion quat_from_array(float arr[4])
 {
     Quaternion result;
     result.x = arr[0];
@@ -13,83 +13,82 @@ typedef struct
     Quaternion orientation;
 } Transform;
 
-void transform_init(Transform *transform);
-void transform_initWithMatrix(Transform *transform, const Vector3 *position, const Matrix3x3 *orientation);
-void transform_initWithQuaternion(Transform *transform, const Vector3 *position, const Quaternion *orientation);
+static inline void transform_init(Transform *transform);
+static inline void transform_initWithMatrix(Transform *transform, const Vector3 *position, const Matrix3x3 *orientation);
+static inline void transform_initWithQuaternion(Transform *transform, const Vector3 *position, const Quaternion *orientation);
 
-Vector3 transform_getPosition(const Transform *transform);
-void transform_setPosition(Transform *transform, const Vector3 *position);
-Quaternion transform_getOrientation(const Transform *transform);
-void transform_setOrientation(Transform *transform, const Quaternion *orientation);
+static inline Vector3 transform_getPosition(const Transform *transform);
+static inline void transform_setPosition(Transform *transform, const Vector3 *position);
+static inline Quaternion transform_getOrientation(const Transform *transform);
+static inline void transform_setOrientation(Transform *transform, const Quaternion *orientation);
 
-void transform_setIdentity(Transform *transform);
-Transform transform_returnIdentity();
+static inline void transform_setIdentity(Transform *transform);
+static inline Transform transform_returnIdentity();
 
-Transform transform_getInverse(const Transform *transform);
-Transform transform_getInterpolated(const Transform *oldTransform, const Transform *newTransform, float factor);
+static inline Transform transform_getInverse(const Transform *transform);
+static inline Transform transform_getInterpolated(const Transform *oldTransform, const Transform *newTransform, float factor);
 
-Vector3 transform_getProductVector(const Transform *transform, const Vector3 *vector);
-Transform transform_product(const Transform *t1, const Transform *t2);
+static inline Vector3 transform_getProductVector(const Transform *transform, const Vector3 *vector);
+static inline Transform transform_product(const Transform *t1, const Transform *t2);
 
-bool transform_isValid(const Transform *transform);
-bool transform_equals(const Transform *t1, const Transform *t2);
-bool transform_notEquals(const Transform *t1, const Transform *t2);
-void transform_toString(const Transform *transform, char *buffer, size_t bufferSize);
+static inline bool transform_isValid(const Transform *transform);
+static inline bool transform_equals(const Transform *t1, const Transform *t2);
+static inline bool transform_notEquals(const Transform *t1, const Transform *t2);
 
 /* Initializes the transform to the identity transform. */
-void transform_init(Transform *transform)
+static inline void transform_init(Transform *transform)
 {
     vector3_clear(&transform->position);
     quaternion_setIdentity(&transform->orientation);
 }
 
 /* Initializes the transform with a given position and orientation matrix. */
-void transform_initWithMatrix(Transform *transform, const Vector3 *position, const Matrix3x3 *orientation)
+static inline void transform_initWithMatrix(Transform *transform, const Vector3 *position, const Matrix3x3 *orientation)
 {
     transform->position = *position;
     transform->orientation = quaternion_getFromMatrix(orientation);
 }
 
 /* Initializes the transform with a given position and orientation quaternion. */
-void transform_initWithQuaternion(Transform *transform, const Vector3 *position, const Quaternion *orientation)
+static inline void transform_initWithQuaternion(Transform *transform, const Vector3 *position, const Quaternion *orientation)
 {
     transform->position = *position;
     transform->orientation = *orientation;
 }
 
 /* Returns the position of the transform. */
-Vector3 transform_getPosition(const Transform *transform)
+static inline Vector3 transform_getPosition(const Transform *transform)
 {
     return transform->position;
 }
 
 /* Sets the position of the transform. */
-void transform_setPosition(Transform *transform, const Vector3 *position)
+static inline void transform_setPosition(Transform *transform, const Vector3 *position)
 {
     transform->position = *position;
 }
 
 /* Returns the orientation quaternion of the transform. */
-Quaternion transform_getOrientation(const Transform *transform)
+static inline Quaternion transform_getOrientation(const Transform *transform)
 {
     return transform->orientation;
 }
 
 /* Sets the orientation quaternion of the transform. */
-void transform_setOrientation(Transform *transform, const Quaternion *orientation)
+static inline void transform_setOrientation(Transform *transform, const Quaternion *orientation)
 {
     transform->orientation = *orientation;
 }
 
 /* Sets the transform to the identity transform. */
-void transform_setIdentity(Transform *transform)
+static inline void transform_setIdentity(Transform *transform)
 {
     vector3_set(&transform->position, 0.0f, 0.0f, 0.0f);
     quaternion_setIdentity(&transform->orientation);
 }
 
 /* Returns the inverse of the transform. */
-Transform transform_getInverse(const Transform *transform)
+static inline Transform transform_getInverse(const Transform *transform)
 {
     Quaternion invQuaternion = quaternion_getInverse(&transform->orientation);
     Vector3 invertedPosition = vector3_getInverse(&transform->position);
@@ -99,7 +98,7 @@ Transform transform_getInverse(const Transform *transform)
 }
 
 /* Returns an interpolated transform between two transforms. */
-Transform transform_getInterpolated(const Transform *oldTransform, const Transform *newTransform, float factor)
+static inline Transform transform_getInterpolated(const Transform *oldTransform, const Transform *newTransform, float factor)
 {
     Vector3 scaledOldPosition = vector3_returnScaled(&oldTransform->position, 1.0f - factor);
     Vector3 scaledNewPosition = vector3_returnScaled(&newTransform->position, factor);
@@ -110,7 +109,7 @@ Transform transform_getInterpolated(const Transform *oldTransform, const Transfo
 }
 
 /* Returns the identity transform. */
-Transform transform_returnIdentity()
+static inline Transform transform_returnIdentity()
 {
     Transform identityTransform;
     transform_setIdentity(&identityTransform);
@@ -118,20 +117,20 @@ Transform transform_returnIdentity()
 }
 
 /* Returns true if the transform is valid. */
-bool transform_isValid(const Transform *transform)
+static inline bool transform_isValid(const Transform *transform)
 {
     return vector3_isFinite(&transform->position) && quaternion_isValid(&transform->orientation);
 }
 
 /* Returns the transformed vector. */
-Vector3 transform_getProductVector(const Transform *transform, const Vector3 *vector)
+static inline Vector3 transform_getProductVector(const Transform *transform, const Vector3 *vector)
 {
     Vector3 rotatedVector = quaternion_getVectorProduct(&transform->orientation, vector);
     return vector3_sum(&rotatedVector, &transform->position);
 }
 
 /* Multiplies two transforms. */
-Transform transform_product(const Transform *t1, const Transform *t2)
+static inline Transform transform_product(const Transform *t1, const Transform *t2)
 {
     Vector3 rotatedPosition = quaternion_getVectorProduct(&t1->orientation, &t2->position);
     Vector3 newPosition = vector3_sum(&t1->position, &rotatedPosition);
@@ -141,13 +140,13 @@ Transform transform_product(const Transform *t1, const Transform *t2)
 }
 
 /* Returns true if the two transforms are equal. */
-bool transform_equals(const Transform *t1, const Transform *t2)
+static inline bool transform_equals(const Transform *t1, const Transform *t2)
 {
     return vector3_equals(&t1->position, &t2->position) && quaternion_equals(&t1->orientation, &t2->orientation);
 }
 
 /* Returns true if the two transforms are different. */
-bool transform_notEquals(const Transform *t1, const Transform *t2)
+static inline bool transform_notEquals(const Transform *t1, const Transform *t2)
 {
     return !transform_equals(t1, t2);
 }
@@ -1,6 +1,9 @@
 #ifndef PHYSICS_H
 #define PHYSICS_H
 
+// Physics library shared by the minigames, compiled once into the main executable.
+// The math is static inline in the headers, the shape tests are out of line in collision/shapes/*.c
+
 #include "math/physics_math.h"
 
 #include "body/rigid_body.h"
@@ -0,0 +1,10 @@
+// Stand-in for libdragon's fmath.h, so the physics library can be compiled on the host
+#ifndef FMATH_H
+#define FMATH_H
+
+#include <math.h>
+
+#define fm_sinf sinf
+#define fm_cosf cosf
+
+#endif
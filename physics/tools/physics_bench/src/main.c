@@ -0,0 +1,234 @@
+/**
+ * @file
+ *
+ * Host checks and benchmark for the shared physics library.
+ *
+ * First runs a set of known answer checks on the shape tests, then times the
+ * capsule kernels the minigames call every frame against random scenes.
+ * Exits with an error if any of the checks failed, so kernels can be tuned
+ * here and checked in one go.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../../../physics.h"
+
+#define SHAPE_COUNT 256
+#define CAPSULE_COUNT 64
+#define ROUNDS 200
+#define WORLD_SIZE 50.0f
+
+static int checks = 0;
+static int failures = 0;
+
+static void check(bool condition, const char *name)
+{
+    checks++;
+    if (!condition)
+    {
+        failures++;
+        printf("FAIL: %s\n", name);
+    }
+}
+
+static bool near(float a, float b)
+{
+    return fabsf(a - b) < 1e-3f;
+}
+
+static float random_range(float min, float max)
+{
+    return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+static Vector3 random_vector(float min, float max)
+{
+    return (Vector3){random_range(min, max), random_range(min, max), random_range(min, max)};
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// ---------- Known answer checks ---------- //
+
+static void check_sphere(void)
+{
+    Sphere a = {{0, 0, 0}, 1.0f};
+    Sphere b = {{1.5f, 0, 0}, 1.0f};
+    Sphere c = {{2.5f, 0, 0}, 0.4f};
+    check(sphere_contactSphere(&a, &b), "sphere touching sphere");
+    check(!sphere_contactSphere(&a, &c), "sphere apart from sphere");
+
+    ContactData contact;
+    contactData_init(&contact);
+    sphere_collisionTestSphere(&contact, &a, &b);
+    check(near(contact.normal.x, 1.0f) && near(contact.point.x, 0.5f), "sphere contact data");
+}
+
+static void check_aabb(void)
+{
+    AABB a, b, c;
+    aabb_setFromCenterAndSize(&a, &(Vector3){0, 0, 0}, &(Vector3){2, 2, 2});
+    aabb_setFromCenterAndSize(&b, &(Vector3){1.5f, 0, 0}, &(Vector3){2, 2, 2});
+    aabb_setFromCenterAndSize(&c, &(Vector3){3.5f, 0, 0}, &(Vector3){2, 2, 2});
+    check(aabb_contactAABB(&a, &b), "aabb overlapping aabb");
+    check(!aabb_contactAABB(&a, &c), "aabb apart from aabb");
+    check(aabb_containsPoint(&a, &(Vector3){0.5f, -0.5f, 0.9f}), "aabb contains point");
+
+    Vector3 closest = aabb_closestToPoint(&a, &(Vector3){5, 0.5f, -5});
+    check(near(closest.x, 1) && near(closest.y, 0.5f) && near(closest.z, -1), "aabb closest to point");
+
+    Sphere inside = {{1.5f, 0, 0}, 0.6f};
+    Sphere outside = {{1.5f, 1.5f, 0}, 0.6f};
+    check(aabb_contactSphere(&a, &inside), "aabb touching sphere");
+    check(!aabb_contactSphere(&a, &outside), "aabb apart from sphere");
+}
+
+static void check_capsule(void)
+{
+    Capsule capsule = {.radius = 0.5f, .length = 3.0f};
+    capsule_setVertical(&capsule, &(Vector3){0, 0, 0});
+    check(near(capsule.start.z, 0.5f) && near(capsule.end.z, 2.5f), "capsule set vertical");
+
+    Sphere sphere = {{0.8f, 0, 2.0f}, 0.4f};
+    check(capsule_contactSphere(&capsule, &sphere), "capsule touching sphere");
+    sphere.center.x = 1.0f;
+    check(!capsule_contactSphere(&capsule, &sphere), "capsule apart from sphere");
+
+    // A floor under the capsule, and one just out of reach
+    AABB floor = {{-5, -5, -1}, {5, 5, 0.1f}};
+    AABB low_floor = {{-5, -5, -1}, {5, 5, -0.1f}};
+    check(capsule_contactAABB(&capsule, &floor), "capsule standing on aabb");
+    check(!capsule_contactAABB(&capsule, &low_floor), "capsule above aabb");
+
+    ContactData contact;
+    contactData_init(&contact);
+    capsule_contactAABBSetData(&contact, &capsule, &floor);
+    check(near(contact.normal.z, 1.0f) && near(contact.penetration, 0.1f), "capsule aabb contact data");
+
+    // A wall next to the capsule, then the same wall as a box rotated a quarter turn about z
+    AABB wall = {{0.4f, -1, 0}, {1.4f, 1, 3}};
+    check(capsule_contactAABB(&capsule, &wall), "capsule touching wall");
+    Box box = {.size = {2, 1, 3}, .center = {0.9f, 0, 1.5f}, .rotation = {0, 0, 90}};
+    check(capsule_contactBox(&capsule, &box), "capsule touching rotated box");
+    box.center.x = 1.2f;
+    check(!capsule_contactBox(&capsule, &box), "capsule apart from rotated box");
+
+    box.center.x = 0.9f;
+    capsule_contactBoxSetData(&contact, &capsule, &box);
+    check(near(contact.normal.x, -1.0f) && near(contact.penetration, 0.1f), "capsule box contact data");
+
+    Plane plane;
+    plane_setFromNormalAndPoint(&plane, &(Vector3){0, 0, 1}, &(Vector3){0, 0, 0.2f});
+    check(capsule_contactPlane(&capsule, &plane), "capsule touching plane");
+
+    Ray ray = {.origin = {-5, 0, 1.5f}, .direction = {1, 0, 0}};
+    check(capsule_intersectionRay(&capsule, &ray), "ray through capsule");
+    ray.origin.y = 2.0f;
+    check(!capsule_intersectionRay(&capsule, &ray), "ray past capsule");
+}
+
+static void check_ray(void)
+{
+    AABB box = {{-1, -1, -1}, {1, 1, 1}};
+    Ray ray = {.origin = {-5, 0, 0}, .direction = {1, 0, 0}};
+    check(ray_intersectionAABB(&ray, &box), "ray through aabb");
+
+    ContactData contact;
+    contactData_init(&contact);
+    raycast_aabb(&contact, &ray, &box);
+    check(near(contact.point.x, -1.0f), "raycast aabb contact point");
+
+    ray.direction = (Vector3){-1, 0, 0};
+    check(!ray_intersectionAABB(&ray, &box), "ray away from aabb");
+}
+
+// ---------- Benchmark ---------- //
+
+static Capsule capsules[CAPSULE_COUNT];
+static AABB aabbs[SHAPE_COUNT];
+static Box boxes[SHAPE_COUNT];
+
+static void setup_scene(void)
+{
+    for (int i = 0; i < CAPSULE_COUNT; i++)
+    {
+        capsules[i] = (Capsule){.radius = random_range(0.5f, 2.0f), .length = random_range(3.0f, 8.0f)};
+        Vector3 position = random_vector(-WORLD_SIZE, WORLD_SIZE);
+        capsule_setVertical(&capsules[i], &position);
+    }
+    for (int i = 0; i < SHAPE_COUNT; i++)
+    {
+        Vector3 center = random_vector(-WORLD_SIZE, WORLD_SIZE);
+        Vector3 size = random_vector(1.0f, 20.0f);
+        aabb_setFromCenterAndSize(&aabbs[i], &center, &size);
+        boxes[i] = (Box){.size = size, .center = center, .rotation = random_vector(-180.0f, 180.0f)};
+    }
+}
+
+typedef int (*kernel_t)(const Capsule *capsule, int shape);
+
+static int kernel_contactAABB(const Capsule *capsule, int shape)
+{
+    return capsule_contactAABB(capsule, &aabbs[shape]);
+}
+
+static int kernel_contactAABBSetData(const Capsule *capsule, int shape)
+{
+    ContactData contact;
+    capsule_contactAABBSetData(&contact, capsule, &aabbs[shape]);
+    return contact.penetration > 0.0f;
+}
+
+static int kernel_contactBox(const Capsule *capsule, int shape)
+{
+    return capsule_contactBox(capsule, &boxes[shape]);
+}
+
+static int kernel_contactBoxSetData(const Capsule *capsule, int shape)
+{
+    ContactData contact;
+    capsule_contactBoxSetData(&contact, capsule, &boxes[shape]);
+    return contact.penetration > 0.0f;
+}
+
+static void bench(const char *name, kernel_t kernel)
+{
+    int hits = 0;
+    double start = now();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        for (int i = 0; i < CAPSULE_COUNT; i++)
+        {
+            for (int j = 0; j < SHAPE_COUNT; j++)
+            {
+                hits += kernel(&capsules[i], j);
+            }
+        }
+    }
+    double calls = (double)ROUNDS * CAPSULE_COUNT * SHAPE_COUNT;
+    printf("%-28s %7.1f ns/call, %d hits\n", name, (now() - start) / calls, hits / ROUNDS);
+}
+
+int main(void)
+{
+    check_sphere();
+    check_aabb();
+    check_capsule();
+    check_ray();
+    printf("checks: %d passed, %d failed\n", checks - failures, failures);
+
+    srand(2024);
+    setup_scene();
+    bench("capsule_contactAABB", kernel_contactAABB);
+    bench("capsule_contactAABBSetData", kernel_contactAABBSetData);
+    bench("capsule_contactBox", kernel_contactBox);
+    bench("capsule_contactBoxSetData", kernel_contactBoxSetData);
+
+    return failures == 0 ? 0 : 1;
+}